@@ -0,0 +1,22 @@
+	.file	"assert.c"
+	.text
+	.p2align 4
+	.globl	assert
+	.type	assert, @function
+assert:
+.LFB11:
+	.cfi_startproc
+	testl	%edi, %edi
+	je	.L7
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	call	exit@PLT
+	.cfi_endproc
+.LFE11:
+	.size	assert, .-assert
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
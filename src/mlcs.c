@@ -37,14 +37,57 @@
 #include <string.h>
 #include <stdio.h>
 #include <assert.h>
+#include <limits.h>
 
 #include "ort.h"
 #include "string.h"
+#include "skyline.h"
 #include "mlcs.h"
 #include "naivemlcs.h"
 #include "pointQueue.h"
 #include "pointHash.h"
 
+#ifndef SWITCH_COST
+/* A pop repair gives up once its work passes SWITCH_COST times the
+   estimated work of a rebuild. Larger values rebuild less often. */
+#define SWITCH_COST 2.0
+#endif /* SWITCH_COST */
+
+#ifndef WINDOW_POP_COST
+/* A window batch pops a letter instead of building the window again
+   when a pop costs less than building WINDOW_POP_COST letters. A pop
+   repair measured about 160 letters of a build, an append about 1. */
+#define WINDOW_POP_COST 160.0
+#endif /* WINDOW_POP_COST */
+
+#ifndef FLUSH_POP_COST
+/* A lazy flush counts a pending pop as FLUSH_POP_COST appends. On
+   random strings a pop measured 16 to 34 appends, for 2 to 4 strings
+   over 4 and 12 letters. */
+#define FLUSH_POP_COST 32
+#endif /* FLUSH_POP_COST */
+
+#ifndef FLUSH_REBUILD_RATIO
+/* A lazy flush builds the fronts again when replaying the edits costs
+   more appends than the average string length divided by
+   FLUSH_REBUILD_RATIO. On the same strings a rebuild measured as many
+   appends as the length divided by 1.2 to 7.6, from 4 strings to 2. */
+#define FLUSH_REBUILD_RATIO 3
+#endif /* FLUSH_REBUILD_RATIO */
+
+#ifndef POP_MANY_MIN
+/* A lazy flush uses popMany for POP_MANY_MIN or more pops of a string
+   and single pops below that, the break even point measured on random
+   strings. */
+#define POP_MANY_MIN 16
+#endif /* POP_MANY_MIN */
+
+#ifndef REBASE_LIMIT
+/* Once a string begins at REBASE_LIMIT the positions of every string
+   move back to 0, long before an int overflows. */
+#define REBASE_LIMIT (1 << 30)
+#endif /* REBASE_LIMIT */
+
 /* A structure for storing a multiple longest common sub-string. */
 #ifdef NDEBUG
 struct mlcs{
@@ -54,9 +97,88 @@ struct mlcs{
   int lambda; /* The size of the mlcs */
   ort *PF;    /* Array with pareto fronts. */
   int pfA;    /* Size of the PF array */
+  int lazy;   /* Update the fronts only on queries */
+  int *pops;  /* Pending pops of each string */
+  string *P;  /* Pending appends of each string */
+  int cap;    /* Highest front that is kept */
+  int beam;   /* Most points kept in a front, 0 keeps all */
+  double (*score)(point p, int d); /* Higher is evicted first */
+  long evicted; /* Points evicted so far */
+  int grow;   /* Only appends, the fronts are insert only */
+  int repairs;  /* Pops repaired on the fronts */
+  int rebuilds; /* Pops that built the fronts again instead */
+  void (*feed)(void *arg, int r, point p, int d, int sign); /* Gets the front changes, or NULL */
+  void *feedArg; /* Passed to feed */
+  ort X;      /* Cross layer index of the fronts, or NULL */
+  skyline K;  /* Candidates for the next points of a front */
+  long budget; /* Work per edit in budget mode, 0 is off */
+  struct repair *job; /* Job of budget mode in progress, or NULL */
+  struct rebase *move; /* Rebase in progress, or NULL */
 };
 #endif /* NDEBUG */
 
+/* A sweep over the layers that budget mode runs one layer at a time,
+   see sweepRun. It is an append, or the pops of popMany, followed in
+   approximate mode by trimFronts. The same steps do the whole sweep in
+   append and popMany. */
+typedef struct sweep *sweep;
+struct sweep{
+  char c;      /* Letter appended, or 0 for pops */
+  int r;       /* Next layer */
+  int trim;    /* The append or the pops are done, trimming */
+  int done;    /* The sweep is over */
+  int top;     /* Append: highest layer that can change */
+  int e;       /* Append: position of the letter */
+  point z;     /* Append: lower point */
+  point f;     /* Append: further right point */
+  point p;     /* Memory for candidates */
+  point lo;    /* Pops: range limits */
+  point hi;
+  int nR;      /* Pops: points removed from layer r */
+  int nRp;     /* Pops: points removed from layer r-1 */
+  int Ra;      /* Pops: alloced size of R and Rp */
+  point *R;
+  point *Rp;
+  pointHash H;  /* Pops: owns the points in R */
+  pointHash Hp; /* Pops: owns the points in Rp */
+  pointQueue A; /* Pops: points added to layer r-1 */
+  int nV;      /* Trim: points removed from layer r-1 */
+  point *V;
+};
+
+/* A pop repair that runs over several calls, in budget mode. It keeps
+   the queues and the layer where it stopped. The jobs of budget mode
+   that are sweeps only use j and W. */
+typedef struct repair *repair;
+struct repair{
+  int j;       /* Which string */
+  long budget; /* Work allowed */
+  long work;   /* Work so far */
+  int r;       /* Current layer */
+  int stop;    /* Gave up */
+  pointQueue Q; /* The main queue */
+  pointQueue M; /* For cleaning non minima, owns its points */
+  point p;     /* Memory for candidates */
+  int *plI;    /* Point with large indexes */
+  int *pprev;  /* Previous positions of p */
+  sweep W;     /* A sweep instead of a pop repair, or NULL */
+};
+
+/* A rebase that runs over several pops. Each pop copies one layer of
+   the fronts, with the positions moved down by off, and the layers
+   already copied follow the later changes of the fronts. Once every
+   layer is copied the strings move, the copies replace the fronts and
+   the old trees are freed, again one layer per pop. */
+typedef struct rebase *rebase;
+struct rebase{
+  int *off;  /* The offsets */
+  int r;     /* Next layer, layer 0 does not move */
+  int done;  /* The copies replaced the fronts */
+  int nA;    /* Size of N */
+  ort *N;    /* The copies, then the old trees, or NULL */
+  ort X;     /* Same for the cross layer index */
+};
+
 #ifndef NDEBUG
 static void
 checkMLCS(mlcs m)
@@ -85,6 +207,46 @@ checkMLCS(mlcs m)
     }
     free(T);
   }
+
+  if(NULL != m->X){ /* The index has the same points */
+    int w = 0;
+    int Q[m->dim+1];
+    point q = Q;
+    for(int k = 0; k < m->dim; k++)
+      z[k] = -2;
+    for(int i = 0; i < m->pfA; i++){
+      if(NULL == m->PF[i])
+	continue;
+      w += weightORT(m->PF[i]);
+      T = collect(m->PF[i], z, &n);
+      for(int j = 0; j < n; j++){
+	memcpy(q, T[j], m->dim*sizeof(int));
+	q[m->dim] = -i;
+	assert(containsQ(m->X, q) && "Point missing from the index");
+	free(T[j]);
+      }
+      free(T);
+    }
+    assert(w == weightORT(m->X) && "Extra points in the index");
+  }
+
+  rebase R = m->move; /* The copies of a rebase in progress */
+  for(int i = 1; NULL != R && !R->done && i < R->r; i++){
+    assert((NULL == m->PF[i]) == (NULL == R->N[i]) && "Layer without its copy");
+    if(NULL == m->PF[i])
+      continue;
+    for(int k = 0; k < m->dim; k++)
+      z[k] = -2;
+    T = collect(m->PF[i], z, &n);
+    assert(n == weightORT(R->N[i]) && "Extra points in the copy");
+    for(int j = 0; j < n; j++){
+      for(int k = 0; k < m->dim; k++)
+	T[j][k] -= R->off[k];
+      assert(containsQ(R->N[i], T[j]) && "Point missing from the copy");
+      free(T[j]);
+    }
+    free(T);
+  }
 }
 #endif /* NDEBUG */
 
@@ -137,6 +299,26 @@ allocMLCS(int dim, /* The number of strings. */
   for(int i = 0; i < dim; i++)
     r->S[i] = stringAlloc(sigma);
 
+  r->lazy = 0;
+  r->cap = INT_MAX;
+  r->beam = 0;
+  r->score = NULL;
+  r->evicted = 0;
+  r->grow = 0;
+  r->repairs = 0;
+  r->rebuilds = 0;
+  r->feed = NULL;
+  r->feedArg = NULL;
+  r->X = NULL;
+  r->K = allocSK(dim);
+  r->budget = 0;
+  r->job = NULL;
+  r->move = NULL;
+  r->pops = calloc(dim, sizeof(int));
+  r->P = calloc(dim, sizeof(string));
+  for(int i = 0; i < dim; i++)
+    r->P[i] = stringAlloc(sigma);
+
   point p = malloc(dim*sizeof(int));
   for(int i = 0; i < dim; i++)
     p[i] = -1;
@@ -148,6 +330,162 @@ allocMLCS(int dim, /* The number of strings. */
   return r;
 }
 
+mlcs
+allocMLCSThreshold(int dim, /* The number of strings. */
+		   int sigma, /* Alphabet size */
+		   int k /* Target length */
+		   )
+{
+  assert(0 < k && "Error: threshold should be positive.");
+  mlcs r = allocMLCS(dim, sigma);
+  r->cap = k;
+
+  return r;
+}
+
+/* Points that end earlier are more likely to get successors */
+static double
+sumScore(point p,
+	 int d
+	 )
+{
+  double s = 0;
+  for(int i = 0; i < d; i++)
+    s += p[i];
+
+  return s;
+}
+
+mlcs
+allocMLCSApprox(int dim, /* The number of strings. */
+		int sigma, /* Alphabet size */
+		int B, /* Most points per front */
+		double (*score)(point p, int d) /* Higher is evicted first */
+		)
+{
+  assert(0 < B && "Error: fronts should keep some points.");
+  mlcs r = allocMLCS(dim, sigma);
+  r->beam = B;
+  r->score = NULL != score ? score : sumScore;
+
+  return r;
+}
+
+mlcs
+allocMLCSGrow(int dim, /* The number of strings. */
+	      int sigma /* Alphabet size */
+	      )
+{
+  mlcs r = allocMLCS(dim, sigma);
+  r->grow = 1;
+
+  return r;
+}
+
+void
+printStatsMLCS(mlcs m
+	       )
+{
+  printf("[STATS] repairs %d rebuilds %d\n", m->repairs, m->rebuilds);
+}
+
+/* Reports every later change of the fronts, as feed(arg, r, p,
+   dim, sign) with sign +1 when p enters layer r and -1 when it
+   leaves. A rebase is reported as sign 0, with p the offsets that
+   every point lost, negative when a prepend makes room. The point is only valid during the call. NULL
+   stops it. */
+void
+feedMLCS(mlcs m,
+	 void (*feed)(void *arg, int r, point p, int d, int sign),
+	 void *arg /* Passed to feed */
+	 )
+{
+  m->feed = feed;
+  m->feedArg = arg;
+}
+
+/* Frees the sweep and the points it owns, the fronts are not
+   touched */
+static void
+freeSweep(sweep W
+	  )
+{
+  if(NULL != W->A){
+    while(!isEmptyPQ(W->A)){
+      free(topPQ(W->A));
+      popPQ(W->A);
+    }
+    freePQ(W->A);
+  }
+  if(NULL != W->H)
+    freePH(W->H);
+  if(NULL != W->Hp)
+    freePH(W->Hp);
+  for(int l = 0; l < W->nV; l++)
+    free(W->V[l]);
+  free(W->V);
+  free(W->R);
+  free(W->Rp);
+  free(W->hi);
+  free(W->lo);
+  free(W->p);
+  free(W->f);
+  free(W->z);
+  free(W);
+}
+
+/* Frees the repair, the fronts are not touched */
+static void
+freeRepair(repair R
+	   )
+{
+  if(NULL != R->W)
+    freeSweep(R->W);
+  else {
+    while(!isEmptyPQ(R->Q)){
+      free(topPQ(R->Q));
+      popPQ(R->Q);
+    }
+    while(!isEmptyPQ(R->M)){
+      free(topPQ(R->M));
+      popPQ(R->M);
+    }
+    freePQ(R->Q);
+    freePQ(R->M);
+    free(R->pprev);
+    free(R->plI);
+    free(R->p);
+  }
+  free(R);
+}
+
+/* Frees the rebase with the trees it still owns */
+static void
+freeRebase(rebase B
+	   )
+{
+  for(int r = 0; r < B->nA; r++)
+    if(NULL != B->N[r])
+      freeORT(B->N[r]);
+  if(NULL != B->X)
+    freeORT(B->X);
+  free(B->N);
+  free(B->off);
+  free(B);
+}
+
+/* Drops the rebase in progress, if any. The positions stay where
+   they are and a later pop starts it again. */
+static void
+cancelRebase(mlcs m
+	     )
+{
+  if(NULL != m->move){
+    freeRebase(m->move);
+    m->move = NULL;
+  }
+}
+
 void
 freeMLCS(mlcs m /* The structure */
 	 )
@@ -160,12 +498,28 @@ freeMLCS(mlcs m /* The structure */
   free(m->S);
   m->S = NULL;
 
+  for(int i = 0; i < m->dim; i++)
+    stringFree(m->P[i]);
+  free(m->P);
+  m->P = NULL;
+  free(m->pops);
+  m->pops = NULL;
+
   for(int j = 0; j < m->pfA; j++){
     if(NULL != m->PF[j])
       freeORT(m->PF[j]);
     m->PF[j] = NULL;
   }
   free(m->PF);
+  if(NULL != m->X)
+    freeORT(m->X);
+  m->X = NULL;
+  freeSK(m->K);
+  m->K = NULL;
+  if(NULL != m->job) /* The fronts go as well */
+    freeRepair(m->job);
+  m->job = NULL;
+  cancelRebase(m);
 
   m->dim = 0;
   m->lambda = 0;
@@ -174,355 +528,2550 @@ freeMLCS(mlcs m /* The structure */
   free(m);
 }
 
-string
-pullString(mlcs m,
-	   int t /* Which string do you want */
-          )
+/* Lazy mode: records the removal of the first k letters of string j.
+   Letters appended in the same burst are dropped from the pending
+   appends, so they never reach the fronts. */
+static void
+lazyPop(mlcs m, /* The MLCS data struct */
+	int j,  /* Which string */
+	int k   /* Number of letters */
+	)
 {
-  return m->S[t];
+  int n = stringSize(m->S[j]) - m->pops[j]; /* Old letters left */
+
+  if(k <= n)
+    m->pops[j] += k;
+  else {
+    assert(k-n <= stringSize(m->P[j]) && "Popping more letters than the string has.");
+    m->pops[j] += n;
+    m->P[j] = stringOwn(m->P[j]);
+    stringPopMany(m->P[j], k-n);
+  }
 }
 
-void
-append(mlcs m, /* The MLCS data struct */
-       int j,  /* Which string */
-       char c  /* Which letter */
-       )
+/* Lazy mode: records the append of s[0..len-1] to string j. */
+static void
+lazyAppend(mlcs m, /* The MLCS data struct */
+	   int j,  /* Which string */
+	   const char *s, /* The letters */
+	   int len /* Number of letters */
+	   )
 {
-  string S = m->S[j];
-  if(0 == stringSize(S))
-    m->zeros--; /* Another string gets a size */
+  m->P[j] = stringOwn(m->P[j]);
+  for(int k = 0; k < len; k++)
+    stringAppend(m->P[j], s[k]);
+}
 
-  if(0 == m->zeros){
-    if(1+m->lambda == m->pfA){
-      m->pfA *= 2;
-      m->PF = realloc(m->PF, m->pfA*sizeof(ort));
-      bzero(&(m->PF[m->lambda+1]),
-	    (m->pfA/2)*sizeof(ort)
-	    );
-    }
+/* Inserts, sign +1, or deletes, sign -1, point p of layer r in the
+   cross layer index. The extra coordinate is -r, so that the layers
+   at least r are the ones below 1-r. */
+static void
+indexPoint(mlcs m,
+	   int r, /* Which layer */
+	   point p,
+	   int sign
+	   )
+{
+  int Q[m->dim+1];
+  point q = Q;
+
+  memcpy(q, p, m->dim*sizeof(int));
+  q[m->dim] = -r;
+  if(0 < sign)
+    insert(m->X, q);
+  else
+    delete(m->X, q);
+}
 
-    if(NULL == m->PF[m->lambda+1])
-      m->PF[m->lambda+1] = allocORT(m->dim);
+/* Repeats the insert, sign +1, or delete, sign -1, of point p of
+   layer r on its copy, once the rebase in progress copied layer r. */
+static void
+rebaseMirror(mlcs m,
+	     int r, /* Which layer */
+	     point p,
+	     int sign
+	     )
+{
+  rebase B = m->move;
+  if(NULL == B || B->done || 0 == r || B->r <= r)
+    return;
 
-    int dim = m->dim;
-    /* candidate point */
-    point p = malloc(dim*sizeof(int));
-    /* Lower point */
-    point z = malloc(dim*sizeof(int));
-    /* further right point */
-    point f = malloc(dim*sizeof(int));
-    for(int i = 0; i < dim; i++){
-      z[i] = -1;
-      f[i] = stringLast(m->S[i], c);
-    }
-    z[j] = stringLast(m->S[j], c);
-    f[j] = stringEnd(m->S[j]);
+  int Q[m->dim+1];
+  point q = Q;
+  for(int i = 0; i < m->dim; i++)
+    q[i] = p[i] - B->off[i];
+  q[m->dim] = -r;
+  if(0 < sign){
+    insert(B->N[r], q);
+    if(NULL != B->X)
+      insert(B->X, q);
+  } else {
+    if(NULL != B->X)
+      delete(B->X, q);
+    delete(B->N[r], q);
+  }
+}
 
-    for(int r = 0; r <= m->lambda; r++){
-      int n;
-      /* point *T = collect(m->PF[r], z, &n); */
-      point *T = rangeCollect(m->PF[r], z, f, &n);
-      int excludeP;
+/* Inserts p in layer r and reports it to the change feed */
+static void
+frontInsert(mlcs m,
+	    int r, /* Which layer */
+	    point p
+	    )
+{
+  insert(m->PF[r], p);
+  if(NULL != m->X)
+    indexPoint(m, r, p, 1);
+  rebaseMirror(m, r, p, 1);
+  if(NULL != m->feed)
+    m->feed(m->feedArg, r, p, m->dim, 1);
+}
 
-      if(0 < n){
-	ort tempP = allocORT(dim); /* Temporary points */
-	for(int k = 0; k < n; k++){ /* Process points */
-	  excludeP = 0;
-	  for(int i = 0; !excludeP && i < dim; i++){
-	    p[i] = stringCeil(m->S[i], c, T[k][i]+1);
-	    if(i == j){
-	      p[i] = stringEnd(m->S[i]);
-	      excludeP = T[k][i] == p[i];
-	    } else
-	      excludeP = -2 == p[i];
-	  }
+/* Deletes p from layer r and reports it to the change feed */
+static void
+frontDelete(mlcs m,
+	    int r, /* Which layer */
+	    point p
+	    )
+{
+  if(NULL != m->feed)
+    m->feed(m->feedArg, r, p, m->dim, -1);
+  if(NULL != m->X)
+    indexPoint(m, r, p, -1);
+  rebaseMirror(m, r, p, -1);
+  delete(m->PF[r], p);
+}
 
-	  /* if(!excludeP){ */
-	  /*   printf("\n [CHECK] j: %d >> ( ", j); */
-	  /*   for(int i = 0; i < dim; i++) */
-	  /*     printf("%d < %d, ", T[k][i], p[i]); */
-	  /*   printf(")\n"); */
-	  /* } */
+/* The n points of V already left layer r. Removes them from the
+   index and reports them to the change feed. */
+static void
+frontRemoved(mlcs m,
+	     int r, /* Which layer */
+	     point *V,
+	     int n
+	     )
+{
+  for(int k = 0; NULL != m->X && k < n; k++)
+    indexPoint(m, r, V[k], -1);
+  for(int k = 0; NULL != m->move && k < n; k++)
+    rebaseMirror(m, r, V[k], -1);
+  for(int k = 0; NULL != m->feed && k < n; k++)
+    m->feed(m->feedArg, r, V[k], m->dim, -1);
+}
 
-	  free(T[k]);
-	  if(!excludeP){
-	    /* Check to see if it is dominated on the PF */
-            plusPlus(p, dim);
-	    excludeP = 0 < countQ(m->PF[r+1], p);
-	    if(!excludeP) /* Avoid duplicate inserts */
-	      excludeP = 0 < countQ(tempP, p);
-            minusMinus(p, dim);
-	    if(!excludeP)
-	      insert(tempP, p);
-	  }
-	}
+/* Frees layer r, its points are reported as removed */
+static void
+freeFront(mlcs m,
+	  int r /* Which layer */
+	  )
+{
+  if(NULL != m->feed && 0 < r){
+    int n;
+    int Z[m->dim];
+    point z = Z;
+    for(int i = 0; i < m->dim; i++)
+      z[i] = -2;
+    point *T = collect(m->PF[r], z, &n);
+    frontRemoved(m, r, T, n);
+    for(int k = 0; k < n; k++)
+      free(T[k]);
+    free(T);
+  }
+  freeORT(m->PF[r]);
+  m->PF[r] = NULL;
+}
 
-	free(T);
-	T = collect(tempP, z, &n);
-	for(int k = 0; k < n; k++){ /* Process points */
-	  /* Check to see if it is a minima */
-	  plusPlus(T[k], dim);
-	  excludeP = 1 < countQ(tempP, T[k]);
-	  minusMinus(T[k], dim);
-	  if(!excludeP)
-	    insert(m->PF[r+1], T[k]);
-	  free(T[k]);
-	}
-	freeORT(tempP);
+/* Keeps the points of every front, labelled with their layer, in one
+   extra tree. Appends then get the points of all the layers inside
+   their box with a single query. 1 builds it, 0 frees it. */
+void
+indexMLCS(mlcs m,
+	  int on /* 1 keeps the index, 0 drops it */
+	  )
+{
+  if(on != (NULL != m->X))
+    cancelRebase(m); /* It has no copy of the index, or a stale one */
+  if(on && NULL == m->X){
+    int Z[m->dim];
+    point z = Z;
+    for(int i = 0; i < m->dim; i++)
+      z[i] = -2;
+
+    m->X = m->grow ? allocORTGrow(m->dim+1) : allocORT(m->dim+1);
+    for(int r = 0; r < m->pfA; r++){
+      int n;
+      if(NULL == m->PF[r])
+	continue;
+      point *T = collect(m->PF[r], z, &n);
+      for(int k = 0; k < n; k++){
+	indexPoint(m, r, T[k], 1);
+	free(T[k]);
       }
       free(T);
     }
+  }
+  if(!on && NULL != m->X){
+    freeORT(m->X);
+    m->X = NULL;
+  }
+}
 
-    if(0 < weightORT(m->PF[m->lambda+1]))
-       m->lambda++;
-
-    free(f);
-    free(z);
-    free(p);
+/* Make sure the front above lambda exists. */
+static void
+growPF(mlcs m
+       )
+{
+  if(m->lambda == m->cap)
+    return; /* Threshold mode keeps nothing above */
+
+  if(1+m->lambda == m->pfA){
+    int a = m->pfA;
+    m->pfA = m->cap < 2*a ? m->cap+1 : 2*a;
+    m->PF = realloc(m->PF, m->pfA*sizeof(ort));
+    bzero(&(m->PF[a]),
+	  (m->pfA-a)*sizeof(ort)
+	  );
   }
 
-  stringAppend(S, c);
+  if(NULL == m->PF[m->lambda+1])
+    m->PF[m->lambda+1] = m->grow ? allocORTGrow(m->dim) : allocORT(m->dim);
 
-#ifndef NDEBUG
-  printMLCS(m);
-  checkMLCS(m);
-#endif /* NDEBUG */
+  rebase B = m->move; /* A copied layer gets its copy */
+  if(NULL != B && !B->done && m->lambda+1 < B->r &&
+     NULL == B->N[m->lambda+1])
+    B->N[m->lambda+1] = m->grow ? allocORTGrow(m->dim) : allocORT(m->dim);
 }
 
-#ifndef NDEBUG
-static void
-gdbBreak(void) {}
-#endif /* NDEBUG */
-
+/* Layer r+1 has the minima of the successors of layer r, as in the
+   dominant point sweep of QuickDP. The skyline kernel finds the minima
+   of the candidates and each front is loaded once with buildORT.
+   Builds the fronts of the strings of m, which only has layer 0, and
+   keeps the modes of m: the threshold, the beam, the insert only trees
+   and the feed. */
 static void
-uncover(pointQueue M, /* For removing non-minima. */
-	pointHash CleanM,
-	mlcs m,
-        char c,
-        int r,
-        int j, /* Important only when 0 == r */
-        int *pprev, /* The point of previous pos */
-        int *baseTop, /* The point that is moving */
-	int *baseBot /* The far away point */
-        )
+buildFronts(mlcs m
+	    )
 {
   int dim = m->dim;
+  int sigma = stringSigma(m->S[0]);
 
-  if(1 == r){
-    if(baseBot[j] > baseTop[j]){
-      point p = malloc(dim*sizeof(int));
-      memcpy(p, baseTop, dim*sizeof(int));
-
-      p[j] = stringCeil(m->S[j], c, p[j]+1);
-
-      plusPlus(p, dim);
-      int insertQ = 1 == countQ(m->PF[r], p);
-      minusMinus(p, dim);
+  int Z[dim];
+  point z = Z;
+  for(int i = 0; i < dim; i++)
+    z[i] = -2;
+
+  for(int r = 0; 0 == m->zeros && r < m->cap; r++){
+    int n;
+    point *T = collect(m->PF[r], z, &n);
+
+    /* Candidates, flat for the skyline kernel */
+    int *C = malloc((0 < n ? n : 1)*sigma*dim*sizeof(int));
+    int nC = 0;
+    for(int k = 0; k < n; k++){
+      char c = 'A';
+      for(int l = 0; l < sigma; l++, c++){
+	point q = &C[nC*dim];
+	int valid = 1;
+	for(int i = 0; valid && i < dim; i++){
+	  q[i] = stringCeil(m->S[i], c, T[k][i]+1);
+	  valid = -2 != q[i];
+	}
+	nC += valid;
+      }
+      free(T[k]);
+    }
+    free(T);
 
-      if(insertQ){
-	insert(m->PF[r], p);
-	pushPQ(M, p);
-	insertPH(CleanM, p);
-	/* printf("MIN REMOVAL >>>>>> Pushed %d %d\n", p[0], p[1]); */
+    int nM = skylineSK(m->K, C, nC); /* The minima go to the start of C */
+    point *R = malloc((0 < nM ? nM : 1)*sizeof(point));
+    for(int k = 0; k < nM; k++)
+      R[k] = &C[k*dim];
+
+    if(0 < nM){
+      growPF(m);
+      freeORT(m->PF[r+1]);
+      if(m->grow){ /* Insert only trees */
+	m->PF[r+1] = allocORTGrow(dim);
+	for(int k = 0; k < nM; k++)
+	  insert(m->PF[r+1], R[k]);
       } else
-	free(p);
+	m->PF[r+1] = buildORT(dim, R, nM);
+      for(int k = 0; NULL != m->feed && k < nM; k++)
+	m->feed(m->feedArg, r+1, R[k], dim, 1);
+      m->lambda++;
+      if(0 < m->beam){ /* The next layer only uses the kept points */
+	int nE;
+	point *E = evictWorst(m->PF[r+1], m->beam, m->score, &nE);
+	m->evicted += nE;
+	frontRemoved(m, r+1, E, nE);
+	for(int k = 0; k < nE; k++)
+	  free(E[k]);
+	free(E);
+      }
     }
-  } else {
-    pointHash H = allocPH(dim); /* Register of considered points */
+    free(R);
+    free(C);
 
-    for(int i = 0; i < dim; i++){
-      int h = baseBot[i];
-      baseBot[i] = baseTop[i]; /* Set one coordinate to Top. */
-      /* slice : Part of the previous frontier */
-      int n; /* slice size */
-      /* point *slice = dominatedCollect(m->PF[r-1], baseBot, &n); */
-      point *slice = rangeCollect(m->PF[r-1], pprev, baseBot, &n);
+    if(0 == nM)
+      break;
+  }
+}
 
-      for(int k = 0; k < n; k++){
-	if(!containsPH(H, slice[k])){
-	  insertPH(H, slice[k]);
-
-	  point p = malloc(dim*sizeof(int));
-	  for(int l = 0; l < dim; l++)
-	    p[l] = stringCeil(m->S[l], c, slice[k][l]+1);
-
-	  /* First check All equal */
-	  int insertQ = 1;
-	  for(int l = 0; insertQ && l < dim; l++)
-	    insertQ = baseTop[l] == p[l];
-
-	  /* Then check forward move */
-	  insertQ = !insertQ;
-	  /* for(int l = 0; insertQ && l  < dim; l++) */
-	  /*   insertQ = baseTop[l] <= p[l]; */
-
-	  /* Now check Non-dominated */
-	  plusPlus(p, dim);
-	  insertQ = insertQ && (1 == countQ(m->PF[r], p));
-	  minusMinus(p, dim);
-	  /* insertQ = insertQ && !containsQ(m->PF[r], p); */
-
-	  if(insertQ){
-
-	  /*   if(3 == r && */
-	  /*      10 == p[0] && */
-	  /*      8 == p[1] && */
-	  /*      7 == p[2] && */
-	  /*      7 == p[3] */
-	  /*      ) gdbBreak(); */
-
-	    insert(m->PF[r], p);
-	    pushPQ(M, p);
-	    insertPH(CleanM, p);
-	    /* printf("MIN REMOVAL >>>>>> Pushed %d %d\n", p[0], p[1]); */
-	  } else
-	    free(p);
-	} else
-	  free(slice[k]);
-      }
-      if(NULL != slice)
-	free(slice);
-      baseBot[i] = h;
-    }
+/* Computes the fronts again from the current strings, including the
+   pending edits of lazy mode, with the bulk sweep of buildFronts.
+   Lazy mode must be off. A pop repair of
+   budget mode is dropped, its letter is still one of the pending pops
+   and the rebuild removes it. */
+static void
+rebuildMLCS(mlcs m
+	    )
+{
+  int dim = m->dim;
+  char *W[dim]; /* The current strings */
+  int n[dim];
+  int indexed = NULL != m->X; /* Cheaper to index the new fronts */
 
-    freePH(H); /* Frees all the points involved */
+  if(NULL != m->job){
+    freeRepair(m->job);
+    m->job = NULL;
+  }
+  cancelRebase(m); /* The positions change */
+  indexMLCS(m, 0);
+
+  for(int j = 0; j < dim; j++){
+    string S = m->S[j] = stringOwn(m->S[j]);
+    string P = m->P[j] = stringOwn(m->P[j]);
+    n[j] = stringSize(S) - m->pops[j] + stringSize(P);
+    W[j] = malloc((n[j]+1)*sizeof(char));
+
+    int k = 0;
+    for(int i = stringBegin(S)+m->pops[j]; i < stringEnd(S); i++)
+      W[j][k++] = stringLetter(S, i);
+    for(int i = stringBegin(P); i < stringEnd(P); i++)
+      W[j][k++] = stringLetter(P, i);
+
+    stringPopMany(S, stringSize(S));
+    stringPopMany(P, stringSize(P));
+    m->pops[j] = 0;
+  }
+
+  for(int r = 1; r < m->pfA; r++) /* Even a broken repair above */
+    if(NULL != m->PF[r])
+      freeFront(m, r);
+  m->lambda = 0;
+  m->zeros = 0;
+  for(int j = 0; j < dim; j++){
+    for(int k = 0; k < n[j]; k++)
+      stringAppend(m->S[j], W[j][k]);
+    if(0 == n[j])
+      m->zeros++;
   }
+  buildFronts(m);
+
+  for(int j = 0; j < dim; j++)
+    free(W[j]);
+  indexMLCS(m, indexed);
 }
 
+/* Deletes the points of layer r that q covers, except q itself. */
 static void
-cleanCovered(pointQueue M,
-	     int dim,
-	     ort t,
-	     point p
-	     )
+removeCovered(mlcs m,
+	      int r, /* Which layer */
+	      point q
+	      )
 {
-  while(!isEmptyPQ(M)){
-    memcpy(p, topPQ(M), dim*sizeof(int));
-    /* printf("CLEAN REMOVAL >>>>>> Pushed %d %d\n", p[0], p[1]); */
-    plusPlus(p, dim);
-    if(1 < countQ(t, p))
-      delete(t, topPQ(M));
-    popPQ(M);
+  int n;
+  int dim = m->dim;
+
+  minusMinus(q, dim);
+  point *T = collect(m->PF[r], q, &n);
+  plusPlus(q, dim);
+  for(int k = 0; k < n; k++){
+    if(!pointEquals(T[k], q, dim))
+      frontDelete(m, r, T[k]);
+    free(T[k]);
   }
+  free(T);
 }
 
-/* Remove the first letter of a given string. */
-void
-pop(mlcs m, /* The MLCS data struct */
-    int j  /* Which string */
-    )
+/* Highest layer with a point strictly below x. A point of PF[r] below
+   x has a point of PF[r-1] below it, so the layers that have one form
+   an interval that starts at 0. */
+static int
+prefixSearch(mlcs m, /* The MLCS data struct */
+	     point x, /* The corner */
+	     int lo, /* Known lower bound */
+	     int hi /* Known upper bound plus 1 */
+	     )
 {
-  string S = m->S[j];
-  if(1 == stringSize(S))
-    m->zeros++;
+  int A[m->dim];
+  point p = A;
 
-  if(0 < m->lambda){
-    int dim = m->dim;
-    int n ;
-    point *T = NULL;
+  /* PF[lo] has a point below x, PF[hi] has none */
+  while(lo+1 < hi){
+    int r = (lo+hi)/2;
+    if(dominatedFind(m->PF[r], x, p))
+      lo = r;
+    else
+      hi = r;
+  }
 
-    /* Secondary point queue for cleanning non minima */
-    pointQueue M = allocPQ();
-    expandPQ(M, stringSigma(S));
-    /* Hash to store points for cleaning */
-    pointHash CleanM = allocPH(dim);
+  return lo;
+}
 
-    /* The main Queue of the algorithm */
-    pointQueue Q = allocPQ();
+/* Corner just above the ends of the prefixes */
+static void
+prefixCorner(mlcs m, /* The MLCS data struct */
+	     int *q, /* Last position of each prefix */
+	     point x /* Gets the corner */
+	     )
+{
+  for(int i = 0; i < m->dim; i++){
+    assert(-1 <= q[i] && q[i] < stringSize(m->S[i]) &&
+	   "Prefix position out of the string.");
+    x[i] = stringBegin(m->S[i])+q[i]+1;
+  }
+}
 
-    point p = malloc(dim*sizeof(int));
-    /* Which letter are you removing ? */
-    char c = stringFstLetter(S);
-    int valid = 1;
-    for(int i = 0; valid && i < dim; i++){
-      p[i] = stringCeil(m->S[i], c, 0);
-      valid = 0 <= p[i];
-    }
-    if(valid){
-      pushPQ(Q, p);
-      markPQ(Q);
-      p = malloc(dim*sizeof(int));
+/* One layer of trimFronts. V has the nV points removed from layer
+   r-1, they are freed and V gets the points removed from layer r.
+   Returns the work, the points it looked at. */
+static long
+trimLayer(mlcs m,
+	  int r, /* Which layer */
+	  point **V,
+	  int *nV
+	  )
+{
+  int A[m->dim];
+  point p = A;
+  long work = 1;
+  int nU = 0;
+  point *U = NULL; /* Points removed from this front */
+
+  for(int l = 0; l < *nV; l++){
+    int n;
+    point *T = collect(m->PF[r], (*V)[l], &n);
+    work += n;
+    U = realloc(U, (nU+n)*sizeof(point));
+    for(int k = 0; k < n; k++){
+      if(containsQ(m->PF[r], T[k]) &&
+	 !dominatedFind(m->PF[r-1], T[k], p)){
+	frontDelete(m, r, T[k]);
+	U[nU++] = T[k];
+      } else
+	free(T[k]);
+    }
+    free(T);
+    free((*V)[l]);
+  }
+  free(*V);
+
+  if(m->beam < weightORT(m->PF[r])){
+    int nE;
+    work += weightORT(m->PF[r]);
+    point *E = evictWorst(m->PF[r], m->beam, m->score, &nE);
+    m->evicted += nE;
+    frontRemoved(m, r, E, nE);
+    if(0 < nE){
+      U = realloc(U, (nU+nE)*sizeof(point));
+      memcpy(&U[nU], E, nE*sizeof(point));
+      nU += nE;
+      free(E);
     }
-    int r = 1;
-    /* Queue Load Complete */
+  }
+  *V = U;
+  *nV = nU;
 
-    while(!isEmptyPQ(Q)){ /* There is stuff in the queue. */
-      if(markingTruePQ(Q)){ /* Frontier transition. */
-	cleanCovered(M, dim, m->PF[r], p);
-        r++; /* Update the pareto index */
-        markPQ(Q);
-      }
+  return work;
+}
 
-      /* 0. Uncover hidden points. */
-      memcpy(p, topPQ(Q), dim*sizeof(int));
-      char c = stringLetter(S, p[j]);
+/* Ends trimFronts, frees the points V removed from the top layer */
+static void
+trimEnd(mlcs m,
+	point *V,
+	int nV
+	)
+{
+  for(int l = 0; l < nV; l++)
+    free(V[l]);
+  free(V);
 
-      /* Point with large indexes */
-      int *plI = malloc(dim*sizeof(int));
-      /* previous positions of p */
-      int *pprev = malloc(dim*sizeof(int));
-      for(int i = 0; i < dim; i++){
-        plI[i] = stringLast(m->S[i], c);
-	pprev[i] = stringFloor(m->S[i], c, p[i]-1);
+  while(0 < m->lambda && 0 == weightORT(m->PF[m->lambda]))
+    m->lambda--;
+}
+
+/* Approximate mode. Fronts over the beam size lose their worst
+   points, the points above them that are left without a point below
+   are removed as well. */
+static void
+trimFronts(mlcs m
+	   )
+{
+  if(0 == m->beam)
+    return;
+
+  int nV = 0;
+  point *V = NULL; /* Points removed from the front below */
+
+  for(int r = 1; r <= m->lambda; r++)
+    trimLayer(m, r, &V, &nV);
+  trimEnd(m, V, nV);
+}
+
+/* Adds to the candidates the successor of q by letter c, unless it
+   does not exist or it is dominated by a point of the front pf. */
+static void
+succCandidate(mlcs m,
+	      ort pf,    /* The front that gets the successor */
+	      point q,   /* The point in the previous front */
+	      char c,    /* Which letter */
+	      point p    /* Memory for the successor */
+	      )
+{
+  int dim = m->dim;
+  int valid = 1;
+
+  for(int i = 0; valid && i < dim; i++){
+    p[i] = stringCeil(m->S[i], c, q[i]+1);
+    valid = -2 != p[i];
+  }
+
+  if(valid){
+    /* Check to see if it is dominated on the PF */
+    plusPlus(p, dim);
+    valid = 0 == countQ(pf, p);
+    minusMinus(p, dim);
+    if(valid) /* Duplicates are dropped with the covered ones */
+      addSK(m->K, p);
+  }
+}
+
+/* Inserts the minima of the candidates into layer r. If Q is not
+   NULL it gets copies of the inserted points. The candidates are left
+   with the minima. */
+static void
+insertMinima(mlcs m,
+	     int r, /* Which layer */
+	     pointQueue Q
+	     )
+{
+  int dim = m->dim;
+  int n = minimaSK(m->K);
+
+  for(int k = 0; k < n; k++){
+    frontInsert(m, r, pointSK(m->K, k));
+    if(NULL != Q){
+      point q = malloc(dim*sizeof(int));
+      memcpy(q, pointSK(m->K, k), dim*sizeof(int));
+      pushPQ(Q, q);
+    }
+  }
+}
+
+/* Checks if a point of layer r covers p, and stores it in h. With
+   the index it looks for a point of a layer at least r, which is the
+   same when the layers above r are valid fronts, since every point
+   there covers one of layer r. */
+static int
+frontCovers(mlcs m,
+	    int r, /* Which layer */
+	    point p,
+	    point h,
+	    int indexed /* Use the cross layer index */
+	    )
+{
+  if(!indexed)
+    return dominatedFind(m->PF[r], p, h);
+
+  int Q[m->dim+1];
+  point q = Q;
+  int H[m->dim+1];
+  memcpy(q, p, m->dim*sizeof(int));
+  q[m->dim] = 1-r;
+  int found = dominatedFind(m->X, q, H);
+  memcpy(h, H, m->dim*sizeof(int));
+
+  return found;
+}
+
+/* Adds to layer r the points that appending letter c to string j, at
+   position e, creates from the n points T of layer r-1. Frees the
+   points but not T. */
+static void
+appendPoints(mlcs m, /* The MLCS data struct */
+	     int j,  /* Which string */
+	     char c, /* Which letter */
+	     int e,  /* Position of the letter */
+	     int r,  /* Which layer */
+	     point *T, /* Points of layer r-1 */
+	     int n,
+	     point p,  /* Memory for candidates */
+	     int indexed /* Use the cross layer index */
+	     )
+{
+  int dim = m->dim;
+  int H[dim];
+  point h = H; /* Gets a point that covers the candidate */
+
+  if(0 < n){
+    clearSK(m->K);
+    for(int k = 0; k < n; k++){ /* Process points */
+      int excludeP = 0;
+      for(int i = 0; !excludeP && i < dim; i++){
+	p[i] = stringCeil(m->S[i], c, T[k][i]+1);
+	if(i == j){
+	  p[i] = e;
+	  excludeP = T[k][i] == p[i];
+	} else
+	  excludeP = -2 == p[i];
+      }
+
+      free(T[k]);
+      if(!excludeP){
+	/* Check to see if it is dominated on the PF */
+	plusPlus(p, dim);
+	excludeP = frontCovers(m, r, p, h, indexed);
+	minusMinus(p, dim);
+	if(!excludeP) /* Duplicates are dropped with the covered ones */
+	  addSK(m->K, p);
+      }
+    }
+
+    insertMinima(m, r, NULL);
+  }
+}
+
+/* Adds to layer r the points that appending letter c to string j, at
+   position e, creates from the points of layer r-1 inside the box
+   [z, f). Layer r-1 must already be up to date. Returns the number of
+   points of layer r-1 it looked at. */
+static int
+appendLayer(mlcs m, /* The MLCS data struct */
+	    int j,  /* Which string */
+	    char c, /* Which letter */
+	    int e,  /* Position of the letter */
+	    int r,  /* Which layer */
+	    point z, /* Lower point */
+	    point f, /* further right point */
+	    point p  /* Memory for candidates */
+	    )
+{
+  int n;
+  point *T = rangeCollect(m->PF[r-1], z, f, &n);
+
+  appendPoints(m, j, c, e, r, T, n, p, 0);
+  free(T);
+
+  return n;
+}
+
+/* Same as appendLayer for the layers 1 to top, with one query on the
+   cross layer index for the box [z, f) of all the layers below top.
+   The new points use the end of string j, so they are outside the
+   box and the query sees the same points as the queries per layer. */
+static void
+appendLayers(mlcs m, /* The MLCS data struct */
+	     int j,  /* Which string */
+	     char c, /* Which letter */
+	     int e,  /* Position of the letter */
+	     int top, /* Highest layer */
+	     point z, /* Lower point */
+	     point f, /* further right point */
+	     point p  /* Memory for candidates */
+	     )
+{
+  int dim = m->dim;
+  int n;
+  int lo[dim+1];
+  int hi[dim+1];
+
+  memcpy(lo, z, dim*sizeof(int));
+  memcpy(hi, f, dim*sizeof(int));
+  lo[dim] = 1-top; /* Layers 0 to top-1 */
+  hi[dim] = 1;
+  point *T = rangeCollect(m->X, lo, hi, &n);
+
+  /* Group the points by layer, layer r starts at G[C[r]] */
+  int C[top+1];
+  int W[top]; /* Where the next point of each layer goes */
+  for(int r = 0; r <= top; r++)
+    C[r] = 0;
+  for(int k = 0; k < n; k++)
+    C[1-T[k][dim]]++;
+  for(int r = 1; r <= top; r++)
+    C[r] += C[r-1];
+  memcpy(W, C, top*sizeof(int));
+  point *G = malloc((0 < n ? n : 1)*sizeof(point));
+  for(int k = 0; k < n; k++)
+    G[W[-T[k][dim]]++] = T[k];
+  free(T);
+
+  for(int r = 1; r <= top; r++)
+    appendPoints(m, j, c, e, r, &G[C[r-1]], C[r]-C[r-1], p, 1);
+  free(G);
+}
+
+/* Starts the append of letter c to string j, as a sweep of the layers
+   1 to top, see appendStep. The letter goes to the string at once. */
+static sweep
+appendStart(mlcs m, /* The MLCS data struct */
+	    int j,  /* Which string */
+	    char c  /* Which letter */
+	    )
+{
+  sweep W = calloc(1, sizeof(struct sweep));
+  string S = m->S[j] = stringOwn(m->S[j]);
+
+  W->c = c;
+  W->r = 1;
+  W->e = stringEnd(S);
+  if(0 == stringSize(S))
+    m->zeros--; /* Another string gets a size */
+
+  if(0 == m->zeros){
+    growPF(m);
+
+    int dim = m->dim;
+    /* candidate point */
+    W->p = malloc(dim*sizeof(int));
+    /* Lower point */
+    point z = W->z = malloc(dim*sizeof(int));
+    /* further right point */
+    point f = W->f = malloc(dim*sizeof(int));
+    for(int i = 0; i < dim; i++){
+      z[i] = -1;
+      f[i] = stringLast(m->S[i], c);
+    }
+    z[j] = stringLast(m->S[j], c);
+    f[j] = stringEnd(m->S[j]);
+
+    /* Highest front that can change */
+    int top = m->lambda < m->cap ? m->lambda+1 : m->lambda;
+    /* New points use the new position of string j, so they have no
+       successor by c. Only the old points strictly below f feed the
+       next layer and, as in a prefix query, their layers start at 0. */
+    int last = prefixSearch(m, f, 0, m->lambda+1);
+    if(last+1 < top)
+      top = last+1;
+    W->top = top;
+  }
+
+  stringAppend(S, c);
+
+  return W;
+}
+
+/* Adds the points of the append W to its next layer. Returns the
+   work, the points of the layer below it looked at. */
+static long
+appendStep(mlcs m, /* The MLCS data struct */
+	   int j,  /* Which string */
+	   sweep W
+	   )
+{
+  int r = W->r++;
+
+  return 1+appendLayer(m, j, W->c, W->e, r, W->z, W->f, W->p);
+}
+
+/* Ends the append W, once every layer has its points */
+static void
+appendEnd(mlcs m, /* The MLCS data struct */
+	  sweep W
+	  )
+{
+  if(m->lambda < W->top && 0 < weightORT(m->PF[W->top]))
+    m->lambda++;
+}
+
+void
+append(mlcs m, /* The MLCS data struct */
+       int j,  /* Which string */
+       char c  /* Which letter */
+       )
+{
+  if(m->lazy){
+    lazyAppend(m, j, &c, 1);
+    paceMLCS(m, m->budget);
+    return;
+  }
+
+  sweep W = appendStart(m, j, c);
+  if(NULL == m->X)
+    while(W->r <= W->top)
+      appendStep(m, j, W);
+  else if(0 < W->top)
+    appendLayers(m, j, c, W->e, W->top, W->z, W->f, W->p);
+  appendEnd(m, W);
+  freeSweep(W);
+
+  trimFronts(m);
+
+#ifndef NDEBUG
+  printMLCS(m);
+  checkMLCS(m);
+#endif /* NDEBUG */
+}
+
+/* Append the letters s[0..len-1] to string j. Produces the same fronts
+   as len calls to append, but sweeps the layers only once. */
+void
+appendRun(mlcs m, /* The MLCS data struct */
+	  int j,  /* Which string */
+	  const char *s, /* The letters */
+	  int len /* Number of letters */
+	  )
+{
+  if(m->lazy){
+    lazyAppend(m, j, s, len);
+    paceMLCS(m, m->budget);
+    return;
+  }
+
+  string S = m->S[j] = stringOwn(m->S[j]);
+  if(0 < len && 0 == stringSize(S))
+    m->zeros--; /* Another string gets a size */
+
+  int sigma = stringSigma(S);
+  /* Last occ of each letter, before the run */
+  int lastOld[sigma];
+  /* Letters that occur in the run */
+  char L[sigma];
+  int nL = 0;
+
+  for(int k = 0; k < sigma; k++)
+    lastOld[k] = -3; /* Letter not in run */
+  for(int k = 0; k < len; k++){
+    if(-3 == lastOld[s[k]-'A']){
+      lastOld[s[k]-'A'] = stringLast(S, s[k]);
+      L[nL++] = s[k];
+    }
+  }
+
+  for(int k = 0; k < len; k++)
+    stringAppend(S, s[k]);
+
+  if(0 < len && 0 == m->zeros){
+    int dim = m->dim;
+    /* candidate point */
+    point p = malloc(dim*sizeof(int));
+    /* Lower point */
+    point z = malloc(dim*sizeof(int));
+    /* further right point */
+    point f = malloc(dim*sizeof(int));
+    /* Corner above the boxes of all the letters */
+    point g = malloc(dim*sizeof(int));
+    for(int i = 0; i < dim; i++){
+      g[i] = -1;
+      for(int l = 0; l < nL; l++)
+	if(g[i] < stringLast(m->S[i], L[l]))
+	  g[i] = stringLast(m->S[i], L[l]);
+    }
+    g[j] = stringEnd(S);
+
+    /* lambda grows inside the cycle, as layers get points. Once a layer
+       has no point below g neither do the ones above it. */
+    for(int r = 0; r <= m->lambda && r < m->cap &&
+	  dominatedFind(m->PF[r], g, p); r++){
+      growPF(m);
+      clearSK(m->K);
+
+      for(int l = 0; l < nL; l++){
+	char c = L[l];
+	for(int i = 0; i < dim; i++){
+	  z[i] = -1;
+	  f[i] = stringLast(m->S[i], c);
+	}
+	/* Only points after the last old c change */
+	z[j] = lastOld[c-'A'];
+	f[j] = stringEnd(S);
+
+	int n;
+	point *T = rangeCollect(m->PF[r], z, f, &n);
+	for(int k = 0; k < n; k++){ /* Process points */
+	  succCandidate(m, m->PF[r+1], T[k], c, p);
+	  free(T[k]);
+	}
+	if(NULL != T)
+	  free(T);
+      }
+
+      insertMinima(m, r+1, NULL);
+
+      if(r == m->lambda && 0 < weightORT(m->PF[r+1]))
+	m->lambda++;
+    }
+
+    free(g);
+    free(f);
+    free(z);
+    free(p);
+  }
+
+  trimFronts(m);
+
+#ifndef NDEBUG
+  printMLCS(m);
+  checkMLCS(m);
+#endif /* NDEBUG */
+}
+
+/* Append letters[i] to string i, for every string. New points always
+   use one of the new positions, therefore they have no successors and
+   only the old points feed the next layer. */
+void
+appendColumn(mlcs m, /* The MLCS data struct */
+	     const char *letters /* One letter per string */
+	     )
+{
+  int dim = m->dim;
+  if(m->lazy){
+    for(int i = 0; i < dim; i++)
+      lazyAppend(m, i, &letters[i], 1);
+    paceMLCS(m, m->budget);
+    return;
+  }
+
+  /* Last occ of letters[i] in string i, before the append */
+  int lastOld[dim];
+
+  for(int i = 0; i < dim; i++){
+    m->S[i] = stringOwn(m->S[i]);
+    lastOld[i] = stringLast(m->S[i], letters[i]);
+    if(0 == stringSize(m->S[i]))
+      m->zeros--; /* Another string gets a size */
+    stringAppend(m->S[i], letters[i]);
+  }
+
+  /* candidate point */
+  point p = malloc(dim*sizeof(int));
+  /* Lower point */
+  point z = malloc(dim*sizeof(int));
+  /* further right point */
+  point f = malloc(dim*sizeof(int));
+
+  /* Corner above the boxes of all the letters. New points use new
+     positions, so the layers that feed others start at 0. */
+  for(int l = 0; l < dim; l++){
+    f[l] = -1;
+    for(int i = 0; i < dim; i++)
+      if(f[l] < stringLast(m->S[l], letters[i]))
+	f[l] = stringLast(m->S[l], letters[i]);
+  }
+  int last = prefixSearch(m, f, 0, m->lambda+1);
+
+  /* lambda grows inside the cycle, as layers get points. */
+  for(int r = 0; r <= m->lambda && r < m->cap && r <= last; r++){
+    growPF(m);
+    clearSK(m->K);
+
+    for(int i = 0; i < dim; i++){
+      char c = letters[i];
+      int first = 1; /* Is this the first string with c */
+      for(int l = 0; first && l < i; l++)
+	first = c != letters[l];
+
+      if(first){
+	/* The strings where c got appended split the points whose
+	   successor by c changed into disjoint boxes. */
+	for(int l = 0; l < dim; l++){
+	  z[l] = -1;
+	  f[l] = stringLast(m->S[l], c);
+	}
+	for(int l = i; l < dim; l++){
+	  if(c == letters[l]){
+	    z[l] = lastOld[l];
+	    int n;
+	    point *T = rangeCollect(m->PF[r], z, f, &n);
+	    for(int k = 0; k < n; k++){ /* Process points */
+	      succCandidate(m, m->PF[r+1], T[k], c, p);
+	      free(T[k]);
+	    }
+	    if(NULL != T)
+	      free(T);
+	    /* Next boxes exclude this one */
+	    z[l] = -1;
+	    f[l] = lastOld[l];
+	  }
+	}
+      }
+    }
+
+    insertMinima(m, r+1, NULL);
+
+    if(r == m->lambda && 0 < weightORT(m->PF[r+1]))
+      m->lambda++;
+  }
+
+  free(f);
+  free(z);
+  free(p);
+
+  trimFronts(m);
+
+#ifndef NDEBUG
+  printMLCS(m);
+  checkMLCS(m);
+#endif /* NDEBUG */
+}
+
+/* Builds the fronts of whole strings in one sweep over the layers,
+   see buildFronts, without appending letter by letter. */
+mlcs
+buildMLCS(int dim, /* The number of strings. */
+	  int sigma, /* Alphabet size */
+	  char **S /* The strings */
+	  )
+{
+  mlcs m = allocMLCS(dim, sigma);
+
+  for(int j = 0; j < dim; j++){
+    if('\0' != S[j][0])
+      m->zeros--;
+    for(int k = 0; '\0' != S[j][k]; k++)
+      stringAppend(m->S[j], S[j][k]);
+  }
+  buildFronts(m);
+
+#ifndef NDEBUG
+  printMLCS(m);
+  checkMLCS(m);
+#endif /* NDEBUG */
+
+  return m;
+}
+
+/* Starts the removal of the first k letters of string j, as a sweep
+   over the layers, see popLayer. The letters leave the string at
+   once. Layer r is fixed from the points that were removed from, and
+   added to, layer r-1. The sweep stops at the first layer that does
+   not change. */
+static sweep
+popStart(mlcs m, /* The MLCS data struct */
+	 int j,  /* Which string */
+	 int k   /* Number of letters */
+	 )
+{
+  int dim = m->dim;
+  sweep W = calloc(1, sizeof(struct sweep));
+  string S = m->S[j] = stringOwn(m->S[j]);
+  assert(k <= stringSize(S) && "Popping more letters than the string has.");
+  if(0 < k && k == stringSize(S))
+    m->zeros++;
+
+  stringPopMany(S, k); /* Remove the letters */
+
+  W->r = 1;
+  /* candidate point */
+  W->p = malloc(dim*sizeof(int));
+  /* Range limits */
+  W->lo = malloc(dim*sizeof(int));
+  W->hi = malloc(dim*sizeof(int));
+
+  /* Points removed from the current and previous layers */
+  W->Ra = 1;
+  W->R = malloc(W->Ra*sizeof(point));
+  W->Rp = malloc(W->Ra*sizeof(point));
+  W->H = allocPH(dim);
+  W->Hp = allocPH(dim);
+
+  /* Points added to the previous layer */
+  W->A = allocPQ();
+  if(0 < k && 0 < m->lambda){
+    /* The origin is the only point of layer 0 */
+    point o = malloc(dim*sizeof(int));
+    for(int i = 0; i < dim; i++)
+      o[i] = -1;
+    pushPQ(W->A, o);
+  }
+
+  return W;
+}
+
+/* The pops W still change the next layer */
+static int
+popMore(mlcs m, /* The MLCS data struct */
+	sweep W
+	)
+{
+  return W->r <= m->lambda && (0 < W->nRp || !isEmptyPQ(W->A));
+}
+
+/* Fixes the next layer for the pops W of string j. Returns the work,
+   the points it collected. */
+static long
+popLayer(mlcs m, /* The MLCS data struct */
+	 int j,  /* Which string */
+	 sweep W
+	 )
+{
+  int dim = m->dim;
+  string S = m->S[j];
+  int sigma = stringSigma(S);
+  int r = W->r++;
+  point p = W->p;
+  point lo = W->lo;
+  point hi = W->hi;
+  pointQueue A = W->A;
+  long work = 1;
+  int n;
+  point *T;
+
+  /* 1. Find the points of layer r that are no longer valid */
+  if(1 == r){ /* Points that use the removed letters */
+    for(int i = 0; i < dim; i++){
+      lo[i] = -1;
+      hi[i] = stringEnd(m->S[i]);
+    }
+    hi[j] = stringBegin(S);
+    T = rangeCollect(m->PF[r], lo, hi, &n);
+  } else { /* Points that lost their justification */
+    n = 0;
+    T = NULL;
+    for(int l = 0; l < W->nRp; l++){
+      int nT;
+      point *U = collect(m->PF[r], W->Rp[l], &nT);
+      work += nT;
+      T = realloc(T, (n+nT)*sizeof(point));
+      for(int t = 0; t < nT; t++){
+	if(!containsPH(W->H, U[t]) &&
+	   0 == countQ(m->PF[r-1], U[t])){
+	  insertPH(W->H, U[t]);
+	  T[n++] = U[t];
+	} else
+	  free(U[t]);
+      }
+      free(U);
+    }
+  }
+
+  /* 2. Remove them */
+  W->nR = 0;
+  for(int l = 0; l < n; l++){
+    if(1 == r)
+      insertPH(W->H, T[l]);
+    if(W->nR == W->Ra){
+      W->Ra *= 2;
+      W->R = realloc(W->R, W->Ra*sizeof(point));
+      W->Rp = realloc(W->Rp, W->Ra*sizeof(point));
+    }
+    W->R[W->nR++] = T[l];
+    frontDelete(m, r, T[l]);
+  }
+  if(NULL != T)
+    free(T);
+  work += n;
+
+  clearSK(m->K);
+
+  /* 3. Successors of the points added to layer r-1 */
+  while(!isEmptyPQ(A)){
+    if(0 < m->beam) /* Evicted points come back and cover others */
+      removeCovered(m, r-1, topPQ(A));
+    char c = 'A';
+    for(int l = 0; l < sigma; l++, c++)
+      succCandidate(m, m->PF[r], topPQ(A), c, p);
+    free(topPQ(A));
+    popPQ(A);
+    work++;
+  }
+
+  /* 4. Points that were hidden by the removed points */
+  for(int l = 0; l < W->nR; l++){
+    point q = W->R[l];
+    char c = 'A';
+    for(int t = 0; t < sigma; t++, c++){
+      int valid = 1;
+      for(int i = 0; valid && i < dim; i++){
+	/* Successors by c that land above q */
+	lo[i] = stringFloor(m->S[i], c, q[i]-1);
+	hi[i] = stringLast(m->S[i], c);
+	valid = -2 != hi[i];
+      }
+      if(valid){
+	int nT;
+	point *U = rangeCollect(m->PF[r-1], lo, hi, &nT);
+	work += nT;
+	for(int u = 0; u < nT; u++){
+	  succCandidate(m, m->PF[r], U[u], c, p);
+	  free(U[u]);
+	}
+	if(NULL != U)
+	  free(U);
+      }
+    }
+  }
+
+  insertMinima(m, r, A);
+
+  if(0 < m->beam){
+    /* Approximate mode evicts during the sweep, otherwise the
+       fronts above grow back to their exact size. */
+    int nV;
+    work += weightORT(m->PF[r]);
+    point *V = evictWorst(m->PF[r], m->beam, m->score, &nV);
+    m->evicted += nV;
+    frontRemoved(m, r, V, nV);
+    for(int l = 0; l < nV; l++){
+      if(findSK(m->K, V[l])) /* Leaves A below */
+	free(V[l]);
+      else { /* Old point, same as a removed one */
+	insertPH(W->H, V[l]);
+	if(W->nR == W->Ra){
+	  W->Ra *= 2;
+	  W->R = realloc(W->R, W->Ra*sizeof(point));
+	  W->Rp = realloc(W->Rp, W->Ra*sizeof(point));
+	}
+	W->R[W->nR++] = V[l];
+      }
+    }
+    if(NULL != V)
+      free(V);
+
+    pointQueue K = allocPQ(); /* The points of A that are left */
+    while(0 < nV && !isEmptyPQ(A)){
+      if(containsQ(m->PF[r], topPQ(A)))
+	pushPQ(K, topPQ(A));
+      else
+	free(topPQ(A));
+      popPQ(A);
+    }
+    while(!isEmptyPQ(K)){
+      pushPQ(A, topPQ(K));
+      popPQ(K);
+    }
+    freePQ(K);
+  }
+
+  /* Current layer becomes the previous */
+  point *tR = W->Rp;
+  W->Rp = W->R;
+  W->R = tR;
+  W->nRp = W->nR;
+  W->nR = 0;
+  pointHash tH = W->Hp;
+  W->Hp = W->H;
+  W->H = tH;
+  freePH(W->H);
+  W->H = allocPH(dim);
+
+  return work;
+}
+
+/* Ends the pops W, once no layer changes. The fronts above the new
+   top are dropped. Returns the work, the points left in A. */
+static long
+popEnd(mlcs m, /* The MLCS data struct */
+       sweep W
+       )
+{
+  long work = 1;
+
+  while(!isEmptyPQ(W->A)){ /* Points added to the top layer */
+    if(0 < m->beam)
+      removeCovered(m, m->lambda, topPQ(W->A));
+    free(topPQ(W->A));
+    popPQ(W->A);
+    work++;
+  }
+
+  while(0 < m->lambda && 0 == weightORT(m->PF[m->lambda]))
+    m->lambda--;
+
+  return work;
+}
+
+#ifndef NDEBUG
+static void
+gdbBreak(void) {}
+#endif /* NDEBUG */
+
+/* Returns the number of points of layer r-1 it looked at */
+static int
+uncover(pointQueue M, /* For removing non-minima, owns the points */
+	mlcs m,
+	char c,
+	int r,
+	int j, /* Important only when 0 == r */
+	int *pprev, /* The point of previous pos */
+	int *baseTop, /* The point that is moving */
+	int *baseBot /* The far away point */
+	)
+{
+  int dim = m->dim;
+  int seen = 0;
+
+  if(1 == r){
+    if(baseBot[j] > baseTop[j]){
+      point p = malloc(dim*sizeof(int));
+      memcpy(p, baseTop, dim*sizeof(int));
+
+      p[j] = stringCeil(m->S[j], c, p[j]+1);
+
+      plusPlus(p, dim);
+      int insertQ = 1 == countQ(m->PF[r], p);
+      minusMinus(p, dim);
+
+      if(insertQ){
+	frontInsert(m, r, p);
+	pushPQ(M, p);
+	/* printf("MIN REMOVAL >>>>>> Pushed %d %d\n", p[0], p[1]); */
+      } else
+	free(p);
+    }
+  } else {
+    /* The slice is the part of the previous front in [pprev, baseBot)
+       that is below baseTop in some coordinate. It is the union of
+       the d boxes that clamp one coordinate to baseTop, each slice
+       point is seen once. */
+    int n; /* slice size */
+    point *slice = cornerCollect(m->PF[r-1], pprev, baseBot, baseTop, &n);
+    seen = n;
+    int Q[dim];
+    point q = Q; /* The candidate */
+
+    for(int k = 0; k < n; k++){
+      for(int l = 0; l < dim; l++)
+	q[l] = stringCeil(m->S[l], c, slice[k][l]+1);
+      free(slice[k]);
+
+      /* First check All equal */
+      int insertQ = 1;
+      for(int l = 0; insertQ && l < dim; l++)
+	insertQ = baseTop[l] == q[l];
+
+      /* Then check forward move */
+      insertQ = !insertQ;
+
+      /* Now check Non-dominated */
+      plusPlus(q, dim);
+      insertQ = insertQ && (1 == countQ(m->PF[r], q));
+      minusMinus(q, dim);
+
+      if(insertQ){
+	point p = malloc(dim*sizeof(int));
+	memcpy(p, q, dim*sizeof(int));
+	frontInsert(m, r, p);
+	pushPQ(M, p);
+	/* printf("MIN REMOVAL >>>>>> Pushed %d %d\n", p[0], p[1]); */
+      }
+    }
+    free(slice);
+  }
+
+  return seen;
+}
+
+static void
+cleanCovered(pointQueue M,
+	     mlcs m,
+	     int r, /* Which layer */
+	     point p
+	     )
+{
+  int dim = m->dim;
+
+  while(!isEmptyPQ(M)){
+    memcpy(p, topPQ(M), dim*sizeof(int));
+    /* printf("CLEAN REMOVAL >>>>>> Pushed %d %d\n", p[0], p[1]); */
+    plusPlus(p, dim);
+    if(1 < countQ(m->PF[r], p))
+      frontDelete(m, r, topPQ(M));
+    free(topPQ(M));
+    popPQ(M);
+  }
+}
+
+/* Starts the repair of the fronts for the removal of the first letter
+   of string j. */
+static repair
+repairStart(mlcs m, /* The MLCS data struct */
+	    int j,  /* Which string */
+	    long budget /* Work allowed */
+	    )
+{
+  string S = m->S[j];
+  int dim = m->dim;
+  repair R = malloc(sizeof(struct repair));
+
+  R->j = j;
+  R->budget = budget;
+  R->work = 0;
+  R->r = 1;
+  R->stop = 0;
+  R->W = NULL;
+
+  R->M = allocPQ();
+  expandPQ(R->M, stringSigma(S));
+  R->Q = allocPQ();
+
+  point p = R->p = malloc(dim*sizeof(int));
+  R->plI = malloc(dim*sizeof(int));
+  R->pprev = malloc(dim*sizeof(int));
+
+  /* Which letter are you removing ? */
+  char c = stringFstLetter(S);
+  int valid = 1;
+  for(int i = 0; valid && i < dim; i++){
+    p[i] = stringCeil(m->S[i], c, 0);
+    valid = 0 <= p[i];
+  }
+  if(valid){
+    pushPQ(R->Q, p);
+    markPQ(R->Q);
+    R->p = malloc(dim*sizeof(int));
+  }
+  /* Queue Load Complete */
+
+  return R;
+}
+
+/* Runs the sweep of job R, one layer at a time, until about limit
+   units of work more are done or the sweep is over. The work counts
+   the points that each layer looked at. Returns the work done. */
+static long
+sweepRun(mlcs m, /* The MLCS data struct */
+	 repair R,
+	 long limit /* Work for this run */
+	 )
+{
+  sweep W = R->W;
+  long work = 0;
+
+  while(!W->done && work < limit){
+    if(!W->trim && 0 != W->c && W->r <= W->top)
+      work += appendStep(m, R->j, W);
+    else if(!W->trim && 0 == W->c && popMore(m, W))
+      work += popLayer(m, R->j, W);
+    else if(!W->trim){
+      if(0 != W->c)
+	appendEnd(m, W);
+      else
+	work += popEnd(m, W);
+      W->trim = 1;
+      W->r = 1;
+    } else if(0 < m->beam && W->r <= m->lambda)
+      work += trimLayer(m, W->r++, &W->V, &W->nV);
+    else {
+      trimEnd(m, W->V, W->nV);
+      W->V = NULL;
+      W->nV = 0;
+      W->done = 1;
+    }
+  }
+  R->work += work;
+
+  return work;
+}
+
+/* Runs the repair until about limit units of work more are done, the
+   queue is empty or it gives up. The work counts the points that go
+   through the queue and the points collected above them. Once it
+   passes the budget, or the work per layer so far predicts that it
+   will, the repair gives up. The fronts are broken until the queue is
+   empty. Returns the work done. */
+static long
+repairRun(mlcs m, /* The MLCS data struct */
+	  repair R,
+	  long limit /* Work for this run */
+	  )
+{
+  if(NULL != R->W)
+    return sweepRun(m, R, limit);
+
+  long start = R->work;
+  int j = R->j;
+  string S = m->S[j];
+  int dim = m->dim;
+  int n ;
+  point *T = NULL;
+  pointQueue Q = R->Q;
+  pointQueue M = R->M;
+  point p = R->p;
+
+  /* There is stuff in the queue. */
+  while(!isEmptyPQ(Q) && !R->stop && R->work <= R->budget &&
+	R->work - start < limit){
+    if(markingTruePQ(Q)){ /* Frontier transition. */
+      cleanCovered(M, m, R->r, p);
+      R->r++; /* Update the pareto index */
+      markPQ(Q);
+      /* The layers so far predict the cost of the layers above */
+      if(R->budget < R->work + R->work/(R->r-1)*(m->lambda+1-R->r)){
+	R->stop = 1;
+	break;
+      }
+    }
+    int r = R->r;
+
+    /* 0. Uncover hidden points. */
+    memcpy(p, topPQ(Q), dim*sizeof(int));
+    char c = stringLetter(S, p[j]);
+
+    for(int i = 0; i < dim; i++){
+      R->plI[i] = stringLast(m->S[i], c);
+      R->pprev[i] = stringFloor(m->S[i], c, p[i]-1);
+    }
+    R->work += uncover(M, m, c, r, j, R->pprev, p, R->plI);
+
+    /* 1. Collect points that dominate current. */
+    n = 0;
+    if(r+1 < m->pfA && NULL != m->PF[r+1])
+      T = collect(m->PF[r+1], topPQ(Q), &n);
+    R->work += 1+n;
+
+    /* 2. remove the point. */
+    frontDelete(m, r, topPQ(Q));
+
+    /* 3. filter candidates */
+    for(int i = 0; i < n; i++){
+      if(0 == countQ(m->PF[r], T[i])){
+	pushPQ(Q, T[i]); /* Mark for deletion */
+	point q = malloc(dim*sizeof(int));
+	memcpy(q, T[i], dim*sizeof(int));
+	pushPQ(M, q); /* Verify non-minima later */
+	frontInsert(m, r, T[i]);
+      } else /* Free elements that do not go into Q */
+	free(T[i]);
+    }
+    if(NULL != T){
+      free(T);
+      T = NULL;
+    }
+
+    /* 4. process Q */
+    free(topPQ(Q));
+    popPQ(Q);
+  }
+
+  return R->work - start;
+}
+
+/* Ends the repair. Returns 1 if it finished, otherwise it gave up and
+   the fronts are left broken. The string itself is not changed. */
+static int
+repairEnd(mlcs m, /* The MLCS data struct */
+	  repair R
+	  )
+{
+  int done = isEmptyPQ(R->Q);
+  if(done)
+    cleanCovered(R->M, m, R->r, R->p);
+  freeRepair(R);
+
+  return done;
+}
+
+/* Repairs the fronts for the removal of the first letter of string j
+   in a single run. Once the work passes the budget the repair gives up
+   and returns 0, leaving the fronts broken. */
+static int
+popRepair(mlcs m, /* The MLCS data struct */
+	  int j,  /* Which string */
+	  long budget /* Work allowed */
+	  )
+{
+  repair R = repairStart(m, j, budget);
+  repairRun(m, R, LONG_MAX);
+
+  return repairEnd(m, R);
+}
+
+/* Estimates the work of rebuildMLCS, in the units of popRepair. On
+   random strings the bulk build costs about 4+sigma units per point of
+   the fronts, within a factor of 2 from 2 to 5 strings, plus one per
+   letter. */
+static long
+rebuildWork(mlcs m
+	    )
+{
+  double w = 0;
+  for(int j = 0; j < m->dim; j++)
+    w += stringSize(m->S[j]);
+  double c = 4 + stringSigma(m->S[0]);
+  for(int r = 1; r <= m->lambda; r++)
+    w += c*weightORT(m->PF[r]);
+
+  return SWITCH_COST*w;
+}
+
+/* Counts the decision of a pop and, when the repair gave up, builds
+   the fronts again from the strings, which are already changed. */
+static void
+switchRebuild(mlcs m,
+	      int repaired /* The repair finished */
+	      )
+{
+  if(repaired)
+    m->repairs++;
+  else {
+    m->rebuilds++;
+    rebuildMLCS(m);
+  }
+}
+
+/* Budget mode: the job in progress is over */
+static int
+repairOver(repair R
+	   )
+{
+  return NULL != R->W ? R->W->done : isEmptyPQ(R->Q);
+}
+
+/* Budget mode: the job in progress is done. After a repair string j
+   loses its first letter, a sweep already changed the string. */
+static void
+repairDone(mlcs m
+	   )
+{
+  repair R = m->job;
+  int j = R->j;
+
+  m->job = NULL;
+  if(NULL != R->W)
+    freeRepair(R);
+  else {
+    repairEnd(m, R);
+    if(0 == weightORT(m->PF[m->lambda]))
+      m->lambda--;
+    stringPop(m->S[j]); /* Remove the letter */
+    m->pops[j]--;
+    switchRebuild(m, 1);
+  }
+
+#ifndef NDEBUG
+  printMLCS(m);
+  checkMLCS(m);
+#endif /* NDEBUG */
+}
+
+/* Budget mode: finishes the repair in progress, if any */
+static void
+finishRepair(mlcs m
+	     )
+{
+  if(NULL != m->job){
+    repairRun(m, m->job, LONG_MAX);
+    repairDone(m);
+  }
+}
+
+/* Moves the positions of string i down by off[i], or up when it is
+   negative, and reports it to the change feed. The fronts must move
+   with them. */
+static void
+moveStrings(mlcs m,
+	    int *off /* The offsets */
+	    )
+{
+  for(int i = 0; i < m->dim; i++){
+    if(0 != off[i]){
+      m->S[i] = stringOwn(m->S[i]);
+      stringRebase(m->S[i], off[i]);
+    }
+  }
+  if(NULL != m->feed)
+    m->feed(m->feedArg, 0, off, m->dim, 0);
+}
+
+/* Moves the positions of string i down by off[i], or up when it is
+   negative, and the points of the fronts with them. The origin stays
+   at -1. The trees keep their shape, so it costs a single pass over
+   the strings and the fronts. There must be no repair in progress. */
+static void
+moveBase(mlcs m,
+	 int *off /* The offsets */
+	 )
+{
+  int dim = m->dim;
+
+  cancelRebase(m); /* Its copies would not move */
+  for(int r = 1; r < m->pfA; r++) /* Layer 0 is the origin */
+    if(NULL != m->PF[r])
+      rebaseORT(m->PF[r], off);
+  if(NULL != m->X){ /* The origin leaves the index meanwhile */
+    int O[dim];
+    point o = O;
+    int offX[dim+1]; /* The layers do not move */
+    for(int i = 0; i < dim; i++){
+      o[i] = -1;
+      offX[i] = off[i];
+    }
+    offX[dim] = 0;
+    indexPoint(m, 0, o, -1);
+    rebaseORT(m->X, offX);
+    indexPoint(m, 0, o, 1);
+  }
+  moveStrings(m, off);
+}
+
+/* Moves the positions of every string back to 0, and the points of
+   the fronts with them, with moveBase. */
+void
+rebaseMLCS(mlcs m
+	   )
+{
+  int dim = m->dim;
+  int off[dim]; /* The offsets */
+  int moves = 0;
+
+  finishRepair(m); /* Its points would not move */
+  for(int i = 0; i < dim; i++){
+    off[i] = stringBegin(m->S[i]);
+    moves = moves || 0 < off[i];
+  }
+
+  if(moves)
+    moveBase(m, off);
+
+#ifndef NDEBUG
+  printMLCS(m);
+  checkMLCS(m);
+#endif /* NDEBUG */
+}
+
+/* Starts a rebase of every string back to its current begin */
+static void
+startRebase(mlcs m
+	    )
+{
+  int dim = m->dim;
+  rebase B = malloc(sizeof(struct rebase));
+
+  B->off = malloc(dim*sizeof(int));
+  for(int i = 0; i < dim; i++)
+    B->off[i] = stringBegin(m->S[i]);
+  B->r = 1;
+  B->done = 0;
+  B->nA = m->pfA;
+  B->N = calloc(B->nA, sizeof(ort));
+  B->X = NULL;
+  if(NULL != m->X){ /* The origin does not move */
+    int O[dim+1];
+    point o = O;
+    for(int i = 0; i < dim; i++)
+      o[i] = -1;
+    o[dim] = 0;
+    B->X = m->grow ? allocORTGrow(dim+1) : allocORT(dim+1);
+    insert(B->X, o);
+  }
+  m->move = B;
+}
+
+/* One step of the rebase in progress. Copies the next layer, or
+   swaps the copies with the fronts once every layer is copied and no
+   repair holds points at the old positions, or frees the next old
+   tree. Each step touches one layer, the swap only the strings, and
+   the old index is freed in the last step. Returns the work, the
+   points and letters it moved or freed. */
+static long
+rebaseStep(mlcs m
+	   )
+{
+  rebase B = m->move;
+  int dim = m->dim;
+  long work = 1;
+
+  if(!B->done && B->nA < m->pfA){ /* The fronts grew */
+    B->N = realloc(B->N, m->pfA*sizeof(ort));
+    bzero(&(B->N[B->nA]), (m->pfA-B->nA)*sizeof(ort));
+    B->nA = m->pfA;
+  }
+
+  if(!B->done && B->r < m->pfA){
+    int r = B->r++;
+    if(NULL == m->PF[r])
+      return work;
+
+    int n;
+    int Z[dim+1];
+    point z = Z;
+    for(int i = 0; i < dim; i++)
+      z[i] = -2;
+    point *T = collect(m->PF[r], z, &n);
+    work += n;
+    for(int k = 0; k < n; k++)
+      for(int i = 0; i < dim; i++)
+	T[k][i] -= B->off[i];
+
+    if(m->grow || 0 == n){
+      B->N[r] = m->grow ? allocORTGrow(dim) : allocORT(dim);
+      for(int k = 0; k < n; k++)
+	insert(B->N[r], T[k]);
+    } else
+      B->N[r] = buildORT(dim, T, n);
+
+    for(int k = 0; k < n; k++){
+      if(NULL != B->X){
+	memcpy(z, T[k], dim*sizeof(int));
+	z[dim] = -r;
+	insert(B->X, z);
+      }
+      free(T[k]);
+    }
+    free(T);
+  } else if(!B->done){
+    if(NULL != m->job)
+      return work; /* Waits for the repair */
+
+    for(int i = 0; i < dim; i++)
+      work += stringSize(m->S[i]);
+    moveStrings(m, B->off);
+    for(int r = 1; r < B->r; r++){ /* The old trees stay in N */
+      ort t = m->PF[r];
+      m->PF[r] = B->N[r];
+      B->N[r] = t;
+    }
+    if(NULL != m->X){
+      ort t = m->X;
+      m->X = B->X;
+      B->X = t;
+    }
+    B->done = 1;
+    B->r = 1;
+
+#ifndef NDEBUG
+    printMLCS(m);
+    checkMLCS(m);
+#endif /* NDEBUG */
+  } else {
+    while(B->r < B->nA && NULL == B->N[B->r])
+      B->r++;
+    if(B->r < B->nA){
+      work += weightORT(B->N[B->r]);
+      freeORT(B->N[B->r]);
+      B->N[B->r] = NULL;
+    } else {
+      if(NULL != B->X)
+	work += weightORT(B->X);
+      cancelRebase(m); /* Only the old index is left */
+    }
+  }
+
+  return work;
+}
+
+/* Rebases the positions once string j begins at REBASE_LIMIT, so a
+   long stream of pops never overflows an int. A full pass, as in
+   rebaseMLCS, measured 0.1x to 0.23x of a shift on windows of 2 to 4
+   strings. Here it runs over the next pops instead, one layer per
+   pop, see rebaseStep, with about REBASE_LIMIT positions still to go
+   when it starts. Meanwhile the copied layers follow the changes of
+   the fronts, which made the shifts 15% to 40% slower for as long as
+   the rebase lasts. Returns the work of the step. */
+static long
+keepBase(mlcs m,
+	 int j  /* Which string */
+	 )
+{
+  if(NULL == m->move && REBASE_LIMIT <= stringBegin(m->S[j]))
+    startRebase(m);
+  if(NULL != m->move)
+    return rebaseStep(m);
+
+  return 0;
+}
+
+/* Budget mode: a job that runs the sweep W of string j */
+static repair
+sweepJob(int j, /* Which string */
+	 sweep W
+	 )
+{
+  repair R = calloc(1, sizeof(struct repair));
+
+  R->j = j;
+  R->budget = LONG_MAX;
+  R->W = W;
+
+  return R;
+}
+
+/* Spends about work units on the pending edits of lazy mode, in the
+   units of popRepair. The pops go first, as in flushMLCS. Every edit
+   is a job that runs over as many calls as it takes. A pop is a
+   repair, one point of its queue at a time, that never gives up for
+   a rebuild, since a rebuild can not be split. In threshold and
+   approximate modes the pops of a string are one sweep of popMany,
+   and an append is a sweep as well, one layer at a time. The points
+   that the rebuilds of the trees move count as work too. A call goes
+   past work by one step at most: a point of the queue or a layer, the
+   rebuilds it causes and one layer of the rebase of keepBase. */
+void
+paceMLCS(mlcs m, /* The MLCS data struct */
+	 long work /* Work allowed */
+	 )
+{
+  int dim = m->dim;
+  int lazy = m->lazy;
+  m->lazy = 0; /* The edits below are applied */
+
+  while(0 < work){
+    long moved = rebuiltORT();
+    if(NULL != m->job){
+      work -= repairRun(m, m->job, work);
+      if(repairOver(m->job)){
+	int j = m->job->j;
+	int pops = NULL == m->job->W || 0 == m->job->W->c;
+	repairDone(m);
+	if(pops)
+	  work -= keepBase(m, j);
       }
-      uncover(M, CleanM, m, c, r, j, pprev, p, plI);
-      free(pprev);
-      free(plI);
-
-      /* 1. Collect points that dominate current. */
-      n = 0;
-      if(r+1 < m->pfA && NULL != m->PF[r+1])
-        T = collect(m->PF[r+1], topPQ(Q), &n);
-
-      /* 2. remove the point. */
-      /* printMLCS(m); */
-      delete(m->PF[r], topPQ(Q));
-      /* printMLCS(m); */
-
-      /* 3. filter candidates */
-      for(int i = 0; i < n; i++){
-        if(0 == countQ(m->PF[r], T[i])){
-          pushPQ(Q, T[i]); /* Mark for deletion */
-          pushPQ(M, T[i]); /* Verify non-minima later */
-
-	  /* if(3 == r && */
-	  /*    10 == T[i][0] && */
-	  /*    8 == T[i][1] && */
-	  /*    7 == T[i][2] && */
-	  /*    7 == T[i][3] */
-	  /*    ) gdbBreak(); */
-
-          insert(m->PF[r], T[i]);
-          /* printMLCS(m); */
-        } else /* Free elements that do not go into Q */
-          free(T[i]);
+    } else {
+      int j = 0;
+      while(j < dim && 0 == m->pops[j])
+	j++;
+      if(j < dim){
+	if(0 == m->lambda){ /* Nothing to repair */
+	  m->pops[j]--;
+	  pop(m, j);
+	  work--;
+	} else if(m->lambda == m->cap || 0 < m->beam){
+	  /* The repair needs the front above, and exact fronts */
+	  m->job = sweepJob(j, popStart(m, j, m->pops[j]));
+	  m->pops[j] = 0;
+	} else {
+	  string S = m->S[j] = stringOwn(m->S[j]);
+	  if(1 == stringSize(S))
+	    m->zeros++;
+	  m->job = repairStart(m, j, LONG_MAX);
+	}
+      } else {
+	j = 0;
+	while(j < dim && 0 == stringSize(m->P[j]))
+	  j++;
+	if(j == dim) /* Nothing is pending */
+	  break;
+	char c = stringFstLetter(m->P[j]);
+	m->P[j] = stringOwn(m->P[j]);
+	stringPop(m->P[j]);
+	m->job = sweepJob(j, appendStart(m, j, c));
       }
-      if(NULL != T){
-        free(T);
-        T = NULL;
+    }
+    work -= rebuiltORT() - moved;
+  }
+
+  m->lazy = lazy;
+}
+
+/* Lazy mode: brings the fronts up to date with the pending edits.
+   They are replayed, or the fronts are built again when that looks
+   cheaper, see FLUSH_POP_COST and FLUSH_REBUILD_RATIO. */
+static void
+flushMLCS(mlcs m
+	  )
+{
+  if(m->lazy){
+    finishRepair(m);
+    int replay = 0; /* Cost of replaying the edits, in appends */
+    int n = 0; /* Letters after the edits */
+    for(int j = 0; j < m->dim; j++){
+      replay += FLUSH_POP_COST*m->pops[j] + stringSize(m->P[j]);
+      n += stringSize(m->S[j]) - m->pops[j] + stringSize(m->P[j]);
+    }
+
+    m->lazy = 0; /* The edits below are applied */
+    if(FLUSH_REBUILD_RATIO*m->dim*replay < n){
+      for(int j = 0; j < m->dim; j++){
+	if(m->pops[j] < POP_MANY_MIN) /* popMany pays off for long prefixes */
+	  for(int k = 0; k < m->pops[j]; k++)
+	    pop(m, j);
+	else
+	  popMany(m, j, m->pops[j]);
+	m->pops[j] = 0;
+      }
+      for(int j = 0; j < m->dim; j++){
+	int a = stringSize(m->P[j]);
+	if(0 < a){
+	  char *W = stringGet(m->P[j]);
+	  appendRun(m, j, W, a);
+	  free(W);
+	  m->P[j] = stringOwn(m->P[j]);
+	  stringPopMany(m->P[j], a);
+	}
+      }
+    } else
+      rebuildMLCS(m);
+    m->lazy = 1;
+  }
+}
+
+void
+lazyMLCS(mlcs m, /* The MLCS data struct */
+	 int lazy /* 1 turns lazy mode on, 0 off */
+	 )
+{
+  flushMLCS(m);
+  m->lazy = lazy;
+  m->budget = 0;
+}
+
+/* Budget mode: lazy mode where each edit also spends about work units
+   on the pending edits, with paceMLCS. A pop repair stops in the middle
+   and goes on in the next edits, so no edit does much more than work
+   units. The queries still bring the fronts up to date. 0 turns it
+   off. */
+void
+budgetMLCS(mlcs m, /* The MLCS data struct */
+	   long work /* Work per edit */
+	   )
+{
+  flushMLCS(m);
+  m->budget = work;
+  m->lazy = 0 < work;
+}
+
+string
+pullString(mlcs m,
+	   int t /* Which string do you want */
+	  )
+{
+  flushMLCS(m);
+  return m->S[t];
+}
+
+/* Copy-on-write fork. The copy shares the fronts and the strings
+   with m and only copies the parts that either one modifies. */
+mlcs
+forkMLCS(mlcs m /* The MLCS data struct */
+	 )
+{
+  int dim = m->dim;
+  finishRepair(m); /* Its queues are not shared */
+  mlcs r = malloc(sizeof(struct mlcs));
+  memcpy(r, m, sizeof(struct mlcs));
+
+  r->S = calloc(dim, sizeof(string));
+  r->P = calloc(dim, sizeof(string));
+  r->pops = calloc(dim, sizeof(int));
+  for(int i = 0; i < dim; i++){
+    r->S[i] = stringShare(m->S[i]);
+    r->P[i] = stringShare(m->P[i]);
+    r->pops[i] = m->pops[i];
+  }
+
+  r->PF = calloc(r->pfA, sizeof(ort));
+  for(int j = 0; j < r->pfA; j++)
+    if(NULL != m->PF[j])
+      r->PF[j] = forkORT(m->PF[j]);
+  r->move = NULL; /* Its pops start their own */
+  r->feed = NULL; /* The changes of the fork are not reported */
+  r->feedArg = NULL;
+  if(NULL != m->X)
+    r->X = forkORT(m->X);
+  r->K = allocSK(dim); /* Candidates are never shared */
+
+  return r;
+}
+
+/* Remove the first letter of a given string. */
+void
+pop(mlcs m, /* The MLCS data struct */
+    int j  /* Which string */
+    )
+{
+  assert(!m->grow && "Error: only appends in append only mode.");
+  if(m->lazy){
+    lazyPop(m, j, 1);
+    paceMLCS(m, m->budget);
+    return;
+  }
+
+  if(m->lambda == m->cap || 0 < m->beam){
+    /* The repair needs the front above, and exact fronts */
+    popMany(m, j, 1);
+    return;
+  }
+
+  string S = m->S[j] = stringOwn(m->S[j]);
+  if(1 == stringSize(S))
+    m->zeros++;
+
+  int repaired = 1;
+  if(0 < m->lambda){
+    repaired = popRepair(m, j, rebuildWork(m));
+
+    if(repaired && 0 == weightORT(m->PF[m->lambda]))
+      m->lambda--;
+  }
+
+  stringPop(S); /* Remove the letter */
+  switchRebuild(m, repaired);
+  keepBase(m, j);
+
+#ifndef NDEBUG
+  printMLCS(m);
+  checkMLCS(m);
+#endif /* NDEBUG */
+}
+
+/* Remove the first letter of string j and append letter c to it, as
+   in a sliding window. Same as pop followed by append, the removal is
+   almost all the work so a fused pass gained nothing measurable. */
+void
+shift(mlcs m, /* The MLCS data struct */
+      int j,  /* Which string */
+      char c  /* Which letter */
+      )
+{
+  assert(!m->grow && "Error: only appends in append only mode.");
+  if(m->lazy){
+    lazyPop(m, j, 1);
+    lazyAppend(m, j, &c, 1);
+    paceMLCS(m, m->budget);
+    return;
+  }
+  assert(0 < stringSize(m->S[j]) && "Shifting an empty string.");
+
+  pop(m, j);
+  append(m, j, c);
+}
+
+/* Remove the first k letters of a given string. All the fronts are
+   repaired in a single sweep over the layers, see popStart. */
+void
+popMany(mlcs m, /* The MLCS data struct */
+	int j,  /* Which string */
+	int k   /* Number of letters */
+	)
+{
+  assert(!m->grow && "Error: only appends in append only mode.");
+  if(m->lazy){
+    lazyPop(m, j, k);
+    paceMLCS(m, m->budget);
+    return;
+  }
+
+  sweep W = popStart(m, j, k);
+  while(popMore(m, W))
+    popLayer(m, j, W);
+  popEnd(m, W);
+  freeSweep(W);
+
+  trimFronts(m);
+  keepBase(m, j);
+
+#ifndef NDEBUG
+  printMLCS(m);
+  checkMLCS(m);
+#endif /* NDEBUG */
+}
+
+/* Add letter c before the first letter of string j. Only the points
+   that the new letter creates are computed. Layer 1 gets at most one
+   new point and the new points of layer r are successors of the new
+   points of layer r-1. Old points that they cover are removed. The
+   sweep stops at the first layer without new points. */
+void
+prepend(mlcs m, /* The MLCS data struct */
+	int j,  /* Which string */
+	char c  /* Which letter */
+	)
+{
+  assert(!m->grow && "Error: only appends in append only mode.");
+  /* Undoes the last pending pop, unless the repair in progress is
+     already removing that letter */
+  if(m->lazy && 0 < m->pops[j] &&
+     !(NULL != m->job && NULL == m->job->W && j == m->job->j &&
+       1 == m->pops[j]) &&
+     c == stringLetter(m->S[j], stringBegin(m->S[j])+m->pops[j]-1)){
+    m->pops[j]--; /* Undoes a pending pop */
+    return;
+  }
+
+  int lazy = m->lazy;
+  flushMLCS(m);
+  m->lazy = 0;
+
+  if(0 == stringSize(m->S[j]))
+    append(m, j, c);
+  else {
+    /* Positions can not go below 0. String j moves up by its size,
+       so the room doubles and the moves cost O(1) per prepend, in
+       passes over the fronts. */
+    if(NULL != m->move && stringBegin(m->S[j]) <= m->move->off[j])
+      cancelRebase(m); /* Its copies can not go below 0 */
+    if(0 == stringBegin(m->S[j])){
+      int off[m->dim];
+      for(int i = 0; i < m->dim; i++)
+	off[i] = 0;
+      off[j] = -stringSize(m->S[j]);
+      moveBase(m, off);
+    }
+
+    string S = m->S[j] = stringOwn(m->S[j]);
+    stringPrepend(S, c);
+
+    if(0 == m->zeros){
+      int dim = m->dim;
+      int sigma = stringSigma(S);
+      /* candidate point */
+      point p = malloc(dim*sizeof(int));
+      /* The origin is the only point of layer 0 */
+      point o = malloc(dim*sizeof(int));
+      for(int i = 0; i < dim; i++)
+	o[i] = -1;
+
+      /* Points added to the current layer */
+      pointQueue D = allocPQ();
+      growPF(m);
+      clearSK(m->K);
+      succCandidate(m, m->PF[1], o, c, p);
+
+      for(int r = 1; 0 < sizeSK(m->K); r++){
+	insertMinima(m, r, D);
+	if(r == m->lambda+1)
+	  m->lambda++;
+	growPF(m);
+
+	clearSK(m->K);
+	while(!isEmptyPQ(D)){
+	  point q = topPQ(D);
+
+	  /* Remove the old points that q covers */
+	  removeCovered(m, r, q);
+
+	  char a = 'A'; /* No successors above the threshold */
+	  for(int l = 0; r < m->cap && l < sigma; l++, a++)
+	    succCandidate(m, m->PF[r+1], q, a, p);
+	  free(q);
+	  popPQ(D);
+	}
       }
 
-      /* 4. process Q */
-      free(topPQ(Q));
-      popPQ(Q);
+      freePQ(D);
+      free(o);
+      free(p);
     }
-    cleanCovered(M, dim, m->PF[r], p);
-    free(p);
+  }
 
-    freePQ(Q);
+  m->lazy = lazy;
 
-    freePH(CleanM); /* Frees all the points involved */
-    freePQ(M);
-    if(NULL != T){
+  trimFronts(m);
+
+#ifndef NDEBUG
+  printMLCS(m);
+  checkMLCS(m);
+#endif /* NDEBUG */
+}
+
+/* Remove the last k letters of string j. Fronts only depend on the
+   prefixes, so it suffices to delete the points that use those
+   letters. */
+static void
+cutBack(mlcs m, /* The MLCS data struct */
+	int j,  /* Which string */
+	int k   /* Number of letters */
+	)
+{
+  string S = m->S[j] = stringOwn(m->S[j]);
+  assert(k <= stringSize(S) && "Popping more letters than the string has.");
+  if(0 < k && k == stringSize(S))
+    m->zeros++;
+
+  int dim = m->dim;
+  int n;
+  /* Range limits */
+  int L[dim];
+  point lo = L;
+  int H[dim];
+  point hi = H;
+  for(int i = 0; i < dim; i++){
+    lo[i] = -1;
+    hi[i] = stringEnd(m->S[i]);
+  }
+  lo[j] = stringEnd(S)-k;
+
+  for(int r = 1; 0 < k && r <= m->lambda; r++){
+    point *T = rangeCollect(m->PF[r], lo, hi, &n);
+    for(int l = 0; l < n; l++){
+      frontDelete(m, r, T[l]);
+      free(T[l]);
+    }
+    if(NULL != T)
       free(T);
-      T = NULL;
+  }
+
+  while(0 < m->lambda && 0 == weightORT(m->PF[m->lambda]))
+    m->lambda--;
+
+  for(int l = 0; l < k; l++)
+    stringPopBack(S);
+}
+
+/* Remove the last letter of string j. */
+void
+popBack(mlcs m, /* The MLCS data struct */
+	int j  /* Which string */
+	)
+{
+  assert(!m->grow && "Error: only appends in append only mode.");
+  if(m->lazy && 0 < stringSize(m->P[j])){
+    m->P[j] = stringOwn(m->P[j]);
+    stringPopBack(m->P[j]); /* Undoes a pending append */
+    return;
+  }
+
+  int lazy = m->lazy;
+  flushMLCS(m);
+  m->lazy = 0;
+
+  assert(0 < stringSize(m->S[j]) && "Popping from an empty string.");
+  cutBack(m, j, 1);
+  m->lazy = lazy;
+
+#ifndef NDEBUG
+  printMLCS(m);
+  checkMLCS(m);
+#endif /* NDEBUG */
+}
+
+/* Computes the points that use the letters of string j from position
+   x on, which were appended to the string after cutBack removed the
+   old ones. The other points do not change and none of them is covered
+   by a new point. The new points of layer r are the successors of layer
+   r-1 that land at x or after, so by letter c they come from the
+   points at or after the last c before x. Each layer is visited once,
+   with one range query per letter. */
+static void
+sweepSuffix(mlcs m, /* The MLCS data struct */
+	    int j,  /* Which string */
+	    int x   /* First new position */
+	    )
+{
+  int dim = m->dim;
+  int sigma = stringSigma(m->S[j]);
+  /* candidate point */
+  point p = malloc(dim*sizeof(int));
+  /* Range limits */
+  int L[dim];
+  point lo = L;
+  int H[dim];
+  point hi = H;
+
+  for(int r = 1; r <= m->lambda+1 && r <= m->cap; r++){
+    growPF(m);
+    clearSK(m->K);
+    char c = 'A';
+    for(int t = 0; t < sigma; t++, c++){
+      int valid = 1;
+      for(int i = 0; valid && i < dim; i++){
+	lo[i] = -1;
+	hi[i] = stringLast(m->S[i], c);
+	valid = -2 != hi[i];
+      }
+      if(valid && x <= hi[j]){
+	lo[j] = stringFloor(m->S[j], c, x-1);
+	int n;
+	point *T = rangeCollect(m->PF[r-1], lo, hi, &n);
+	for(int l = 0; l < n; l++){
+	  succCandidate(m, m->PF[r], T[l], c, p);
+	  free(T[l]);
+	}
+	if(NULL != T)
+	  free(T);
+      }
     }
 
-    if(0 == weightORT(m->PF[m->lambda]))
-      m->lambda--;
+    insertMinima(m, r, NULL);
+    if(r == m->lambda+1 && 0 < weightORT(m->PF[r]))
+      m->lambda++;
   }
 
-  stringPop(S); /* Remove the letter */
+  free(p);
+}
+
+/* Removes del letters at position pos of string j and puts letter c
+   there instead, unless c is 0. The points that use the letters
+   before pos do not change. The others are deleted in one sweep over
+   the layers and computed again in another, see sweepSuffix. */
+static void
+editMLCS(mlcs m, /* The MLCS data struct */
+	 int j,  /* Which string */
+	 int pos, /* Position, counting from the first letter */
+	 int del, /* Number of letters removed, 0 or 1 */
+	 char c  /* Letter inserted, or 0 */
+	 )
+{
+  assert(!m->grow && "Error: only appends in append only mode.");
+  string S = m->S[j];
+  int n = stringSize(S) - m->pops[j]; /* Old letters left */
+  int lazy = m->lazy;
+  int pending = lazy && n <= pos; /* Only the pending appends change */
+
+  if(pending){
+    S = m->P[j] = stringOwn(m->P[j]);
+    pos -= n;
+  } else {
+    flushMLCS(m);
+    m->lazy = 0;
+    S = m->S[j];
+  }
+  assert(0 <= pos && pos+del <= stringSize(S) && "Editing outside the string.");
+
+  int k = stringSize(S) - pos; /* Letters after pos */
+  char *W = malloc((k+1)*sizeof(char)); /* The new suffix */
+  int l = 0;
+  if(0 != c)
+    W[l++] = c;
+  for(int i = stringBegin(S)+pos+del; i < stringEnd(S); i++)
+    W[l++] = stringLetter(S, i);
+
+  if(pending){ /* Recorded, as in lazyAppend */
+    for(int i = 0; i < k; i++)
+      stringPopBack(S);
+    for(int i = 0; i < l; i++)
+      stringAppend(S, W[i]);
+    free(W);
+    paceMLCS(m, m->budget);
+    return;
+  }
+
+  cutBack(m, j, k);
+  S = m->S[j];
+  if(0 < l && 0 == stringSize(S))
+    m->zeros--;
+  for(int i = 0; i < l; i++)
+    stringAppend(S, W[i]);
+  if(0 < l && 0 == m->zeros)
+    sweepSuffix(m, j, stringEnd(S)-l);
+  trimFronts(m);
+
+  free(W);
+  m->lazy = lazy;
+
+#ifndef NDEBUG
+  printMLCS(m);
+  checkMLCS(m);
+#endif /* NDEBUG */
+}
+
+/* Insert letter c at position pos of string j */
+void
+editInsert(mlcs m, /* The MLCS data struct */
+	   int j,  /* Which string */
+	   int pos, /* Position, counting from the first letter */
+	   char c  /* Which letter */
+	   )
+{
+  editMLCS(m, j, pos, 0, c);
+}
+
+/* Delete the letter at position pos of string j */
+void
+editDelete(mlcs m, /* The MLCS data struct */
+	   int j,  /* Which string */
+	   int pos /* Position, counting from the first letter */
+	   )
+{
+  editMLCS(m, j, pos, 1, 0);
+}
+
+/* Replace the letter at position pos of string j by c */
+void
+editSubstitute(mlcs m, /* The MLCS data struct */
+	       int j,  /* Which string */
+	       int pos, /* Position, counting from the first letter */
+	       char c  /* Which letter */
+	       )
+{
+  editMLCS(m, j, pos, 1, c);
+}
+
+/* The fronts get the new number of strings and only keep the origin.
+   The strings must already have the new number. */
+static void
+resizeMLCS(mlcs m, /* The MLCS data struct */
+	   int dim /* New number of strings */
+	   )
+{
+  assert(NULL == m->job && "Pop repair in progress.");
+  assert(NULL == m->move && "Rebase in progress.");
+  assert(NULL == m->X && "The index has the old dimension.");
+  for(int r = 0; r < m->pfA; r++)
+    if(NULL != m->PF[r])
+      freeFront(m, r);
+  m->lambda = 0;
+  m->dim = dim;
+  freeSK(m->K);
+  m->K = allocSK(dim);
+
+  point p = malloc(dim*sizeof(int));
+  for(int i = 0; i < dim; i++)
+    p[i] = -1;
+  m->PF[0] = allocORT(dim);
+  insert(m->PF[0], p);
+  free(p);
+}
+
+/* Adds string s as the last string, its number is the old dim. The
+   pending edits of lazy mode go first. The fronts get a coordinate for
+   the new string, while it is empty only the origin is left, and then
+   s is appended to them with appendRun. */
+void
+addString(mlcs m, /* The MLCS data struct */
+	  const char *s /* The new string */
+	  )
+{
+  int dim = m->dim+1;
+  int sigma = stringSigma(m->S[0]);
+  int lazy = m->lazy;
+  int indexed = NULL != m->X; /* The index changes dimension */
+
+  flushMLCS(m); /* The edits have the old dimension */
+  cancelRebase(m);
+  m->lazy = 0;
+  indexMLCS(m, 0);
+  m->S = realloc(m->S, dim*sizeof(string));
+  m->P = realloc(m->P, dim*sizeof(string));
+  m->pops = realloc(m->pops, dim*sizeof(int));
+  m->S[dim-1] = stringAlloc(sigma);
+  m->P[dim-1] = stringAlloc(sigma);
+  m->pops[dim-1] = 0;
+
+  resizeMLCS(m, dim);
+  m->zeros++; /* The new string */
+  indexMLCS(m, indexed);
+  appendRun(m, dim-1, s, strlen(s));
+  m->lazy = lazy;
+
+#ifndef NDEBUG
+  printMLCS(m);
+  checkMLCS(m);
+#endif /* NDEBUG */
+}
+
+/* Removes string j, the later strings move down one number. Without
+   a string the points can gain rank, so projecting the fronts is not
+   enough and they are built again, with the pending edits of lazy
+   mode. */
+void
+removeString(mlcs m, /* The MLCS data struct */
+	     int j  /* Which string */
+	     )
+{
+  assert(2 < m->dim && "Error: MLCS should contain at least 2 strings.");
+  int dim = m->dim-1;
+  int lazy = m->lazy;
+  int indexed = NULL != m->X; /* The index changes dimension */
+
+  finishRepair(m); /* Its points have the old dimension */
+  cancelRebase(m);
+  indexMLCS(m, 0);
+  stringFree(m->S[j]);
+  stringFree(m->P[j]);
+  for(int i = j; i < dim; i++){
+    m->S[i] = m->S[i+1];
+    m->P[i] = m->P[i+1];
+    m->pops[i] = m->pops[i+1];
+  }
+
+  resizeMLCS(m, dim);
+  m->lazy = 0;
+  rebuildMLCS(m);
+  m->lazy = lazy;
+  indexMLCS(m, indexed);
 
 #ifndef NDEBUG
   printMLCS(m);
@@ -534,6 +3083,372 @@ int
 mlcsSize(mlcs m
 	 )
 {
+  flushMLCS(m);
   return m->lambda;
 
 }
+
+/* Without evictions the fronts are exact. The letter count bound
+   needs one pass over the strings. */
+int
+mlcsUpperBound(mlcs m
+	       )
+{
+  flushMLCS(m);
+  if(0 == m->evicted)
+    return m->lambda;
+
+  int dim = m->dim;
+  int sigma = stringSigma(m->S[0]);
+  int C[dim*sigma]; /* Letter counts of the strings */
+  for(int k = 0; k < dim*sigma; k++)
+    C[k] = 0;
+  for(int i = 0; i < dim; i++)
+    for(int k = stringBegin(m->S[i]); k < stringEnd(m->S[i]); k++)
+      C[i*sigma+stringLetter(m->S[i], k)-'A']++;
+
+  int u = 0;
+  for(int c = 0; c < sigma; c++){
+    int f = C[c];
+    for(int i = 1; i < dim; i++)
+      f = C[i*sigma+c] < f ? C[i*sigma+c] : f;
+    u += f;
+  }
+
+  return u;
+}
+
+int
+reachesThreshold(mlcs m
+		 )
+{
+  flushMLCS(m);
+  return m->lambda == m->cap;
+}
+
+int
+mlcsPrefix(mlcs m, /* The MLCS data struct */
+	   int *q /* Last position of each prefix */
+	   )
+{
+  int A[m->dim];
+  point x = A;
+
+  flushMLCS(m);
+  prefixCorner(m, q, x);
+  return prefixSearch(m, x, 0, m->lambda+1);
+}
+
+void
+mlcsPrefixBatch(mlcs m, /* The MLCS data struct */
+		int n, /* Number of vectors */
+		int *q, /* The position vectors */
+		int *out /* Gets the results */
+		)
+{
+  int dim = m->dim;
+  int A[dim];
+  point x = A;
+
+  flushMLCS(m);
+  for(int k = 0; k < n; k++){
+    int lo = 0;
+    int hi = m->lambda+1;
+    if(0 < k){ /* Longer prefixes can only have a larger MLCS */
+      int up = 1;
+      int down = 1;
+      for(int i = 0; i < dim; i++){
+	up = up && q[(k-1)*dim+i] <= q[k*dim+i];
+	down = down && q[k*dim+i] <= q[(k-1)*dim+i];
+      }
+      if(up)
+	lo = out[k-1];
+      if(down)
+	hi = out[k-1]+1;
+    }
+    prefixCorner(m, &q[k*dim], x);
+    out[k] = prefixSearch(m, x, lo, hi);
+  }
+}
+
+static int windowDim; /* For windowCmp */
+
+/* Orders the windows by their start vectors, then by their end
+   vectors, both lexicographically */
+static int
+windowCmp(const void *pp,
+	  const void *qq
+	  )
+{
+  const int *p = pp;
+  const int *q = qq;
+
+  for(int i = 0; i < 2*windowDim; i++)
+    if(p[i] != q[i])
+      return p[i] < q[i] ? -1 : 1;
+
+  return 0;
+}
+
+/* True if the instance of window [cs, ce) gets to window [a, b) with
+   appendRun and popMany for less than a build of [a, b), see
+   WINDOW_POP_COST. Only when no end moves back. */
+static int
+windowSlides(int dim, /* The number of strings. */
+	     int *cs, /* The current window */
+	     int *ce,
+	     int *a, /* The next window */
+	     int *b
+	     )
+{
+  double moves = 0; /* In letters of a build */
+  long size = 0;
+
+  for(int i = 0; i < dim; i++){
+    if(a[i] < cs[i] || b[i] < ce[i])
+      return 0;
+    moves += WINDOW_POP_COST*(a[i]-cs[i]) + b[i]-ce[i];
+    size += b[i]-a[i];
+  }
+
+  return moves <= size;
+}
+
+/* Moves the instance w, of window [cs, ce), to window [a, b). It
+   slides when windowSlides says so, otherwise the window is built
+   from scratch. w can be NULL, then there is no current window.
+   Returns the instance, cs and ce get the new window. */
+static mlcs
+windowMove(mlcs w, /* The instance, or NULL */
+	   int dim, /* The number of strings. */
+	   int sigma, /* Alphabet size */
+	   char **W, /* The strings */
+	   int *cs, /* The current window */
+	   int *ce,
+	   int *a, /* The next window */
+	   int *b
+	   )
+{
+  if(NULL == w || !windowSlides(dim, cs, ce, a, b)){
+    char *V[dim];
+    for(int i = 0; i < dim; i++){
+      V[i] = malloc((b[i]-a[i]+1)*sizeof(char));
+      memcpy(V[i], &W[i][a[i]], (b[i]-a[i])*sizeof(char));
+      V[i][b[i]-a[i]] = '\0';
+    }
+    if(NULL != w)
+      freeMLCS(w);
+    w = buildMLCS(dim, sigma, V);
+    for(int i = 0; i < dim; i++)
+      free(V[i]);
+  } else {
+    /* Append first, so no string gets empty on the way */
+    for(int i = 0; i < dim; i++)
+      if(ce[i] < b[i])
+	appendRun(w, i, &W[i][ce[i]], b[i]-ce[i]);
+    for(int i = 0; i < dim; i++)
+      if(cs[i] < a[i])
+	popMany(w, i, a[i]-cs[i]);
+  }
+
+  memcpy(cs, a, dim*sizeof(int));
+  memcpy(ce, b, dim*sizeof(int));
+
+  return w;
+}
+
+/* The windows are sorted by their start vectors and then their end
+   vectors, so a window whose starts and ends all move forward from
+   the previous one usually comes right after it. The instance then
+   slides with windowMove, otherwise the window is built from scratch
+   and nothing is shared. */
+void
+mlcsWindowBatch(int dim, /* The number of strings. */
+		int sigma, /* Alphabet size */
+		char **W, /* The strings */
+		int n, /* Number of windows */
+		int *s, /* The start vectors */
+		int *e, /* The end vectors */
+		int *out /* Gets the results */
+		)
+{
+  int cs[dim]; /* Current window */
+  int ce[dim];
+
+  int *O = malloc((2*dim+1)*n*sizeof(int)); /* Starts, ends and window */
+  for(int k = 0; k < n; k++){
+    int *o = &O[(2*dim+1)*k];
+    for(int i = 0; i < dim; i++){
+      assert(0 <= s[k*dim+i] && s[k*dim+i] <= e[k*dim+i] &&
+	     e[k*dim+i] <= (int)strlen(W[i]) && "Window out of range.");
+      o[i] = s[k*dim+i];
+      o[dim+i] = e[k*dim+i];
+    }
+    o[2*dim] = k;
+  }
+  windowDim = dim;
+  qsort(O, n, (2*dim+1)*sizeof(int), windowCmp);
+
+  mlcs w = NULL; /* Holds the current window */
+  for(int l = 0; l < n; l++){
+    int k = O[(2*dim+1)*l+2*dim];
+    w = windowMove(w, dim, sigma, W, cs, ce, &s[k*dim], &e[k*dim]);
+    out[k] = mlcsSize(w);
+  }
+
+  if(NULL != w)
+    freeMLCS(w);
+  free(O);
+}
+
+/* The smallest LCS of two windows at offset o, a bound for their
+   MLCS. T holds the windows. */
+static int
+pairBound(int dim, /* The number of strings. */
+	  int sigma, /* Alphabet size */
+	  char **W, /* The strings */
+	  char **T, /* Room for the windows */
+	  int o, /* The offset */
+	  int width /* Window size */
+	  )
+{
+  int u = INT_MAX;
+
+  for(int i = 0; i < dim; i++){
+    memcpy(T[i], &W[i][o], width*sizeof(char));
+    T[i][width] = '\0';
+  }
+  for(int i = 0; i < dim; i++)
+    for(int j = i+1; j < dim; j++){
+      char *P[2] = {T[i], T[j]};
+      int l = naiveMLCS(2, P, sigma);
+      u = l < u ? l : u;
+    }
+
+  return u;
+}
+
+/* The letter count bound, the sum over the letters of the fewest
+   occurrences in a window, slides with the offset in O(dim*sigma).
+   The offset with the highest bound is computed first. Then one
+   instance slides over the other offsets in ascending order, with
+   windowMove, and skips the offsets whose bound is not above the best
+   MLCS. When the gap to the next offset is too large to slide, see
+   WINDOW_POP_COST, the smallest pairwise LCS may skip it before it is
+   built. For two strings that LCS is the MLCS. */
+int
+mlcsMaxWindow(int dim, /* The number of strings. */
+	      int sigma, /* Alphabet size */
+	      char **W, /* The strings */
+	      int width, /* Window size */
+	      int *offset /* Gets the offset */
+	      )
+{
+  int L = INT_MAX;
+  for(int i = 0; i < dim; i++){
+    int l = strlen(W[i]);
+    L = l < L ? l : L;
+  }
+  assert(0 <= width && width <= L && "Window larger than a string.");
+
+  int n = L-width+1; /* Number of offsets */
+  int C[dim*sigma]; /* Letter counts of the windows */
+  int *U = malloc(n*sizeof(int)); /* The bounds */
+  int top = 0; /* Offset with the highest bound */
+  for(int k = 0; k < dim*sigma; k++)
+    C[k] = 0;
+  for(int i = 0; i < dim; i++)
+    for(int k = 0; k < width; k++)
+      C[i*sigma+W[i][k]-'A']++;
+
+  for(int o = 0; o < n; o++){
+    if(0 < o){
+      for(int i = 0; i < dim; i++){
+	C[i*sigma+W[i][o-1]-'A']--;
+	C[i*sigma+W[i][o+width-1]-'A']++;
+      }
+    }
+    U[o] = 0;
+    for(int c = 0; c < sigma; c++){
+      int f = C[c];
+      for(int i = 1; i < dim; i++)
+	f = C[i*sigma+c] < f ? C[i*sigma+c] : f;
+      U[o] += f;
+    }
+    if(U[top] < U[o])
+      top = o;
+  }
+
+  char *T[dim]; /* The windows, for the pairwise bound */
+  for(int i = 0; i < dim; i++)
+    T[i] = malloc((width+1)*sizeof(char));
+  int cs[dim]; /* Window of the instance */
+  int ce[dim];
+  int a[dim]; /* Next window */
+  int b[dim];
+  mlcs w = NULL;
+
+  int best = -1;
+  *offset = 0;
+  for(int l = -1; l < n; l++){
+    int o = -1 == l ? top : l; /* The top offset goes first */
+    if((0 <= l && o == top) || U[o] <= best)
+      continue;
+    for(int i = 0; i < dim; i++){
+      a[i] = o;
+      b[i] = o+width;
+    }
+    int u; /* The MLCS, or a bound not above best */
+    if(NULL == w || !windowSlides(dim, cs, ce, a, b))
+      u = pairBound(dim, sigma, W, T, o, width);
+    else
+      u = U[o];
+    if(best < u && 2 < dim){
+      w = windowMove(w, dim, sigma, W, cs, ce, a, b);
+      u = mlcsSize(w);
+    }
+    if(best < u){
+      best = u;
+      *offset = o;
+    }
+  }
+
+  if(NULL != w)
+    freeMLCS(w);
+  for(int i = 0; i < dim; i++)
+    free(T[i]);
+  free(U);
+
+  return best;
+}
+
+/* Any point of PF[r] has a point of PF[r-1] strictly below it, so the
+   chain is followed back from the top front with one query per
+   layer. */
+int
+mlcsWitness(mlcs m, /* The MLCS data struct */
+	    char *out, /* Gets the letters */
+	    int *positions /* Gets the positions, or NULL */
+	    )
+{
+  int dim = m->dim;
+  int B[dim];
+  point x = B;
+
+  flushMLCS(m);
+  for(int i = 0; i < dim; i++)
+    x[i] = stringEnd(m->S[i]);
+
+  int r;
+  for(r = m->lambda; 0 < r && dominatedFind(m->PF[r], x, x); r--){
+    out[r-1] = stringLetter(m->S[0], x[0]);
+    if(NULL != positions){
+      for(int i = 0; i < dim; i++)
+	positions[(r-1)*dim+i] = x[i]-stringBegin(m->S[i]);
+    }
+  }
+  assert(0 == r && "Broken chain of fronts.");
+  out[m->lambda] = '\0';
+
+  return m->lambda;
+}
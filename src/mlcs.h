@@ -37,6 +37,23 @@ struct mlcs{
   int lambda; /* The size of the mlcs */
   ort *PF;    /* Array with pareto fronts. */
   int pfA;    /* Size of the PF array */
+  int lazy;   /* Update the fronts only on queries */
+  int *pops;  /* Pending pops of each string */
+  string *P;  /* Pending appends of each string */
+  int cap;    /* Highest front that is kept */
+  int beam;   /* Most points kept in a front, 0 keeps all */
+  double (*score)(point p, int d); /* Higher is evicted first */
+  long evicted; /* Points evicted so far */
+  int grow;   /* Only appends, the fronts are insert only */
+  int repairs;  /* Pops repaired on the fronts */
+  int rebuilds; /* Pops that built the fronts again instead */
+  void (*feed)(void *arg, int r, point p, int d, int sign); /* Gets the front changes, or NULL */
+  void *feedArg; /* Passed to feed */
+  ort X;      /* Cross layer index of the fronts, or NULL */
+  skyline K;  /* Candidates for the next points of a front */
+  long budget; /* Work per edit in budget mode, 0 is off */
+  struct repair *job; /* Job of budget mode in progress, or NULL */
+  struct rebase *move; /* Rebase in progress, or NULL */
 };
 #endif /* NDEBUG */
 
@@ -48,29 +65,279 @@ allocMLCS(int dim, /* The number of strings. */
 	  int sigma /* Alphabet size */
 	  );
 
+/* Threshold mode, only the fronts 0..k are kept. The MLCS size is
+   then reported as min(MLCS, k), which bounds time and memory by the
+   target length. */
+mlcs
+allocMLCSThreshold(int dim, /* The number of strings. */
+		   int sigma, /* Alphabet size */
+		   int k /* Target length */
+		   );
+
+/* Approximate mode, each front keeps at most B points, the ones with
+   the lowest score. Every kept point is a common subsequence, so the
+   MLCS size is a lower bound. A NULL score uses the coordinate sum. */
+mlcs
+allocMLCSApprox(int dim, /* The number of strings. */
+		int sigma, /* Alphabet size */
+		int B, /* Most points per front */
+		double (*score)(point p, int d) /* Higher is evicted first */
+		);
+
+/* Append only mode, the strings only grow. The fronts use insert
+   only trees, see allocORTGrow, and every operation that removes
+   letters is an error. */
+mlcs
+allocMLCSGrow(int dim, /* The number of strings. */
+	      int sigma /* Alphabet size */
+	      );
+
+/* Builds the fronts of the strings S[0..dim-1] in one sweep over the
+   layers, without appending letter by letter. */
+mlcs
+buildMLCS(int dim, /* The number of strings. */
+	  int sigma, /* Alphabet size */
+	  char **S /* The strings */
+	  );
+
 void
 freeMLCS(mlcs m /* The structure */
 	 );
 
+/* Prints how many pops repaired the fronts and how many gave up and
+   built them again, because the repair cost more than a rebuild. */
+void
+printStatsMLCS(mlcs m
+	       );
+
+/* Calls feed(arg, r, p, dim, +1 or -1) whenever point p enters or
+   leaves front r > 0. After rebaseMLCS() it calls feed(arg, 0, off,
+   dim, 0), every point moved down by off. A prepend at position 0
+   reports the room it makes the same way, with a negative offset.
+   NULL stops the reports. */
+void
+feedMLCS(mlcs m,
+	 void (*feed)(void *arg, int r, point p, int d, int sign),
+	 void *arg /* Passed to feed */
+	 );
+
+/* 1 keeps every front point, labelled by its layer, in one index that
+   answers the box queries of append for all the layers at once. 0
+   goes back to the separate fronts only. */
+void
+indexMLCS(mlcs m,
+	  int on /* 1 keeps the index, 0 drops it */
+	  );
+
+/* Copy-on-write fork. Costs O(dim + lambda), the fork and m then
+   evolve independently and can be freed in any order. */
+mlcs
+forkMLCS(mlcs m /* The MLCS data struct */
+	 );
+
+/* Applies the pending edits of lazy mode */
 string
 pullString(mlcs m,
 	   int t
 	   );
 
+/* In lazy mode the edits only update the strings. The fronts are
+   brought up to date by the next query, i.e., mlcsSize, mlcsWitness
+   or pullString. Turning it off also updates them. */
+void
+lazyMLCS(mlcs m, /* The MLCS data struct */
+	 int lazy /* 1 turns lazy mode on, 0 off */
+	 );
+
+/* Budget mode is lazy mode where each edit also does about work units
+   of the pending edits. A pop repair stops in the middle and goes on
+   in the next edits, and so do the appends and, in threshold and
+   approximate modes, the pops, one layer at a time. An edit goes past
+   work by one such step at most, with the rebuilds of the trees it
+   causes. The queries bring the fronts up to date. 0 turns it off. */
+void
+budgetMLCS(mlcs m, /* The MLCS data struct */
+	   long work /* Work per edit */
+	   );
+
+/* Does about work units of the pending edits of lazy mode, in the
+   units of the pop repairs, see budgetMLCS. */
+void
+paceMLCS(mlcs m, /* The MLCS data struct */
+	 long work /* Work allowed */
+	 );
+
 void
 append(mlcs m, /* The MLCS data struct */
        int i,  /* Which string */
        char c  /* Which letter */
        );
 
+/* Appends a run of letters to string i, in a single pass. */
+void
+appendRun(mlcs m, /* The MLCS data struct */
+	  int i,  /* Which string */
+	  const char *s, /* The letters */
+	  int len /* Number of letters */
+	  );
+
+/* Appends letters[i] to string i, for all the strings. */
+void
+appendColumn(mlcs m, /* The MLCS data struct */
+	     const char *letters /* One letter per string */
+	     );
+
 void
 pop(mlcs m, /* The MLCS data struct */
     int i  /* Which string */
     );
 
+/* Moves the positions of every string back to 0, and the points of
+   the fronts with them, so that a long stream of pops and appends
+   never overflows an int. Pops do the same once a string begins at
+   REBASE_LIMIT, spread over the next pops, one layer of the fronts
+   per pop. */
+void
+rebaseMLCS(mlcs m
+	   );
+
+/* Removes the first k letters of string i */
+void
+popMany(mlcs m, /* The MLCS data struct */
+	int i,  /* Which string */
+	int k   /* Number of letters */
+	);
+
+/* Removes the first letter of string i and appends letter c */
+void
+shift(mlcs m, /* The MLCS data struct */
+      int i,  /* Which string */
+      char c  /* Which letter */
+      );
+
+/* Adds letter c before the first letter of string i */
+void
+prepend(mlcs m, /* The MLCS data struct */
+	int i,  /* Which string */
+	char c  /* Which letter */
+	);
+
+/* Removes the last letter of string i */
+void
+popBack(mlcs m, /* The MLCS data struct */
+	int i  /* Which string */
+	);
+
+/* Inserts letter c at position pos of string i, counting from its
+   first letter. The points that use letters from pos on are deleted
+   and computed again in one sweep over the layers, so the cost depends
+   on those points and not on the length of the suffix. */
+void
+editInsert(mlcs m, /* The MLCS data struct */
+	   int i,  /* Which string */
+	   int pos, /* Position */
+	   char c  /* Which letter */
+	   );
+
+/* Deletes the letter at position pos of string i */
+void
+editDelete(mlcs m, /* The MLCS data struct */
+	   int i,  /* Which string */
+	   int pos /* Position */
+	   );
+
+/* Replaces the letter at position pos of string i by c */
+void
+editSubstitute(mlcs m, /* The MLCS data struct */
+	       int i,  /* Which string */
+	       int pos, /* Position */
+	       char c  /* Which letter */
+	       );
+
+/* Adds string s, it gets number d and the MLCS gets d+1 strings */
+void
+addString(mlcs m, /* The MLCS data struct */
+	  const char *s /* The new string */
+	  );
+
+/* Removes string i, the later strings move down one number */
+void
+removeString(mlcs m, /* The MLCS data struct */
+	     int i  /* Which string */
+	     );
+
 /* Returns the size of the MLCS */
 int
 mlcsSize(mlcs m
 	 );
 
+/* An upper bound for mlcsSize() with exact fronts. It is mlcsSize()
+   unless approximate mode evicted some point, then it is the sum over
+   the letters of the fewest occurrences in a string, so the error of
+   mlcsSize() is at most the difference. Takes O(length) time after an
+   eviction. */
+int
+mlcsUpperBound(mlcs m
+	       );
+
+/* Does the MLCS have at least the threshold length. O(1), except
+   for flushing lazy mode. Always false without a threshold. */
+int
+reachesThreshold(mlcs m
+		 );
+
+/* Returns the MLCS of the prefixes that end at position q[i] of each
+   string i, counting from its first letter. q[i] = -1 is the empty
+   prefix. Does not change the fronts. */
+int
+mlcsPrefix(mlcs m, /* The MLCS data struct */
+	   int *q /* Last position of each prefix */
+	   );
+
+/* mlcsPrefix for n position vectors, q[k*d+i] is position i of
+   vector k and out[k] gets its result. Sorted vectors, where each one
+   is above or below the previous, narrow the searches. */
+void
+mlcsPrefixBatch(mlcs m, /* The MLCS data struct */
+		int n, /* Number of vectors */
+		int *q, /* The position vectors */
+		int *out /* Gets the results */
+		);
+
+/* The MLCS of n windows of the strings W[0..dim-1]. Window k has the
+   letters s[k*dim+i] to e[k*dim+i]-1 of string i and out[k] gets its
+   size. The windows are sorted and a single instance slides from one
+   to the next, when every start and end moves forward and that is
+   cheaper than a build. */
+void
+mlcsWindowBatch(int dim, /* The number of strings. */
+		int sigma, /* Alphabet size */
+		char **W, /* The strings */
+		int n, /* Number of windows */
+		int *s, /* The start vectors */
+		int *e, /* The end vectors */
+		int *out /* Gets the results */
+		);
+
+/* Returns the largest MLCS of the windows W[i][o..o+width-1], over
+   the offsets o that fit in every string, and stores one such offset
+   in *offset. Cheap upper bounds skip most of the offsets, one
+   instance slides over the others in ascending order. */
+int
+mlcsMaxWindow(int dim, /* The number of strings. */
+	      int sigma, /* Alphabet size */
+	      char **W, /* The strings */
+	      int width, /* Window size */
+	      int *offset /* Gets the offset */
+	      );
+
+/* Stores in out one MLCS, out needs mlcsSize(m)+1 chars. If positions
+   is not NULL the k-th letter occurs at positions[k*d+i] of string i,
+   counting from its first letter. Returns the size of the MLCS. */
+int
+mlcsWitness(mlcs m, /* The MLCS data struct */
+	    char *out, /* Gets the letters */
+	    int *positions /* Gets the positions, or NULL */
+	    );
+
 #endif /* _MLCS_H */
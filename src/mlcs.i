@@ -0,0 +1,6209 @@
+# 0 "mlcs.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "mlcs.c"
+# 36 "mlcs.c"
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 56 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 57 "/usr/include/stdlib.h" 2 3 4
+
+
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 30 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+
+
+
+
+
+typedef __off_t off_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+
+
+
+
+typedef __ssize_t ssize_t;
+
+
+
+
+
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 611 "/usr/include/stdlib.h" 3 4
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 630 "/usr/include/stdlib.h" 3 4
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+# 649 "/usr/include/stdlib.h" 3 4
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 37 "mlcs.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 38 "mlcs.c" 2
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 84 "/usr/include/stdio.h" 3 4
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 434 "/usr/include/stdio.h" 3 4
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 605 "/usr/include/stdio.h" 3 4
+extern char *gets (char *__s) __attribute__ ((__deprecated__));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 127 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 39 "mlcs.c" 2
+# 1 "/usr/include/assert.h" 1 3 4
+# 40 "mlcs.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 1 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 203 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/include/limits.h" 1 3 4
+# 26 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/limits.h" 2 3 4
+# 195 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+# 161 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+# 1 "/usr/include/linux/limits.h" 1 3 4
+# 39 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+# 81 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 2 3 4
+# 82 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+# 162 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+# 196 "/usr/include/limits.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h" 1 3 4
+# 200 "/usr/include/limits.h" 2 3 4
+# 204 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 2 3 4
+# 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 41 "mlcs.c" 2
+
+# 1 "ort.h" 1
+# 30 "ort.h"
+
+# 30 "ort.h"
+typedef struct ort *ort;
+typedef struct node *node;
+
+void
+configure(int mxn,
+          int mxd,
+          double alpha,
+          int confcut
+          );
+
+
+void
+deconfigure(void);
+
+double
+adjustCut(int param
+   );
+
+
+ort
+allocORT(int dim
+  );
+
+
+
+
+
+ort
+allocORTGrow(int dim
+      );
+
+
+void
+freeORT(ort rt
+ );
+
+
+
+ort
+forkORT(ort rt
+ );
+
+
+
+
+void
+rebaseORT(ort rt,
+   int *off
+   );
+
+
+int
+weightORT(ort rt
+   );
+
+
+int
+countQ(ort rt,
+       int* coords
+       );
+
+
+int
+containsQ(ort rt,
+   int* coords
+   );
+
+
+# 1 "point.h" 1
+# 30 "point.h"
+typedef int *point;
+
+
+int
+pointcmp(point p,
+         point q,
+         int dim
+         );
+
+int
+pointFullcmp(point p,
+      point q,
+      int dim
+      );
+
+
+int
+pointEquals(point p,
+     point q,
+     int dim
+     );
+
+
+int
+getCoord(point p,
+         int d
+         );
+
+
+
+void
+plusPlus(point p,
+         int dim
+         );
+
+void
+minusMinus(point p,
+           int dim
+           );
+
+int
+pointSum(point p,
+  int dim
+  );
+# 99 "ort.h" 2
+
+
+ort
+buildORT(int dim,
+  point *P,
+  int n
+  );
+
+
+
+point *
+collect(ort rt,
+ int* coords,
+ int* n
+ );
+
+
+point *
+dominatedCollect(ort rt,
+                 int* coords,
+                 int* n
+                 );
+
+
+
+int
+dominatedFind(ort rt,
+       int* coords,
+       point p
+       );
+
+point *
+rangeCollect(ort rt,
+      int* minCoords,
+      int* maxCoords,
+      int* n
+      );
+
+
+
+
+
+point *
+cornerCollect(ort rt,
+       int* minCoords,
+       int* maxCoords,
+       int* corner,
+       int* n
+       );
+
+
+
+
+point *
+evictWorst(ort rt,
+    int k,
+    double (*score)(point p, int d),
+    int* n
+    );
+
+void
+insert(ort rt,
+       point p
+       );
+
+void
+delete(ort rt,
+       point p
+       );
+# 43 "mlcs.c" 2
+# 1 "string.h" 1
+# 30 "string.h"
+typedef struct string *string;
+
+
+
+
+
+string
+stringAlloc(int sigma
+     );
+
+
+void
+stringFree(string S
+    );
+
+
+string
+stringShare(string S
+     );
+
+
+
+string
+stringOwn(string S
+   );
+
+void
+printString(string S
+     );
+
+int
+stringSize(string S
+    );
+
+int
+stringSigma(string S
+            );
+
+int
+stringBegin(string S
+     );
+
+int
+stringEnd(string S
+     );
+
+void
+stringAppend(string S,
+      char c
+      );
+
+
+void
+stringPrepend(string S,
+       char c
+       );
+
+
+char
+stringLetter(string S,
+      int j
+      );
+
+char
+stringFstLetter(string S
+  );
+
+
+int
+stringLast(string S,
+    char c
+    );
+
+
+int
+stringCeil(string S,
+    char c,
+    int k
+    );
+
+
+int
+stringFloor(string S,
+     char c,
+     int k
+     );
+
+
+int
+stringIdx(string S,
+    char c,
+    int k
+    );
+
+
+
+int
+stringPos(string S,
+          char c,
+          int i
+          );
+
+void
+stringPop(string S
+   );
+
+
+void
+stringPopMany(string S,
+       int k
+       );
+
+
+void
+stringPopBack(string S
+       );
+
+
+void
+stringShift(string S,
+     char c
+     );
+
+
+
+void
+stringRebase(string S,
+      int k
+      );
+
+char *
+stringGet(string S
+   );
+# 44 "mlcs.c" 2
+# 1 "skyline.h" 1
+# 35 "skyline.h"
+typedef struct skyline *skyline;
+
+skyline
+allocSK(int dim
+ );
+
+void
+freeSK(skyline K
+       );
+
+
+
+
+int
+skylineSK(skyline K,
+   point G,
+   int n
+   );
+
+
+void
+clearSK(skyline K
+ );
+
+
+void
+addSK(skyline K,
+      point p
+      );
+
+
+int
+sizeSK(skyline K
+       );
+
+
+
+int
+minimaSK(skyline K
+  );
+
+
+point
+pointSK(skyline K,
+ int i
+ );
+
+
+int
+findSK(skyline K,
+       point p
+       );
+# 45 "mlcs.c" 2
+# 1 "mlcs.h" 1
+# 30 "mlcs.h"
+typedef struct mlcs *mlcs;
+# 58 "mlcs.h"
+void
+printMLCS(mlcs m);
+
+mlcs
+allocMLCS(int dim,
+   int sigma
+   );
+
+
+
+
+mlcs
+allocMLCSThreshold(int dim,
+     int sigma,
+     int k
+     );
+
+
+
+
+mlcs
+allocMLCSApprox(int dim,
+  int sigma,
+  int B,
+  double (*score)(point p, int d)
+  );
+
+
+
+
+mlcs
+allocMLCSGrow(int dim,
+       int sigma
+       );
+
+
+
+mlcs
+buildMLCS(int dim,
+   int sigma,
+   char **S
+   );
+
+void
+freeMLCS(mlcs m
+  );
+
+
+
+void
+printStatsMLCS(mlcs m
+        );
+
+
+
+
+void
+feedMLCS(mlcs m,
+  void (*feed)(void *arg, int r, point p, int d, int sign),
+  void *arg
+  );
+
+
+
+
+void
+indexMLCS(mlcs m,
+   int on
+   );
+
+
+
+mlcs
+forkMLCS(mlcs m
+  );
+
+
+string
+pullString(mlcs m,
+    int t
+    );
+
+
+
+
+void
+lazyMLCS(mlcs m,
+  int lazy
+  );
+
+
+
+
+
+void
+budgetMLCS(mlcs m,
+    long work
+    );
+
+
+
+void
+paceMLCS(mlcs m,
+  long work
+  );
+
+void
+append(mlcs m,
+       int i,
+       char c
+       );
+
+
+void
+appendRun(mlcs m,
+   int i,
+   const char *s,
+   int len
+   );
+
+
+void
+appendColumn(mlcs m,
+      const char *letters
+      );
+
+void
+pop(mlcs m,
+    int i
+    );
+
+
+
+
+
+void
+rebaseMLCS(mlcs m
+    );
+
+
+void
+popMany(mlcs m,
+ int i,
+ int k
+ );
+
+
+void
+shift(mlcs m,
+      int i,
+      char c
+      );
+
+
+void
+prepend(mlcs m,
+ int i,
+ char c
+ );
+
+
+void
+popBack(mlcs m,
+ int i
+ );
+
+
+
+
+
+void
+editInsert(mlcs m,
+    int i,
+    int pos,
+    char c
+    );
+
+
+void
+editDelete(mlcs m,
+    int i,
+    int pos
+    );
+
+
+void
+editSubstitute(mlcs m,
+        int i,
+        int pos,
+        char c
+        );
+
+
+void
+addString(mlcs m,
+   const char *s
+   );
+
+
+void
+removeString(mlcs m,
+      int i
+      );
+
+
+int
+mlcsSize(mlcs m
+  );
+
+
+
+int
+reachesThreshold(mlcs m
+   );
+
+
+
+
+int
+mlcsPrefix(mlcs m,
+    int *q
+    );
+
+
+
+
+void
+mlcsPrefixBatch(mlcs m,
+  int n,
+  int *q,
+  int *out
+  );
+
+
+
+
+void
+mlcsWindowBatch(int dim,
+  int sigma,
+  char **W,
+  int n,
+  int *s,
+  int *e,
+  int *out
+  );
+
+
+
+
+
+int
+mlcsMaxWindow(int dim,
+       int sigma,
+       char **W,
+       int width,
+       int *offset
+       );
+
+
+
+
+int
+mlcsWitness(mlcs m,
+     char *out,
+     int *positions
+     );
+# 46 "mlcs.c" 2
+# 1 "naivemlcs.h" 1
+# 30 "naivemlcs.h"
+int
+naiveMLCS(int dim,
+   char** S,
+   int sigma
+   );
+# 47 "mlcs.c" 2
+# 1 "pointQueue.h" 1
+# 32 "pointQueue.h"
+typedef struct pointQueue *pointQueue;
+
+pointQueue
+allocPQ(void
+        );
+
+
+void
+expandPQ(pointQueue Q,
+         int n
+         );
+void
+freePQ(pointQueue Q
+       );
+
+
+int
+isEmptyPQ(pointQueue Q
+          );
+
+
+void
+markPQ(pointQueue Q
+       );
+
+
+int
+markingTruePQ(pointQueue Q
+              );
+
+
+void
+pushPQ(pointQueue Q,
+      point p
+     );
+
+void
+popPQ(pointQueue Q
+     );
+
+point
+topPQ(pointQueue Q
+     );
+# 48 "mlcs.c" 2
+# 1 "pointHash.h" 1
+# 32 "pointHash.h"
+typedef struct pointHash *pointHash;
+
+pointHash
+allocPH(int dim
+        );
+
+void
+freePH(pointHash h
+       );
+
+void
+insertPH(pointHash h,
+         point p
+         );
+
+int
+containsPH(pointHash h,
+           point p
+           );
+
+void
+deletePH(pointHash h,
+         point p
+         );
+# 49 "mlcs.c" 2
+# 93 "mlcs.c"
+struct mlcs{
+  int dim;
+  int zeros;
+  string *S;
+  int lambda;
+  ort *PF;
+  int pfA;
+  int lazy;
+  int *pops;
+  string *P;
+  int cap;
+  int beam;
+  double (*score)(point p, int d);
+  int grow;
+  int repairs;
+  int rebuilds;
+  void (*feed)(void *arg, int r, point p, int d, int sign);
+  void *feedArg;
+  ort X;
+  skyline K;
+  long budget;
+  struct repair *job;
+};
+
+
+
+
+typedef struct repair *repair;
+struct repair{
+  int j;
+  char a;
+  long budget;
+  long work;
+  int r;
+  int stop;
+  pointQueue Q;
+  pointQueue M;
+  point p;
+  int *plI;
+  int *pprev;
+  point z;
+  point f;
+};
+# 191 "mlcs.c"
+void
+printMLCS(mlcs m)
+{
+  point *T;
+  int n;
+  int A[m->dim];
+  point p = A;
+
+  for(int k = 0; k < m->dim; k++)
+    p[k] = -1;
+
+  for(int i = 0; i <= m->lambda; i++){
+    printf("\n");
+    printf("@ %d : ", i);
+    n = 0;
+    T = collect(m->PF[i], p, &n);
+    for(int j = 0; j < n; j++){
+      printf("(");
+      for(int k = 0; k < m->dim; k++)
+ printf("%d, ", T[j][k]);
+      printf(") ");
+      free(T[j]);
+    }
+    printf("\n");
+    free(T);
+  }
+}
+
+
+
+mlcs
+allocMLCS(int dim,
+   int sigma
+   )
+{
+  
+# 226 "mlcs.c" 3 4
+ ((void) (0))
+# 226 "mlcs.c"
+                                                                    ;
+  mlcs r = malloc(sizeof(struct mlcs));
+
+  r->dim = dim;
+  r->zeros = dim;
+  r->lambda = 0;
+  r->pfA = 3;
+  r->PF = calloc(r->pfA, sizeof(ort));
+
+  r->S = calloc(dim, sizeof(string));
+  for(int i = 0; i < dim; i++)
+    r->S[i] = stringAlloc(sigma);
+
+  r->lazy = 0;
+  r->cap = 0x7fffffff;
+  r->beam = 0;
+  r->score = 
+# 242 "mlcs.c" 3 4
+            ((void *)0)
+# 242 "mlcs.c"
+                ;
+  r->grow = 0;
+  r->repairs = 0;
+  r->rebuilds = 0;
+  r->feed = 
+# 246 "mlcs.c" 3 4
+           ((void *)0)
+# 246 "mlcs.c"
+               ;
+  r->feedArg = 
+# 247 "mlcs.c" 3 4
+              ((void *)0)
+# 247 "mlcs.c"
+                  ;
+  r->X = 
+# 248 "mlcs.c" 3 4
+        ((void *)0)
+# 248 "mlcs.c"
+            ;
+  r->K = allocSK(dim);
+  r->budget = 0;
+  r->job = 
+# 251 "mlcs.c" 3 4
+          ((void *)0)
+# 251 "mlcs.c"
+              ;
+  r->pops = calloc(dim, sizeof(int));
+  r->P = calloc(dim, sizeof(string));
+  for(int i = 0; i < dim; i++)
+    r->P[i] = stringAlloc(sigma);
+
+  point p = malloc(dim*sizeof(int));
+  for(int i = 0; i < dim; i++)
+    p[i] = -1;
+
+  r->PF[0] = allocORT(dim);
+  insert(r->PF[0], p);
+  free(p);
+
+  return r;
+}
+
+mlcs
+allocMLCSThreshold(int dim,
+     int sigma,
+     int k
+     )
+{
+  
+# 274 "mlcs.c" 3 4
+ ((void) (0))
+# 274 "mlcs.c"
+                                                        ;
+  mlcs r = allocMLCS(dim, sigma);
+  r->cap = k;
+
+  return r;
+}
+
+
+static double
+sumScore(point p,
+  int d
+  )
+{
+  double s = 0;
+  for(int i = 0; i < d; i++)
+    s += p[i];
+
+  return s;
+}
+
+mlcs
+allocMLCSApprox(int dim,
+  int sigma,
+  int B,
+  double (*score)(point p, int d)
+  )
+{
+  
+# 301 "mlcs.c" 3 4
+ ((void) (0))
+# 301 "mlcs.c"
+                                                          ;
+  mlcs r = allocMLCS(dim, sigma);
+  r->beam = B;
+  r->score = 
+# 304 "mlcs.c" 3 4
+            ((void *)0) 
+# 304 "mlcs.c"
+                 != score ? score : sumScore;
+
+  return r;
+}
+
+mlcs
+allocMLCSGrow(int dim,
+       int sigma
+       )
+{
+  mlcs r = allocMLCS(dim, sigma);
+  r->grow = 1;
+
+  return r;
+}
+
+void
+printStatsMLCS(mlcs m
+        )
+{
+  printf("[STATS] repairs %d rebuilds %d\n", m->repairs, m->rebuilds);
+}
+
+
+
+
+
+
+void
+feedMLCS(mlcs m,
+  void (*feed)(void *arg, int r, point p, int d, int sign),
+  void *arg
+  )
+{
+  m->feed = feed;
+  m->feedArg = arg;
+}
+
+
+static void
+freeRepair(repair R
+    )
+{
+  while(!isEmptyPQ(R->Q)){
+    free(topPQ(R->Q));
+    popPQ(R->Q);
+  }
+  while(!isEmptyPQ(R->M)){
+    free(topPQ(R->M));
+    popPQ(R->M);
+  }
+  freePQ(R->Q);
+  freePQ(R->M);
+  free(R->f);
+  free(R->z);
+  free(R->pprev);
+  free(R->plI);
+  free(R->p);
+  free(R);
+}
+
+void
+freeMLCS(mlcs m
+  )
+{
+  
+# 369 "mlcs.c" 3 4
+ ((void) (0))
+# 369 "mlcs.c"
+                                                 ;
+
+  for(int i = 0; i < m->dim; i++)
+    stringFree(m->S[i]);
+
+  free(m->S);
+  m->S = 
+# 375 "mlcs.c" 3 4
+        ((void *)0)
+# 375 "mlcs.c"
+            ;
+
+  for(int i = 0; i < m->dim; i++)
+    stringFree(m->P[i]);
+  free(m->P);
+  m->P = 
+# 380 "mlcs.c" 3 4
+        ((void *)0)
+# 380 "mlcs.c"
+            ;
+  free(m->pops);
+  m->pops = 
+# 382 "mlcs.c" 3 4
+           ((void *)0)
+# 382 "mlcs.c"
+               ;
+
+  for(int j = 0; j < m->pfA; j++){
+    if(
+# 385 "mlcs.c" 3 4
+      ((void *)0) 
+# 385 "mlcs.c"
+           != m->PF[j])
+      freeORT(m->PF[j]);
+    m->PF[j] = 
+# 387 "mlcs.c" 3 4
+              ((void *)0)
+# 387 "mlcs.c"
+                  ;
+  }
+  free(m->PF);
+  if(
+# 390 "mlcs.c" 3 4
+    ((void *)0) 
+# 390 "mlcs.c"
+         != m->X)
+    freeORT(m->X);
+  m->X = 
+# 392 "mlcs.c" 3 4
+        ((void *)0)
+# 392 "mlcs.c"
+            ;
+  freeSK(m->K);
+  m->K = 
+# 394 "mlcs.c" 3 4
+        ((void *)0)
+# 394 "mlcs.c"
+            ;
+  if(
+# 395 "mlcs.c" 3 4
+    ((void *)0) 
+# 395 "mlcs.c"
+         != m->job)
+    freeRepair(m->job);
+  m->job = 
+# 397 "mlcs.c" 3 4
+          ((void *)0)
+# 397 "mlcs.c"
+              ;
+
+  m->dim = 0;
+  m->lambda = 0;
+  m->pfA = 0;
+
+  free(m);
+}
+
+
+
+
+static void
+lazyPop(mlcs m,
+ int j,
+ int k
+ )
+{
+  int n = stringSize(m->S[j]) - m->pops[j];
+
+  if(k <= n)
+    m->pops[j] += k;
+  else {
+    
+# 420 "mlcs.c" 3 4
+   ((void) (0))
+# 420 "mlcs.c"
+                                                                                    ;
+    m->pops[j] += n;
+    m->P[j] = stringOwn(m->P[j]);
+    stringPopMany(m->P[j], k-n);
+  }
+}
+
+
+static void
+lazyAppend(mlcs m,
+    int j,
+    const char *s,
+    int len
+    )
+{
+  m->P[j] = stringOwn(m->P[j]);
+  for(int k = 0; k < len; k++)
+    stringAppend(m->P[j], s[k]);
+}
+
+
+
+
+static void
+indexPoint(mlcs m,
+    int r,
+    point p,
+    int sign
+    )
+{
+  int Q[m->dim+1];
+  point q = Q;
+
+  memcpy(q, p, m->dim*sizeof(int));
+  q[m->dim] = -r;
+  if(0 < sign)
+    insert(m->X, q);
+  else
+    delete(m->X, q);
+}
+
+
+static void
+frontInsert(mlcs m,
+     int r,
+     point p
+     )
+{
+  insert(m->PF[r], p);
+  if(
+# 469 "mlcs.c" 3 4
+    ((void *)0) 
+# 469 "mlcs.c"
+         != m->X)
+    indexPoint(m, r, p, 1);
+  if(
+# 471 "mlcs.c" 3 4
+    ((void *)0) 
+# 471 "mlcs.c"
+         != m->feed)
+    m->feed(m->feedArg, r, p, m->dim, 1);
+}
+
+
+static void
+frontDelete(mlcs m,
+     int r,
+     point p
+     )
+{
+  if(
+# 482 "mlcs.c" 3 4
+    ((void *)0) 
+# 482 "mlcs.c"
+         != m->feed)
+    m->feed(m->feedArg, r, p, m->dim, -1);
+  if(
+# 484 "mlcs.c" 3 4
+    ((void *)0) 
+# 484 "mlcs.c"
+         != m->X)
+    indexPoint(m, r, p, -1);
+  delete(m->PF[r], p);
+}
+
+
+
+static void
+frontRemoved(mlcs m,
+      int r,
+      point *V,
+      int n
+      )
+{
+  for(int k = 0; 
+# 498 "mlcs.c" 3 4
+                ((void *)0) 
+# 498 "mlcs.c"
+                     != m->X && k < n; k++)
+    indexPoint(m, r, V[k], -1);
+  for(int k = 0; 
+# 500 "mlcs.c" 3 4
+                ((void *)0) 
+# 500 "mlcs.c"
+                     != m->feed && k < n; k++)
+    m->feed(m->feedArg, r, V[k], m->dim, -1);
+}
+
+
+static void
+freeFront(mlcs m,
+   int r
+   )
+{
+  if(
+# 510 "mlcs.c" 3 4
+    ((void *)0) 
+# 510 "mlcs.c"
+         != m->feed && 0 < r){
+    int n;
+    int Z[m->dim];
+    point z = Z;
+    for(int i = 0; i < m->dim; i++)
+      z[i] = -2;
+    point *T = collect(m->PF[r], z, &n);
+    frontRemoved(m, r, T, n);
+    for(int k = 0; k < n; k++)
+      free(T[k]);
+    free(T);
+  }
+  freeORT(m->PF[r]);
+  m->PF[r] = 
+# 523 "mlcs.c" 3 4
+            ((void *)0)
+# 523 "mlcs.c"
+                ;
+}
+
+
+
+
+void
+indexMLCS(mlcs m,
+   int on
+   )
+{
+  if(on && 
+# 534 "mlcs.c" 3 4
+          ((void *)0) 
+# 534 "mlcs.c"
+               == m->X){
+    int Z[m->dim];
+    point z = Z;
+    for(int i = 0; i < m->dim; i++)
+      z[i] = -2;
+
+    m->X = m->grow ? allocORTGrow(m->dim+1) : allocORT(m->dim+1);
+    for(int r = 0; r < m->pfA; r++){
+      int n;
+      if(
+# 543 "mlcs.c" 3 4
+        ((void *)0) 
+# 543 "mlcs.c"
+             == m->PF[r])
+ continue;
+      point *T = collect(m->PF[r], z, &n);
+      for(int k = 0; k < n; k++){
+ indexPoint(m, r, T[k], 1);
+ free(T[k]);
+      }
+      free(T);
+    }
+  }
+  if(!on && 
+# 553 "mlcs.c" 3 4
+           ((void *)0) 
+# 553 "mlcs.c"
+                != m->X){
+    freeORT(m->X);
+    m->X = 
+# 555 "mlcs.c" 3 4
+          ((void *)0)
+# 555 "mlcs.c"
+              ;
+  }
+}
+
+
+static void
+growPF(mlcs m
+       )
+{
+  if(m->lambda == m->cap)
+    return;
+
+  if(1+m->lambda == m->pfA){
+    int a = m->pfA;
+    m->pfA = m->cap < 2*a ? m->cap+1 : 2*a;
+    m->PF = realloc(m->PF, m->pfA*sizeof(ort));
+    bzero(&(m->PF[a]),
+   (m->pfA-a)*sizeof(ort)
+   );
+  }
+
+  if(
+# 576 "mlcs.c" 3 4
+    ((void *)0) 
+# 576 "mlcs.c"
+         == m->PF[m->lambda+1])
+    m->PF[m->lambda+1] = m->grow ? allocORTGrow(m->dim) : allocORT(m->dim);
+}
+
+static int sortDim;
+
+
+
+
+static int
+candCmp(const void *pp,
+ const void *pq
+ )
+{
+  point p = *(point *)pp;
+  point q = *(point *)pq;
+
+  for(int i = 0; i <= sortDim; i++)
+    if(p[i] != q[i])
+      return p[i] < q[i] ? -1 : 1;
+
+  return 0;
+}
+
+
+
+
+
+
+
+static void
+buildFronts(mlcs m
+     )
+{
+  int dim = m->dim;
+  int sigma = stringSigma(m->S[0]);
+
+  int Z[dim];
+  point z = Z;
+  for(int i = 0; i < dim; i++)
+    z[i] = -2;
+
+  for(int r = 0; 0 == m->zeros && r < m->cap; r++){
+    int n;
+    point *T = collect(m->PF[r], z, &n);
+
+
+    int *C = malloc(n*sigma*(dim+1)*sizeof(int));
+    point *R = malloc(n*sigma*sizeof(point));
+    int nC = 0;
+    for(int k = 0; k < n; k++){
+      char c = 'A';
+      for(int l = 0; l < sigma; l++, c++){
+ point q = &C[nC*(dim+1)];
+ int valid = 1;
+ q[0] = 0;
+ for(int i = 0; valid && i < dim; i++){
+   q[i+1] = stringCeil(m->S[i], c, T[k][i]+1);
+   valid = -2 != q[i+1];
+   q[0] += q[i+1];
+ }
+ if(valid)
+   R[nC++] = q;
+      }
+      free(T[k]);
+    }
+    free(T);
+
+    sortDim = dim;
+    qsort(R, nC, sizeof(point), candCmp);
+
+    ort tempP = allocORT(dim);
+    int nM = 0;
+    point prev = 
+# 649 "mlcs.c" 3 4
+                ((void *)0)
+# 649 "mlcs.c"
+                    ;
+    for(int k = 0; k < nC; k++){
+      point q = R[k];
+
+      int covered = 
+# 653 "mlcs.c" 3 4
+                   ((void *)0) 
+# 653 "mlcs.c"
+                        != prev && 0 == candCmp(&prev, &q);
+      prev = q;
+      q = &q[1];
+      if(!covered){
+ plusPlus(q, dim);
+ covered = 0 < countQ(tempP, q);
+ minusMinus(q, dim);
+      }
+      if(!covered){
+ insert(tempP, q);
+ R[nM++] = q;
+      }
+    }
+    freeORT(tempP);
+
+    if(0 < nM){
+      growPF(m);
+      freeORT(m->PF[r+1]);
+      if(m->grow){
+ m->PF[r+1] = allocORTGrow(dim);
+ for(int k = 0; k < nM; k++)
+   insert(m->PF[r+1], R[k]);
+      } else
+ m->PF[r+1] = buildORT(dim, R, nM);
+      for(int k = 0; 
+# 677 "mlcs.c" 3 4
+                    ((void *)0) 
+# 677 "mlcs.c"
+                         != m->feed && k < nM; k++)
+ m->feed(m->feedArg, r+1, R[k], dim, 1);
+      m->lambda++;
+      if(0 < m->beam){
+ int nE;
+ point *E = evictWorst(m->PF[r+1], m->beam, m->score, &nE);
+ frontRemoved(m, r+1, E, nE);
+ for(int k = 0; k < nE; k++)
+   free(E[k]);
+ free(E);
+      }
+    }
+    free(R);
+    free(C);
+
+    if(0 == nM)
+      break;
+  }
+}
+
+
+
+
+
+
+static void
+rebuildMLCS(mlcs m
+     )
+{
+  int dim = m->dim;
+  char *W[dim];
+  int n[dim];
+  int indexed = 
+# 709 "mlcs.c" 3 4
+               ((void *)0) 
+# 709 "mlcs.c"
+                    != m->X;
+
+  if(
+# 711 "mlcs.c" 3 4
+    ((void *)0) 
+# 711 "mlcs.c"
+         != m->job){
+    freeRepair(m->job);
+    m->job = 
+# 713 "mlcs.c" 3 4
+            ((void *)0)
+# 713 "mlcs.c"
+                ;
+  }
+  indexMLCS(m, 0);
+
+  for(int j = 0; j < dim; j++){
+    string S = m->S[j] = stringOwn(m->S[j]);
+    string P = m->P[j] = stringOwn(m->P[j]);
+    n[j] = stringSize(S) - m->pops[j] + stringSize(P);
+    W[j] = malloc((n[j]+1)*sizeof(char));
+
+    int k = 0;
+    for(int i = stringBegin(S)+m->pops[j]; i < stringEnd(S); i++)
+      W[j][k++] = stringLetter(S, i);
+    for(int i = stringBegin(P); i < stringEnd(P); i++)
+      W[j][k++] = stringLetter(P, i);
+
+    stringPopMany(S, stringSize(S));
+    stringPopMany(P, stringSize(P));
+    m->pops[j] = 0;
+  }
+
+  for(int r = 1; r < m->pfA; r++)
+    if(
+# 735 "mlcs.c" 3 4
+      ((void *)0) 
+# 735 "mlcs.c"
+           != m->PF[r])
+      freeFront(m, r);
+  m->lambda = 0;
+  m->zeros = 0;
+  for(int j = 0; j < dim; j++){
+    for(int k = 0; k < n[j]; k++)
+      stringAppend(m->S[j], W[j][k]);
+    if(0 == n[j])
+      m->zeros++;
+  }
+  buildFronts(m);
+
+  for(int j = 0; j < dim; j++)
+    free(W[j]);
+  indexMLCS(m, indexed);
+}
+
+
+static void
+removeCovered(mlcs m,
+       int r,
+       point q
+       )
+{
+  int n;
+  int dim = m->dim;
+
+  minusMinus(q, dim);
+  point *T = collect(m->PF[r], q, &n);
+  plusPlus(q, dim);
+  for(int k = 0; k < n; k++){
+    if(!pointEquals(T[k], q, dim))
+      frontDelete(m, r, T[k]);
+    free(T[k]);
+  }
+  free(T);
+}
+
+
+
+
+static int
+prefixSearch(mlcs m,
+      point x,
+      int lo,
+      int hi
+      )
+{
+  int A[m->dim];
+  point p = A;
+
+
+  while(lo+1 < hi){
+    int r = (lo+hi)/2;
+    if(dominatedFind(m->PF[r], x, p))
+      lo = r;
+    else
+      hi = r;
+  }
+
+  return lo;
+}
+
+
+static void
+prefixCorner(mlcs m,
+      int *q,
+      point x
+      )
+{
+  for(int i = 0; i < m->dim; i++){
+    
+# 806 "mlcs.c" 3 4
+   ((void) (0))
+                                         
+# 807 "mlcs.c"
+                                        ;
+    x[i] = stringBegin(m->S[i])+q[i]+1;
+  }
+}
+
+
+
+
+static void
+trimFronts(mlcs m
+    )
+{
+  if(0 == m->beam)
+    return;
+
+  int A[m->dim];
+  point p = A;
+  int nV = 0;
+  point *V = 
+# 825 "mlcs.c" 3 4
+            ((void *)0)
+# 825 "mlcs.c"
+                ;
+
+  for(int r = 1; r <= m->lambda; r++){
+    int nU = 0;
+    point *U = 
+# 829 "mlcs.c" 3 4
+              ((void *)0)
+# 829 "mlcs.c"
+                  ;
+    for(int l = 0; l < nV; l++){
+      int n;
+      point *T = collect(m->PF[r], V[l], &n);
+      U = realloc(U, (nU+n)*sizeof(point));
+      for(int k = 0; k < n; k++){
+ if(containsQ(m->PF[r], T[k]) &&
+    !dominatedFind(m->PF[r-1], T[k], p)){
+   frontDelete(m, r, T[k]);
+   U[nU++] = T[k];
+ } else
+   free(T[k]);
+      }
+      free(T);
+      free(V[l]);
+    }
+    free(V);
+
+    int nE;
+    point *E = evictWorst(m->PF[r], m->beam, m->score, &nE);
+    frontRemoved(m, r, E, nE);
+    if(0 < nE){
+      U = realloc(U, (nU+nE)*sizeof(point));
+      memcpy(&U[nU], E, nE*sizeof(point));
+      nU += nE;
+      free(E);
+    }
+    V = U;
+    nV = nU;
+  }
+
+  for(int l = 0; l < nV; l++)
+    free(V[l]);
+  free(V);
+
+  while(0 < m->lambda && 0 == weightORT(m->PF[m->lambda]))
+    m->lambda--;
+}
+
+
+
+static void
+succCandidate(mlcs m,
+       ort pf,
+       point q,
+       char c,
+       point p
+       )
+{
+  int dim = m->dim;
+  int valid = 1;
+
+  for(int i = 0; valid && i < dim; i++){
+    p[i] = stringCeil(m->S[i], c, q[i]+1);
+    valid = -2 != p[i];
+  }
+
+  if(valid){
+
+    plusPlus(p, dim);
+    valid = 0 == countQ(pf, p);
+    minusMinus(p, dim);
+    if(valid)
+      addSK(m->K, p);
+  }
+}
+
+
+
+
+static void
+insertMinima(mlcs m,
+      int r,
+      pointQueue Q
+      )
+{
+  int dim = m->dim;
+  int n = minimaSK(m->K);
+
+  for(int k = 0; k < n; k++){
+    frontInsert(m, r, pointSK(m->K, k));
+    if(
+# 910 "mlcs.c" 3 4
+      ((void *)0) 
+# 910 "mlcs.c"
+           != Q){
+      point q = malloc(dim*sizeof(int));
+      memcpy(q, pointSK(m->K, k), dim*sizeof(int));
+      pushPQ(Q, q);
+    }
+  }
+}
+
+
+
+
+
+static int
+frontCovers(mlcs m,
+     int r,
+     point p,
+     point h,
+     int indexed
+     )
+{
+  if(!indexed)
+    return dominatedFind(m->PF[r], p, h);
+
+  int Q[m->dim+1];
+  point q = Q;
+  int H[m->dim+1];
+  memcpy(q, p, m->dim*sizeof(int));
+  q[m->dim] = 1-r;
+  int found = dominatedFind(m->X, q, H);
+  memcpy(h, H, m->dim*sizeof(int));
+
+  return found;
+}
+
+
+
+
+static void
+appendPoints(mlcs m,
+      int j,
+      char c,
+      int r,
+      point *T,
+      int n,
+      point p,
+      int indexed
+      )
+{
+  int dim = m->dim;
+  int H[dim];
+  point h = H;
+
+  if(0 < n){
+    clearSK(m->K);
+    for(int k = 0; k < n; k++){
+      int excludeP = 0;
+      for(int i = 0; !excludeP && i < dim; i++){
+ p[i] = stringCeil(m->S[i], c, T[k][i]+1);
+ if(i == j){
+   p[i] = stringEnd(m->S[i]);
+   excludeP = T[k][i] == p[i];
+ } else
+   excludeP = -2 == p[i];
+      }
+
+      free(T[k]);
+      if(!excludeP){
+
+ plusPlus(p, dim);
+ excludeP = frontCovers(m, r, p, h, indexed);
+ minusMinus(p, dim);
+ if(!excludeP)
+   addSK(m->K, p);
+      }
+    }
+
+    insertMinima(m, r, 
+# 986 "mlcs.c" 3 4
+                      ((void *)0)
+# 986 "mlcs.c"
+                          );
+  }
+}
+
+
+
+
+static void
+appendLayer(mlcs m,
+     int j,
+     char c,
+     int r,
+     point z,
+     point f,
+     point p
+     )
+{
+  int n;
+  point *T = rangeCollect(m->PF[r-1], z, f, &n);
+
+  appendPoints(m, j, c, r, T, n, p, 0);
+  free(T);
+}
+
+
+
+
+
+static void
+appendLayers(mlcs m,
+      int j,
+      char c,
+      int top,
+      point z,
+      point f,
+      point p
+      )
+{
+  int dim = m->dim;
+  int n;
+  int lo[dim+1];
+  int hi[dim+1];
+
+  memcpy(lo, z, dim*sizeof(int));
+  memcpy(hi, f, dim*sizeof(int));
+  lo[dim] = 1-top;
+  hi[dim] = 1;
+  point *T = rangeCollect(m->X, lo, hi, &n);
+
+
+  int C[top+1];
+  int W[top];
+  for(int r = 0; r <= top; r++)
+    C[r] = 0;
+  for(int k = 0; k < n; k++)
+    C[1-T[k][dim]]++;
+  for(int r = 1; r <= top; r++)
+    C[r] += C[r-1];
+  memcpy(W, C, top*sizeof(int));
+  point *G = malloc((0 < n ? n : 1)*sizeof(point));
+  for(int k = 0; k < n; k++)
+    G[W[-T[k][dim]]++] = T[k];
+  free(T);
+
+  for(int r = 1; r <= top; r++)
+    appendPoints(m, j, c, r, &G[C[r-1]], C[r]-C[r-1], p, 1);
+  free(G);
+}
+
+void
+append(mlcs m,
+       int j,
+       char c
+       )
+{
+  if(m->lazy){
+    lazyAppend(m, j, &c, 1);
+    paceMLCS(m, m->budget);
+    return;
+  }
+
+  string S = m->S[j] = stringOwn(m->S[j]);
+  if(0 == stringSize(S))
+    m->zeros--;
+
+  if(0 == m->zeros){
+    growPF(m);
+
+    int dim = m->dim;
+
+    point p = malloc(dim*sizeof(int));
+
+    point z = malloc(dim*sizeof(int));
+
+    point f = malloc(dim*sizeof(int));
+    for(int i = 0; i < dim; i++){
+      z[i] = -1;
+      f[i] = stringLast(m->S[i], c);
+    }
+    z[j] = stringLast(m->S[j], c);
+    f[j] = stringEnd(m->S[j]);
+
+
+    int top = m->lambda < m->cap ? m->lambda+1 : m->lambda;
+
+
+
+    int last = prefixSearch(m, f, 0, m->lambda+1);
+    if(last+1 < top)
+      top = last+1;
+    if(
+# 1096 "mlcs.c" 3 4
+      ((void *)0) 
+# 1096 "mlcs.c"
+           == m->X)
+      for(int r = 1; r <= top; r++)
+ appendLayer(m, j, c, r, z, f, p);
+    else if(0 < top)
+      appendLayers(m, j, c, top, z, f, p);
+
+    if(m->lambda < top && 0 < weightORT(m->PF[top]))
+       m->lambda++;
+
+    free(f);
+    free(z);
+    free(p);
+  }
+
+  stringAppend(S, c);
+
+  trimFronts(m);
+
+
+
+
+
+}
+
+
+
+void
+appendRun(mlcs m,
+   int j,
+   const char *s,
+   int len
+   )
+{
+  if(m->lazy){
+    lazyAppend(m, j, s, len);
+    paceMLCS(m, m->budget);
+    return;
+  }
+
+  string S = m->S[j] = stringOwn(m->S[j]);
+  if(0 < len && 0 == stringSize(S))
+    m->zeros--;
+
+  int sigma = stringSigma(S);
+
+  int lastOld[sigma];
+
+  char L[sigma];
+  int nL = 0;
+
+  for(int k = 0; k < sigma; k++)
+    lastOld[k] = -3;
+  for(int k = 0; k < len; k++){
+    if(-3 == lastOld[s[k]-'A']){
+      lastOld[s[k]-'A'] = stringLast(S, s[k]);
+      L[nL++] = s[k];
+    }
+  }
+
+  for(int k = 0; k < len; k++)
+    stringAppend(S, s[k]);
+
+  if(0 < len && 0 == m->zeros){
+    int dim = m->dim;
+
+    point p = malloc(dim*sizeof(int));
+
+    point z = malloc(dim*sizeof(int));
+
+    point f = malloc(dim*sizeof(int));
+
+    point g = malloc(dim*sizeof(int));
+    for(int i = 0; i < dim; i++){
+      g[i] = -1;
+      for(int l = 0; l < nL; l++)
+ if(g[i] < stringLast(m->S[i], L[l]))
+   g[i] = stringLast(m->S[i], L[l]);
+    }
+    g[j] = stringEnd(S);
+
+
+
+    for(int r = 0; r <= m->lambda && r < m->cap &&
+   dominatedFind(m->PF[r], g, p); r++){
+      growPF(m);
+      clearSK(m->K);
+
+      for(int l = 0; l < nL; l++){
+ char c = L[l];
+ for(int i = 0; i < dim; i++){
+   z[i] = -1;
+   f[i] = stringLast(m->S[i], c);
+ }
+
+ z[j] = lastOld[c-'A'];
+ f[j] = stringEnd(S);
+
+ int n;
+ point *T = rangeCollect(m->PF[r], z, f, &n);
+ for(int k = 0; k < n; k++){
+   succCandidate(m, m->PF[r+1], T[k], c, p);
+   free(T[k]);
+ }
+ if(
+# 1199 "mlcs.c" 3 4
+   ((void *)0) 
+# 1199 "mlcs.c"
+        != T)
+   free(T);
+      }
+
+      insertMinima(m, r+1, 
+# 1203 "mlcs.c" 3 4
+                          ((void *)0)
+# 1203 "mlcs.c"
+                              );
+
+      if(r == m->lambda && 0 < weightORT(m->PF[r+1]))
+ m->lambda++;
+    }
+
+    free(g);
+    free(f);
+    free(z);
+    free(p);
+  }
+
+  trimFronts(m);
+
+
+
+
+
+}
+
+
+
+
+void
+appendColumn(mlcs m,
+      const char *letters
+      )
+{
+  int dim = m->dim;
+  if(m->lazy){
+    for(int i = 0; i < dim; i++)
+      lazyAppend(m, i, &letters[i], 1);
+    paceMLCS(m, m->budget);
+    return;
+  }
+
+
+  int lastOld[dim];
+
+  for(int i = 0; i < dim; i++){
+    m->S[i] = stringOwn(m->S[i]);
+    lastOld[i] = stringLast(m->S[i], letters[i]);
+    if(0 == stringSize(m->S[i]))
+      m->zeros--;
+    stringAppend(m->S[i], letters[i]);
+  }
+
+
+  point p = malloc(dim*sizeof(int));
+
+  point z = malloc(dim*sizeof(int));
+
+  point f = malloc(dim*sizeof(int));
+
+
+
+  for(int l = 0; l < dim; l++){
+    f[l] = -1;
+    for(int i = 0; i < dim; i++)
+      if(f[l] < stringLast(m->S[l], letters[i]))
+ f[l] = stringLast(m->S[l], letters[i]);
+  }
+  int last = prefixSearch(m, f, 0, m->lambda+1);
+
+
+  for(int r = 0; r <= m->lambda && r < m->cap && r <= last; r++){
+    growPF(m);
+    clearSK(m->K);
+
+    for(int i = 0; i < dim; i++){
+      char c = letters[i];
+      int first = 1;
+      for(int l = 0; first && l < i; l++)
+ first = c != letters[l];
+
+      if(first){
+
+
+ for(int l = 0; l < dim; l++){
+   z[l] = -1;
+   f[l] = stringLast(m->S[l], c);
+ }
+ for(int l = i; l < dim; l++){
+   if(c == letters[l]){
+     z[l] = lastOld[l];
+     int n;
+     point *T = rangeCollect(m->PF[r], z, f, &n);
+     for(int k = 0; k < n; k++){
+       succCandidate(m, m->PF[r+1], T[k], c, p);
+       free(T[k]);
+     }
+     if(
+# 1294 "mlcs.c" 3 4
+       ((void *)0) 
+# 1294 "mlcs.c"
+            != T)
+       free(T);
+
+     z[l] = -1;
+     f[l] = lastOld[l];
+   }
+ }
+      }
+    }
+
+    insertMinima(m, r+1, 
+# 1304 "mlcs.c" 3 4
+                        ((void *)0)
+# 1304 "mlcs.c"
+                            );
+
+    if(r == m->lambda && 0 < weightORT(m->PF[r+1]))
+      m->lambda++;
+  }
+
+  free(f);
+  free(z);
+  free(p);
+
+  trimFronts(m);
+
+
+
+
+
+}
+
+
+
+mlcs
+buildMLCS(int dim,
+   int sigma,
+   char **S
+   )
+{
+  mlcs m = allocMLCS(dim, sigma);
+
+  for(int j = 0; j < dim; j++){
+    if('\0' != S[j][0])
+      m->zeros--;
+    for(int k = 0; '\0' != S[j][k]; k++)
+      stringAppend(m->S[j], S[j][k]);
+  }
+  buildFronts(m);
+
+
+
+
+
+
+  return m;
+}
+
+
+
+
+
+
+
+static int
+uncover(pointQueue M,
+ mlcs m,
+ char c,
+ int r,
+ int j,
+ int *pprev,
+ int *baseTop,
+ int *baseBot
+ )
+{
+  int dim = m->dim;
+  int seen = 0;
+
+  if(1 == r){
+    if(baseBot[j] > baseTop[j]){
+      point p = malloc(dim*sizeof(int));
+      memcpy(p, baseTop, dim*sizeof(int));
+
+      p[j] = stringCeil(m->S[j], c, p[j]+1);
+
+      plusPlus(p, dim);
+      int insertQ = 1 == countQ(m->PF[r], p);
+      minusMinus(p, dim);
+
+      if(insertQ){
+ frontInsert(m, r, p);
+ pushPQ(M, p);
+
+      } else
+ free(p);
+    }
+  } else {
+
+
+
+
+    int n;
+    point *slice = cornerCollect(m->PF[r-1], pprev, baseBot, baseTop, &n);
+    seen = n;
+    int Q[dim];
+    point q = Q;
+
+    for(int k = 0; k < n; k++){
+      for(int l = 0; l < dim; l++)
+ q[l] = stringCeil(m->S[l], c, slice[k][l]+1);
+      free(slice[k]);
+
+
+      int insertQ = 1;
+      for(int l = 0; insertQ && l < dim; l++)
+ insertQ = baseTop[l] == q[l];
+
+
+      insertQ = !insertQ;
+
+
+      plusPlus(q, dim);
+      insertQ = insertQ && (1 == countQ(m->PF[r], q));
+      minusMinus(q, dim);
+
+      if(insertQ){
+ point p = malloc(dim*sizeof(int));
+ memcpy(p, q, dim*sizeof(int));
+ frontInsert(m, r, p);
+ pushPQ(M, p);
+
+      }
+    }
+    free(slice);
+  }
+
+  return seen;
+}
+
+static void
+cleanCovered(pointQueue M,
+      mlcs m,
+      int r,
+      point p
+      )
+{
+  int dim = m->dim;
+
+  while(!isEmptyPQ(M)){
+    memcpy(p, topPQ(M), dim*sizeof(int));
+
+    plusPlus(p, dim);
+    if(1 < countQ(m->PF[r], p))
+      frontDelete(m, r, topPQ(M));
+    free(topPQ(M));
+    popPQ(M);
+  }
+}
+
+
+
+
+
+
+static repair
+repairStart(mlcs m,
+     int j,
+     char a,
+     long budget
+     )
+{
+  string S = m->S[j];
+  int dim = m->dim;
+  repair R = malloc(sizeof(struct repair));
+
+  R->j = j;
+  R->a = a;
+  R->budget = budget;
+  R->work = 0;
+  R->r = 1;
+  R->stop = 0;
+
+  R->M = allocPQ();
+  expandPQ(R->M, stringSigma(S));
+  R->Q = allocPQ();
+
+  point p = R->p = malloc(dim*sizeof(int));
+  R->plI = malloc(dim*sizeof(int));
+  R->pprev = malloc(dim*sizeof(int));
+  R->z = 
+# 1479 "mlcs.c" 3 4
+        ((void *)0)
+# 1479 "mlcs.c"
+            ;
+  R->f = 
+# 1480 "mlcs.c" 3 4
+        ((void *)0)
+# 1480 "mlcs.c"
+            ;
+  if(0 != a){
+    point z = R->z = malloc(dim*sizeof(int));
+    point f = R->f = malloc(dim*sizeof(int));
+    for(int i = 0; i < dim; i++){
+      z[i] = -1;
+      f[i] = stringLast(m->S[i], a);
+    }
+
+    if(stringBegin(S) < f[j])
+      z[j] = f[j];
+    f[j] = stringEnd(S);
+  }
+
+
+  char c = stringFstLetter(S);
+  int valid = 1;
+  for(int i = 0; valid && i < dim; i++){
+    p[i] = stringCeil(m->S[i], c, 0);
+    valid = 0 <= p[i];
+  }
+  if(valid){
+    pushPQ(R->Q, p);
+    markPQ(R->Q);
+    R->p = malloc(dim*sizeof(int));
+  }
+
+
+  return R;
+}
+
+
+
+
+
+
+
+static long
+repairRun(mlcs m,
+   repair R,
+   long limit
+   )
+{
+  long start = R->work;
+  int j = R->j;
+  char a = R->a;
+  string S = m->S[j];
+  int dim = m->dim;
+  int n ;
+  point *T = 
+# 1529 "mlcs.c" 3 4
+            ((void *)0)
+# 1529 "mlcs.c"
+                ;
+  pointQueue Q = R->Q;
+  pointQueue M = R->M;
+  point p = R->p;
+
+
+  while(!isEmptyPQ(Q) && !R->stop && R->work <= R->budget &&
+ R->work - start < limit){
+    if(markingTruePQ(Q)){
+      cleanCovered(M, m, R->r, p);
+      if(0 != a)
+ appendLayer(m, j, a, R->r, R->z, R->f, p);
+      R->r++;
+      markPQ(Q);
+
+      if(R->budget < R->work + R->work/(R->r-1)*(m->lambda+1-R->r)){
+ R->stop = 1;
+ break;
+      }
+    }
+    int r = R->r;
+
+
+    memcpy(p, topPQ(Q), dim*sizeof(int));
+    char c = stringLetter(S, p[j]);
+
+    for(int i = 0; i < dim; i++){
+      R->plI[i] = stringLast(m->S[i], c);
+      R->pprev[i] = stringFloor(m->S[i], c, p[i]-1);
+    }
+    R->work += uncover(M, m, c, r, j, R->pprev, p, R->plI);
+
+
+    n = 0;
+    if(r+1 < m->pfA && 
+# 1563 "mlcs.c" 3 4
+                      ((void *)0) 
+# 1563 "mlcs.c"
+                           != m->PF[r+1])
+      T = collect(m->PF[r+1], topPQ(Q), &n);
+    R->work += 1+n;
+
+
+    frontDelete(m, r, topPQ(Q));
+
+
+    for(int i = 0; i < n; i++){
+      if(0 == countQ(m->PF[r], T[i])){
+ pushPQ(Q, T[i]);
+ point q = malloc(dim*sizeof(int));
+ memcpy(q, T[i], dim*sizeof(int));
+ pushPQ(M, q);
+ frontInsert(m, r, T[i]);
+      } else
+ free(T[i]);
+    }
+    if(
+# 1581 "mlcs.c" 3 4
+      ((void *)0) 
+# 1581 "mlcs.c"
+           != T){
+      free(T);
+      T = 
+# 1583 "mlcs.c" 3 4
+         ((void *)0)
+# 1583 "mlcs.c"
+             ;
+    }
+
+
+    free(topPQ(Q));
+    popPQ(Q);
+  }
+
+  return R->work - start;
+}
+
+
+
+static int
+repairEnd(mlcs m,
+   repair R
+   )
+{
+  int done = isEmptyPQ(R->Q);
+  if(done){
+    cleanCovered(R->M, m, R->r, R->p);
+    if(0 != R->a)
+      for(; R->r <= m->lambda+1; R->r++)
+ appendLayer(m, R->j, R->a, R->r, R->z, R->f, R->p);
+  }
+  freeRepair(R);
+
+  return done;
+}
+
+
+
+
+
+static int
+popRepair(mlcs m,
+   int j,
+   char a,
+   long budget
+   )
+{
+  repair R = repairStart(m, j, a, budget);
+  repairRun(m, R, 0x7fffffffffffffffL);
+
+  return repairEnd(m, R);
+}
+
+
+
+
+
+static long
+rebuildWork(mlcs m
+     )
+{
+  double w = 0;
+  for(int j = 0; j < m->dim; j++)
+    w += stringSize(m->S[j]);
+  double c = 4 + stringSigma(m->S[0]);
+  for(int r = 1; r <= m->lambda; r++)
+    w += c*weightORT(m->PF[r]);
+
+  return 2.0*w;
+}
+
+
+
+static void
+switchRebuild(mlcs m,
+       int repaired
+       )
+{
+  if(repaired)
+    m->repairs++;
+  else {
+    m->rebuilds++;
+    rebuildMLCS(m);
+  }
+}
+
+
+
+static void
+repairDone(mlcs m
+    )
+{
+  repair R = m->job;
+  int j = R->j;
+
+  m->job = 
+# 1672 "mlcs.c" 3 4
+          ((void *)0)
+# 1672 "mlcs.c"
+              ;
+  repairEnd(m, R);
+  if(0 == weightORT(m->PF[m->lambda]))
+    m->lambda--;
+  stringPop(m->S[j]);
+  m->pops[j]--;
+  switchRebuild(m, 1);
+
+
+
+
+
+}
+
+
+static void
+finishRepair(mlcs m
+      )
+{
+  if(
+# 1691 "mlcs.c" 3 4
+    ((void *)0) 
+# 1691 "mlcs.c"
+         != m->job){
+    repairRun(m, m->job, 0x7fffffffffffffffL);
+    repairDone(m);
+  }
+}
+
+
+
+
+void
+rebaseMLCS(mlcs m
+    )
+{
+  int dim = m->dim;
+  int off[dim];
+  int moves = 0;
+
+  finishRepair(m);
+  for(int i = 0; i < dim; i++){
+    off[i] = stringBegin(m->S[i]);
+    moves = moves || 0 < off[i];
+  }
+
+  if(moves){
+    for(int i = 0; i < dim; i++){
+      if(0 < off[i]){
+ m->S[i] = stringOwn(m->S[i]);
+ stringRebase(m->S[i], off[i]);
+      }
+    }
+    for(int r = 1; r < m->pfA; r++)
+      if(
+# 1722 "mlcs.c" 3 4
+        ((void *)0) 
+# 1722 "mlcs.c"
+             != m->PF[r])
+ rebaseORT(m->PF[r], off);
+    if(
+# 1724 "mlcs.c" 3 4
+      ((void *)0) 
+# 1724 "mlcs.c"
+           != m->X){
+      int O[dim];
+      point o = O;
+      int offX[dim+1];
+      for(int i = 0; i < dim; i++){
+ o[i] = -1;
+ offX[i] = off[i];
+      }
+      offX[dim] = 0;
+      indexPoint(m, 0, o, -1);
+      rebaseORT(m->X, offX);
+      indexPoint(m, 0, o, 1);
+    }
+    if(
+# 1737 "mlcs.c" 3 4
+      ((void *)0) 
+# 1737 "mlcs.c"
+           != m->feed)
+      m->feed(m->feedArg, 0, off, dim, 0);
+  }
+
+
+
+
+
+}
+
+
+
+
+static void
+keepBase(mlcs m,
+  int j
+  )
+{
+  if(1073741824 <= stringBegin(m->S[j]))
+    rebaseMLCS(m);
+}
+
+
+
+
+
+
+void
+paceMLCS(mlcs m,
+  long work
+  )
+{
+  int dim = m->dim;
+  int lazy = m->lazy;
+  m->lazy = 0;
+
+  while(0 < work){
+    if(
+# 1774 "mlcs.c" 3 4
+      ((void *)0) 
+# 1774 "mlcs.c"
+           != m->job){
+      work -= repairRun(m, m->job, work);
+      if(isEmptyPQ(m->job->Q)){
+ int j = m->job->j;
+ repairDone(m);
+ keepBase(m, j);
+      }
+    } else {
+      int j = 0;
+      while(j < dim && 0 == m->pops[j])
+ j++;
+      if(j < dim){
+ if(0 == m->lambda || m->lambda == m->cap || 0 < m->beam){
+
+   m->pops[j]--;
+   pop(m, j);
+   work -= 1+m->lambda;
+ } else {
+   string S = m->S[j] = stringOwn(m->S[j]);
+   if(1 == stringSize(S))
+     m->zeros++;
+   m->job = repairStart(m, j, 0, 0x7fffffffffffffffL);
+ }
+      } else {
+ j = 0;
+ while(j < dim && 0 == stringSize(m->P[j]))
+   j++;
+ if(j == dim)
+   break;
+ char c = stringFstLetter(m->P[j]);
+ m->P[j] = stringOwn(m->P[j]);
+ stringPop(m->P[j]);
+ append(m, j, c);
+ work -= 1+m->lambda;
+      }
+    }
+  }
+
+  m->lazy = lazy;
+}
+
+
+
+
+static void
+flushMLCS(mlcs m
+   )
+{
+  if(m->lazy){
+    finishRepair(m);
+    int replay = 0;
+    int n = 0;
+    for(int j = 0; j < m->dim; j++){
+      replay += 32*m->pops[j] + stringSize(m->P[j]);
+      n += stringSize(m->S[j]) - m->pops[j] + stringSize(m->P[j]);
+    }
+
+    m->lazy = 0;
+    if(3*m->dim*replay < n){
+      for(int j = 0; j < m->dim; j++){
+ if(m->pops[j] < 16)
+   for(int k = 0; k < m->pops[j]; k++)
+     pop(m, j);
+ else
+   popMany(m, j, m->pops[j]);
+ m->pops[j] = 0;
+      }
+      for(int j = 0; j < m->dim; j++){
+ int a = stringSize(m->P[j]);
+ if(0 < a){
+   char *W = stringGet(m->P[j]);
+   appendRun(m, j, W, a);
+   free(W);
+   m->P[j] = stringOwn(m->P[j]);
+   stringPopMany(m->P[j], a);
+ }
+      }
+    } else
+      rebuildMLCS(m);
+    m->lazy = 1;
+  }
+}
+
+void
+lazyMLCS(mlcs m,
+  int lazy
+  )
+{
+  flushMLCS(m);
+  m->lazy = lazy;
+  m->budget = 0;
+}
+
+
+
+
+
+
+void
+budgetMLCS(mlcs m,
+    long work
+    )
+{
+  flushMLCS(m);
+  m->budget = work;
+  m->lazy = 0 < work;
+}
+
+string
+pullString(mlcs m,
+    int t
+   )
+{
+  flushMLCS(m);
+  return m->S[t];
+}
+
+
+
+mlcs
+forkMLCS(mlcs m
+  )
+{
+  int dim = m->dim;
+  finishRepair(m);
+  mlcs r = malloc(sizeof(struct mlcs));
+  memcpy(r, m, sizeof(struct mlcs));
+
+  r->S = calloc(dim, sizeof(string));
+  r->P = calloc(dim, sizeof(string));
+  r->pops = calloc(dim, sizeof(int));
+  for(int i = 0; i < dim; i++){
+    r->S[i] = stringShare(m->S[i]);
+    r->P[i] = stringShare(m->P[i]);
+    r->pops[i] = m->pops[i];
+  }
+
+  r->PF = calloc(r->pfA, sizeof(ort));
+  for(int j = 0; j < r->pfA; j++)
+    if(
+# 1913 "mlcs.c" 3 4
+      ((void *)0) 
+# 1913 "mlcs.c"
+           != m->PF[j])
+      r->PF[j] = forkORT(m->PF[j]);
+  r->feed = 
+# 1915 "mlcs.c" 3 4
+           ((void *)0)
+# 1915 "mlcs.c"
+               ;
+  r->feedArg = 
+# 1916 "mlcs.c" 3 4
+              ((void *)0)
+# 1916 "mlcs.c"
+                  ;
+  if(
+# 1917 "mlcs.c" 3 4
+    ((void *)0) 
+# 1917 "mlcs.c"
+         != m->X)
+    r->X = forkORT(m->X);
+  r->K = allocSK(dim);
+
+  return r;
+}
+
+
+void
+pop(mlcs m,
+    int j
+    )
+{
+  
+# 1930 "mlcs.c" 3 4
+ ((void) (0))
+# 1930 "mlcs.c"
+                                                               ;
+  if(m->lazy){
+    lazyPop(m, j, 1);
+    paceMLCS(m, m->budget);
+    return;
+  }
+
+  if(m->lambda == m->cap || 0 < m->beam){
+
+    popMany(m, j, 1);
+    return;
+  }
+
+  string S = m->S[j] = stringOwn(m->S[j]);
+  if(1 == stringSize(S))
+    m->zeros++;
+
+  int repaired = 1;
+  if(0 < m->lambda){
+    repaired = popRepair(m, j, 0, rebuildWork(m));
+
+    if(repaired && 0 == weightORT(m->PF[m->lambda]))
+      m->lambda--;
+  }
+
+  stringPop(S);
+  switchRebuild(m, repaired);
+  keepBase(m, j);
+
+
+
+
+
+}
+
+
+
+
+void
+shift(mlcs m,
+      int j,
+      char c
+      )
+{
+  
+# 1974 "mlcs.c" 3 4
+ ((void) (0))
+# 1974 "mlcs.c"
+                                                               ;
+  if(m->lazy){
+    lazyPop(m, j, 1);
+    lazyAppend(m, j, &c, 1);
+    paceMLCS(m, m->budget);
+    return;
+  }
+
+  if(m->lambda == m->cap || 0 < m->beam){
+
+    popMany(m, j, 1);
+    append(m, j, c);
+    return;
+  }
+
+  string S = m->S[j] = stringOwn(m->S[j]);
+  
+# 1990 "mlcs.c" 3 4
+ ((void) (0))
+# 1990 "mlcs.c"
+                                                         ;
+
+  int repaired = 1;
+  if(0 == m->zeros){
+    growPF(m);
+    repaired = popRepair(m, j, c, rebuildWork(m));
+
+    if(repaired){
+      if(0 < weightORT(m->PF[m->lambda+1]))
+ m->lambda++;
+      else if(0 == weightORT(m->PF[m->lambda]))
+ m->lambda--;
+    }
+  }
+
+  stringShift(S, c);
+  switchRebuild(m, repaired);
+  keepBase(m, j);
+
+
+
+
+
+}
+
+
+
+
+
+void
+popMany(mlcs m,
+ int j,
+ int k
+ )
+{
+  
+# 2025 "mlcs.c" 3 4
+ ((void) (0))
+# 2025 "mlcs.c"
+                                                               ;
+  if(m->lazy){
+    lazyPop(m, j, k);
+    paceMLCS(m, m->budget);
+    return;
+  }
+
+  string S = m->S[j] = stringOwn(m->S[j]);
+  
+# 2033 "mlcs.c" 3 4
+ ((void) (0))
+# 2033 "mlcs.c"
+                                                                          ;
+  if(0 < k && k == stringSize(S))
+    m->zeros++;
+
+  stringPopMany(S, k);
+
+  if(0 < k && 0 < m->lambda){
+    int dim = m->dim;
+    int sigma = stringSigma(S);
+    int n;
+    point *T;
+
+
+    point p = malloc(dim*sizeof(int));
+
+    point lo = malloc(dim*sizeof(int));
+    point hi = malloc(dim*sizeof(int));
+
+
+    int nR = 0;
+    int nRp = 0;
+    int Ra = 1;
+    point *R = malloc(Ra*sizeof(point));
+    point *Rp = malloc(Ra*sizeof(point));
+    pointHash H = allocPH(dim);
+    pointHash Hp = allocPH(dim);
+
+
+    pointQueue A = allocPQ();
+
+    point o = malloc(dim*sizeof(int));
+    for(int i = 0; i < dim; i++)
+      o[i] = -1;
+    pushPQ(A, o);
+
+    for(int r = 1; r <= m->lambda && (0 < nRp || !isEmptyPQ(A)); r++){
+
+      if(1 == r){
+ for(int i = 0; i < dim; i++){
+   lo[i] = -1;
+   hi[i] = stringEnd(m->S[i]);
+ }
+ hi[j] = stringBegin(S);
+ T = rangeCollect(m->PF[r], lo, hi, &n);
+      } else {
+ n = 0;
+ T = 
+# 2079 "mlcs.c" 3 4
+    ((void *)0)
+# 2079 "mlcs.c"
+        ;
+ for(int l = 0; l < nRp; l++){
+   int nT;
+   point *U = collect(m->PF[r], Rp[l], &nT);
+   T = realloc(T, (n+nT)*sizeof(point));
+   for(int t = 0; t < nT; t++){
+     if(!containsPH(H, U[t]) &&
+        0 == countQ(m->PF[r-1], U[t])){
+       insertPH(H, U[t]);
+       T[n++] = U[t];
+     } else
+       free(U[t]);
+   }
+   free(U);
+ }
+      }
+
+
+      nR = 0;
+      for(int l = 0; l < n; l++){
+ if(1 == r)
+   insertPH(H, T[l]);
+ if(nR == Ra){
+   Ra *= 2;
+   R = realloc(R, Ra*sizeof(point));
+   Rp = realloc(Rp, Ra*sizeof(point));
+ }
+ R[nR++] = T[l];
+ frontDelete(m, r, T[l]);
+      }
+      if(
+# 2109 "mlcs.c" 3 4
+        ((void *)0) 
+# 2109 "mlcs.c"
+             != T)
+ free(T);
+
+      clearSK(m->K);
+
+
+      while(!isEmptyPQ(A)){
+ if(0 < m->beam)
+   removeCovered(m, r-1, topPQ(A));
+ char c = 'A';
+ for(int l = 0; l < sigma; l++, c++)
+   succCandidate(m, m->PF[r], topPQ(A), c, p);
+ free(topPQ(A));
+ popPQ(A);
+      }
+
+
+      for(int l = 0; l < nR; l++){
+ char c = 'A';
+ for(int t = 0; t < sigma; t++, c++){
+   int valid = 1;
+   for(int i = 0; valid && i < dim; i++){
+
+     lo[i] = stringFloor(m->S[i], c, R[l][i]-1);
+     hi[i] = stringLast(m->S[i], c);
+     valid = -2 != hi[i];
+   }
+   if(valid){
+     int nT;
+     point *U = rangeCollect(m->PF[r-1], lo, hi, &nT);
+     for(int u = 0; u < nT; u++){
+       succCandidate(m, m->PF[r], U[u], c, p);
+       free(U[u]);
+     }
+     if(
+# 2143 "mlcs.c" 3 4
+       ((void *)0) 
+# 2143 "mlcs.c"
+            != U)
+       free(U);
+   }
+ }
+      }
+
+      insertMinima(m, r, A);
+
+      if(0 < m->beam){
+
+
+ int nV;
+ point *V = evictWorst(m->PF[r], m->beam, m->score, &nV);
+ frontRemoved(m, r, V, nV);
+ for(int l = 0; l < nV; l++){
+   if(findSK(m->K, V[l]))
+     free(V[l]);
+   else {
+     insertPH(H, V[l]);
+     if(nR == Ra){
+       Ra *= 2;
+       R = realloc(R, Ra*sizeof(point));
+       Rp = realloc(Rp, Ra*sizeof(point));
+     }
+     R[nR++] = V[l];
+   }
+ }
+ if(
+# 2170 "mlcs.c" 3 4
+   ((void *)0) 
+# 2170 "mlcs.c"
+        != V)
+   free(V);
+
+ pointQueue K = allocPQ();
+ while(0 < nV && !isEmptyPQ(A)){
+   if(containsQ(m->PF[r], topPQ(A)))
+     pushPQ(K, topPQ(A));
+   else
+     free(topPQ(A));
+   popPQ(A);
+ }
+ while(!isEmptyPQ(K)){
+   pushPQ(A, topPQ(K));
+   popPQ(K);
+ }
+ freePQ(K);
+      }
+
+
+      point *tR = Rp;
+      Rp = R;
+      R = tR;
+      nRp = nR;
+      pointHash tH = Hp;
+      Hp = H;
+      H = tH;
+      freePH(H);
+      H = allocPH(dim);
+    }
+
+    while(!isEmptyPQ(A)){
+      if(0 < m->beam)
+ removeCovered(m, m->lambda, topPQ(A));
+      free(topPQ(A));
+      popPQ(A);
+    }
+    freePQ(A);
+    freePH(Hp);
+    freePH(H);
+    free(Rp);
+    free(R);
+
+    while(0 < m->lambda && 0 == weightORT(m->PF[m->lambda]))
+      m->lambda--;
+
+    free(hi);
+    free(lo);
+    free(p);
+  }
+
+  trimFronts(m);
+  keepBase(m, j);
+
+
+
+
+
+}
+
+
+
+
+
+
+void
+prepend(mlcs m,
+ int j,
+ char c
+ )
+{
+  
+# 2240 "mlcs.c" 3 4
+ ((void) (0))
+# 2240 "mlcs.c"
+                                                               ;
+
+
+  if(m->lazy && 0 < m->pops[j] &&
+     !(
+# 2244 "mlcs.c" 3 4
+      ((void *)0) 
+# 2244 "mlcs.c"
+           != m->job && j == m->job->j && 1 == m->pops[j]) &&
+     c == stringLetter(m->S[j], stringBegin(m->S[j])+m->pops[j]-1)){
+    m->pops[j]--;
+    return;
+  }
+
+  int lazy = m->lazy;
+  flushMLCS(m);
+  m->lazy = 0;
+
+  if(0 == stringSize(m->S[j]))
+    append(m, j, c);
+  else {
+
+
+    if(0 == stringBegin(m->S[j]))
+      rebuildMLCS(m);
+
+    string S = m->S[j] = stringOwn(m->S[j]);
+    stringPrepend(S, c);
+
+    if(0 == m->zeros){
+      int dim = m->dim;
+      int sigma = stringSigma(S);
+
+      point p = malloc(dim*sizeof(int));
+
+      point o = malloc(dim*sizeof(int));
+      for(int i = 0; i < dim; i++)
+ o[i] = -1;
+
+
+      pointQueue D = allocPQ();
+      growPF(m);
+      clearSK(m->K);
+      succCandidate(m, m->PF[1], o, c, p);
+
+      for(int r = 1; 0 < sizeSK(m->K); r++){
+ insertMinima(m, r, D);
+ if(r == m->lambda+1)
+   m->lambda++;
+ growPF(m);
+
+ clearSK(m->K);
+ while(!isEmptyPQ(D)){
+   point q = topPQ(D);
+
+
+   removeCovered(m, r, q);
+
+   char a = 'A';
+   for(int l = 0; r < m->cap && l < sigma; l++, a++)
+     succCandidate(m, m->PF[r+1], q, a, p);
+   free(q);
+   popPQ(D);
+ }
+      }
+
+      freePQ(D);
+      free(o);
+      free(p);
+    }
+  }
+
+  m->lazy = lazy;
+
+  trimFronts(m);
+
+
+
+
+
+}
+
+
+
+
+static void
+cutBack(mlcs m,
+ int j,
+ int k
+ )
+{
+  string S = m->S[j] = stringOwn(m->S[j]);
+  
+# 2328 "mlcs.c" 3 4
+ ((void) (0))
+# 2328 "mlcs.c"
+                                                                          ;
+  if(0 < k && k == stringSize(S))
+    m->zeros++;
+
+  int dim = m->dim;
+  int n;
+
+  int L[dim];
+  point lo = L;
+  int H[dim];
+  point hi = H;
+  for(int i = 0; i < dim; i++){
+    lo[i] = -1;
+    hi[i] = stringEnd(m->S[i]);
+  }
+  lo[j] = stringEnd(S)-k;
+
+  for(int r = 1; 0 < k && r <= m->lambda; r++){
+    point *T = rangeCollect(m->PF[r], lo, hi, &n);
+    for(int l = 0; l < n; l++){
+      frontDelete(m, r, T[l]);
+      free(T[l]);
+    }
+    if(
+# 2351 "mlcs.c" 3 4
+      ((void *)0) 
+# 2351 "mlcs.c"
+           != T)
+      free(T);
+  }
+
+  while(0 < m->lambda && 0 == weightORT(m->PF[m->lambda]))
+    m->lambda--;
+
+  for(int l = 0; l < k; l++)
+    stringPopBack(S);
+}
+
+
+void
+popBack(mlcs m,
+ int j
+ )
+{
+  
+# 2368 "mlcs.c" 3 4
+ ((void) (0))
+# 2368 "mlcs.c"
+                                                               ;
+  if(m->lazy && 0 < stringSize(m->P[j])){
+    m->P[j] = stringOwn(m->P[j]);
+    stringPopBack(m->P[j]);
+    return;
+  }
+
+  int lazy = m->lazy;
+  flushMLCS(m);
+  m->lazy = 0;
+
+  
+# 2379 "mlcs.c" 3 4
+ ((void) (0))
+# 2379 "mlcs.c"
+                                                                   ;
+  cutBack(m, j, 1);
+  m->lazy = lazy;
+
+
+
+
+
+}
+# 2396 "mlcs.c"
+static void
+sweepSuffix(mlcs m,
+     int j,
+     int x
+     )
+{
+  int dim = m->dim;
+  int sigma = stringSigma(m->S[j]);
+
+  point p = malloc(dim*sizeof(int));
+
+  int L[dim];
+  point lo = L;
+  int H[dim];
+  point hi = H;
+
+  for(int r = 1; r <= m->lambda+1 && r <= m->cap; r++){
+    growPF(m);
+    clearSK(m->K);
+    char c = 'A';
+    for(int t = 0; t < sigma; t++, c++){
+      int valid = 1;
+      for(int i = 0; valid && i < dim; i++){
+ lo[i] = -1;
+ hi[i] = stringLast(m->S[i], c);
+ valid = -2 != hi[i];
+      }
+      if(valid && x <= hi[j]){
+ lo[j] = stringFloor(m->S[j], c, x-1);
+ int n;
+ point *T = rangeCollect(m->PF[r-1], lo, hi, &n);
+ for(int l = 0; l < n; l++){
+   succCandidate(m, m->PF[r], T[l], c, p);
+   free(T[l]);
+ }
+ if(
+# 2431 "mlcs.c" 3 4
+   ((void *)0) 
+# 2431 "mlcs.c"
+        != T)
+   free(T);
+      }
+    }
+
+    insertMinima(m, r, 
+# 2436 "mlcs.c" 3 4
+                      ((void *)0)
+# 2436 "mlcs.c"
+                          );
+    if(r == m->lambda+1 && 0 < weightORT(m->PF[r]))
+      m->lambda++;
+  }
+
+  free(p);
+}
+
+
+
+
+
+static void
+editMLCS(mlcs m,
+  int j,
+  int pos,
+  int del,
+  char c
+  )
+{
+  
+# 2456 "mlcs.c" 3 4
+ ((void) (0))
+# 2456 "mlcs.c"
+                                                               ;
+  string S = m->S[j];
+  int n = stringSize(S) - m->pops[j];
+  int lazy = m->lazy;
+  int pending = lazy && n <= pos;
+
+  if(pending){
+    S = m->P[j] = stringOwn(m->P[j]);
+    pos -= n;
+  } else {
+    flushMLCS(m);
+    m->lazy = 0;
+    S = m->S[j];
+  }
+  
+# 2470 "mlcs.c" 3 4
+ ((void) (0))
+# 2470 "mlcs.c"
+                                                                              ;
+
+  int k = stringSize(S) - pos;
+  char *W = malloc((k+1)*sizeof(char));
+  int l = 0;
+  if(0 != c)
+    W[l++] = c;
+  for(int i = stringBegin(S)+pos+del; i < stringEnd(S); i++)
+    W[l++] = stringLetter(S, i);
+
+  if(pending){
+    for(int i = 0; i < k; i++)
+      stringPopBack(S);
+    for(int i = 0; i < l; i++)
+      stringAppend(S, W[i]);
+  } else {
+    cutBack(m, j, k);
+    S = m->S[j];
+    if(0 < l && 0 == stringSize(S))
+      m->zeros--;
+    for(int i = 0; i < l; i++)
+      stringAppend(S, W[i]);
+    if(0 < l && 0 == m->zeros)
+      sweepSuffix(m, j, stringEnd(S)-l);
+    trimFronts(m);
+  }
+
+  free(W);
+  m->lazy = lazy;
+
+
+
+
+
+}
+
+
+void
+editInsert(mlcs m,
+    int j,
+    int pos,
+    char c
+    )
+{
+  editMLCS(m, j, pos, 0, c);
+}
+
+
+void
+editDelete(mlcs m,
+    int j,
+    int pos
+    )
+{
+  editMLCS(m, j, pos, 1, 0);
+}
+
+
+void
+editSubstitute(mlcs m,
+        int j,
+        int pos,
+        char c
+        )
+{
+  editMLCS(m, j, pos, 1, c);
+}
+
+
+
+static void
+resizeMLCS(mlcs m,
+    int dim
+    )
+{
+  int indexed = 
+# 2545 "mlcs.c" 3 4
+               ((void *)0) 
+# 2545 "mlcs.c"
+                    != m->X;
+  
+# 2546 "mlcs.c" 3 4
+ ((void) (0))
+# 2546 "mlcs.c"
+                                                    ;
+  indexMLCS(m, 0);
+  for(int r = 0; r < m->pfA; r++)
+    if(
+# 2549 "mlcs.c" 3 4
+      ((void *)0) 
+# 2549 "mlcs.c"
+           != m->PF[r])
+      freeFront(m, r);
+  m->lambda = 0;
+  m->dim = dim;
+  freeSK(m->K);
+  m->K = allocSK(dim);
+
+  point p = malloc(dim*sizeof(int));
+  for(int i = 0; i < dim; i++)
+    p[i] = -1;
+  m->PF[0] = allocORT(dim);
+  insert(m->PF[0], p);
+  free(p);
+
+  int lazy = m->lazy;
+  m->lazy = 0;
+  rebuildMLCS(m);
+  m->lazy = lazy;
+  indexMLCS(m, indexed);
+
+
+
+
+
+}
+
+
+
+
+void
+addString(mlcs m,
+   const char *s
+   )
+{
+  int dim = m->dim+1;
+  int sigma = stringSigma(m->S[0]);
+
+  finishRepair(m);
+  m->S = realloc(m->S, dim*sizeof(string));
+  m->P = realloc(m->P, dim*sizeof(string));
+  m->pops = realloc(m->pops, dim*sizeof(int));
+  m->S[dim-1] = stringAlloc(sigma);
+  m->P[dim-1] = stringAlloc(sigma);
+  m->pops[dim-1] = 0;
+  for(int k = 0; '\0' != s[k]; k++)
+    stringAppend(m->P[dim-1], s[k]);
+
+  resizeMLCS(m, dim);
+}
+
+
+
+
+void
+removeString(mlcs m,
+      int j
+      )
+{
+  
+# 2607 "mlcs.c" 3 4
+ ((void) (0))
+# 2607 "mlcs.c"
+                                                                       ;
+  int dim = m->dim-1;
+
+  finishRepair(m);
+  stringFree(m->S[j]);
+  stringFree(m->P[j]);
+  for(int i = j; i < dim; i++){
+    m->S[i] = m->S[i+1];
+    m->P[i] = m->P[i+1];
+    m->pops[i] = m->pops[i+1];
+  }
+
+  resizeMLCS(m, dim);
+}
+
+int
+mlcsSize(mlcs m
+  )
+{
+  flushMLCS(m);
+  return m->lambda;
+
+}
+
+int
+reachesThreshold(mlcs m
+   )
+{
+  flushMLCS(m);
+  return m->lambda == m->cap;
+}
+
+int
+mlcsPrefix(mlcs m,
+    int *q
+    )
+{
+  int A[m->dim];
+  point x = A;
+
+  flushMLCS(m);
+  prefixCorner(m, q, x);
+  return prefixSearch(m, x, 0, m->lambda+1);
+}
+
+void
+mlcsPrefixBatch(mlcs m,
+  int n,
+  int *q,
+  int *out
+  )
+{
+  int dim = m->dim;
+  int A[dim];
+  point x = A;
+
+  flushMLCS(m);
+  for(int k = 0; k < n; k++){
+    int lo = 0;
+    int hi = m->lambda+1;
+    if(0 < k){
+      int up = 1;
+      int down = 1;
+      for(int i = 0; i < dim; i++){
+ up = up && q[(k-1)*dim+i] <= q[k*dim+i];
+ down = down && q[k*dim+i] <= q[(k-1)*dim+i];
+      }
+      if(up)
+ lo = out[k-1];
+      if(down)
+ hi = out[k-1]+1;
+    }
+    prefixCorner(m, &q[k*dim], x);
+    out[k] = prefixSearch(m, x, lo, hi);
+  }
+}
+
+
+static int
+windowCmp(const void *pp,
+   const void *qq
+   )
+{
+  const long *p = pp;
+  const long *q = qq;
+
+  for(int i = 0; i < 3; i++)
+    if(p[i] != q[i])
+      return p[i] < q[i] ? -1 : 1;
+
+  return 0;
+}
+
+
+
+
+
+
+
+void
+mlcsWindowBatch(int dim,
+  int sigma,
+  char **W,
+  int n,
+  int *s,
+  int *e,
+  int *out
+  )
+{
+  int cs[dim];
+  int ce[dim];
+
+  long *O = malloc(3*n*sizeof(long));
+  for(int k = 0; k < n; k++){
+    O[3*k] = 0;
+    O[3*k+1] = 0;
+    O[3*k+2] = k;
+    for(int i = 0; i < dim; i++){
+      
+# 2725 "mlcs.c" 3 4
+     ((void) (0))
+                                                                
+# 2726 "mlcs.c"
+                                                               ;
+      O[3*k] += s[k*dim+i];
+      O[3*k+1] += e[k*dim+i];
+    }
+  }
+  qsort(O, n, 3*sizeof(long), windowCmp);
+
+  mlcs w = 
+# 2733 "mlcs.c" 3 4
+          ((void *)0)
+# 2733 "mlcs.c"
+              ;
+  for(int l = 0; l < n; l++){
+    int k = O[3*l+2];
+    int *a = &s[k*dim];
+    int *b = &e[k*dim];
+    int forward = 
+# 2738 "mlcs.c" 3 4
+                 ((void *)0) 
+# 2738 "mlcs.c"
+                      != w;
+    double moves = 0;
+    long size = 0;
+    for(int i = 0; forward && i < dim; i++){
+      forward = cs[i] <= a[i] && ce[i] <= b[i];
+      moves += 160.0*(a[i]-cs[i]) + b[i]-ce[i];
+      size += b[i]-a[i];
+    }
+
+    if(!forward || size < moves){
+      char *V[dim];
+      for(int i = 0; i < dim; i++){
+ V[i] = malloc((b[i]-a[i]+1)*sizeof(char));
+ memcpy(V[i], &W[i][a[i]], (b[i]-a[i])*sizeof(char));
+ V[i][b[i]-a[i]] = '\0';
+      }
+      if(
+# 2754 "mlcs.c" 3 4
+        ((void *)0) 
+# 2754 "mlcs.c"
+             != w)
+ freeMLCS(w);
+      w = buildMLCS(dim, sigma, V);
+      for(int i = 0; i < dim; i++)
+ free(V[i]);
+    } else {
+
+      for(int i = 0; i < dim; i++)
+ if(ce[i] < b[i])
+   appendRun(w, i, &W[i][ce[i]], b[i]-ce[i]);
+      for(int i = 0; i < dim; i++)
+ if(cs[i] < a[i])
+   popMany(w, i, a[i]-cs[i]);
+    }
+
+    for(int i = 0; i < dim; i++){
+      cs[i] = a[i];
+      ce[i] = b[i];
+    }
+    out[k] = mlcsSize(w);
+  }
+
+  if(
+# 2776 "mlcs.c" 3 4
+    ((void *)0) 
+# 2776 "mlcs.c"
+         != w)
+    freeMLCS(w);
+  free(O);
+}
+
+
+static int
+boundCmp(const void *pp,
+  const void *qq
+  )
+{
+  const long *p = pp;
+  const long *q = qq;
+
+  if(p[0] != q[0])
+    return p[0] > q[0] ? -1 : 1;
+
+  return p[1] < q[1] ? -1 : (p[1] > q[1]);
+}
+
+
+
+static int
+pairBound(int dim,
+   int sigma,
+   char **W,
+   char **T,
+   int o,
+   int width
+   )
+{
+  int u = 0x7fffffff;
+
+  for(int i = 0; i < dim; i++){
+    memcpy(T[i], &W[i][o], width*sizeof(char));
+    T[i][width] = '\0';
+  }
+  for(int i = 0; i < dim; i++)
+    for(int j = i+1; j < dim; j++){
+      char *P[2] = {T[i], T[j]};
+      int l = naiveMLCS(2, P, sigma);
+      u = l < u ? l : u;
+    }
+
+  return u;
+}
+# 2835 "mlcs.c"
+int
+mlcsMaxWindow(int dim,
+       int sigma,
+       char **W,
+       int width,
+       int *offset
+       )
+{
+  int L = 0x7fffffff;
+  for(int i = 0; i < dim; i++){
+    int l = strlen(W[i]);
+    L = l < L ? l : L;
+  }
+  
+# 2848 "mlcs.c" 3 4
+ ((void) (0))
+# 2848 "mlcs.c"
+                                                                   ;
+
+  int n = L-width+1;
+  int C[dim*sigma];
+  long *O = malloc(2*n*sizeof(long));
+  for(int k = 0; k < dim*sigma; k++)
+    C[k] = 0;
+  for(int i = 0; i < dim; i++)
+    for(int k = 0; k < width; k++)
+      C[i*sigma+W[i][k]-'A']++;
+
+  for(int o = 0; o < n; o++){
+    if(0 < o){
+      for(int i = 0; i < dim; i++){
+ C[i*sigma+W[i][o-1]-'A']--;
+ C[i*sigma+W[i][o+width-1]-'A']++;
+      }
+    }
+    O[2*o] = 0;
+    O[2*o+1] = o;
+    for(int c = 0; c < sigma; c++){
+      int f = C[c];
+      for(int i = 1; i < dim; i++)
+ f = C[i*sigma+c] < f ? C[i*sigma+c] : f;
+      O[2*o] += f;
+    }
+  }
+  qsort(O, n, 2*sizeof(long), boundCmp);
+
+  int K = 32;
+  int s[K*dim];
+  int e[K*dim];
+  int out[K];
+  int at[K];
+  char *T[dim];
+  for(int i = 0; i < dim; i++)
+    T[i] = malloc((width+1)*sizeof(char));
+
+  int best = -1;
+  *offset = 0;
+  for(int l = 0; l < n && best < O[2*l]; ){
+    int m = 0;
+    for(; m < K && l < n && best < O[2*l]; l++){
+      int o = O[2*l+1];
+      int u = pairBound(dim, sigma, W, T, o, width);
+      if(u <= best)
+ continue;
+      if(2 == dim){
+ best = u;
+ *offset = o;
+ continue;
+      }
+      for(int i = 0; i < dim; i++){
+ s[m*dim+i] = o;
+ e[m*dim+i] = o+width;
+      }
+      at[m++] = o;
+    }
+
+    mlcsWindowBatch(dim, sigma, W, m, s, e, out);
+    for(int k = 0; k < m; k++)
+      if(best < out[k]){
+ best = out[k];
+ *offset = at[k];
+      }
+  }
+
+  for(int i = 0; i < dim; i++)
+    free(T[i]);
+  free(O);
+
+  return best;
+}
+
+
+
+
+int
+mlcsWitness(mlcs m,
+     char *out,
+     int *positions
+     )
+{
+  int dim = m->dim;
+  int B[dim];
+  point x = B;
+
+  flushMLCS(m);
+  for(int i = 0; i < dim; i++)
+    x[i] = stringEnd(m->S[i]);
+
+  int r;
+  for(r = m->lambda; 0 < r && dominatedFind(m->PF[r], x, x); r--){
+    out[r-1] = stringLetter(m->S[0], x[0]);
+    if(
+# 2942 "mlcs.c" 3 4
+      ((void *)0) 
+# 2942 "mlcs.c"
+           != positions){
+      for(int i = 0; i < dim; i++)
+ positions[(r-1)*dim+i] = x[i]-stringBegin(m->S[i]);
+    }
+  }
+  
+# 2947 "mlcs.c" 3 4
+ ((void) (0))
+# 2947 "mlcs.c"
+                                            ;
+  out[m->lambda] = '\0';
+
+  return m->lambda;
+}
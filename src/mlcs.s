@@ -0,0 +1,11708 @@
+	.file	"mlcs.c"
+	.text
+	.p2align 4
+	.type	sumScore, @function
+sumScore:
+.LFB25:
+	.cfi_startproc
+	testl	%esi, %esi
+	jle	.L4
+	movslq	%esi, %rsi
+	pxor	%xmm0, %xmm0
+	leaq	(%rdi,%rsi,4), %rax
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	pxor	%xmm1, %xmm1
+	addq	$4, %rdi
+	cvtsi2sdl	-4(%rdi), %xmm1
+	addsd	%xmm1, %xmm0
+	cmpq	%rdi, %rax
+	jne	.L3
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	pxor	%xmm0, %xmm0
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	sumScore, .-sumScore
+	.p2align 4
+	.type	candCmp, @function
+candCmp:
+.LFB41:
+	.cfi_startproc
+	movl	sortDim(%rip), %edx
+	movq	(%rdi), %rcx
+	movq	(%rsi), %rsi
+	testl	%edx, %edx
+	js	.L11
+	xorl	%eax, %eax
+	jmp	.L10
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	addq	$1, %rax
+	cmpl	%eax, %edx
+	jl	.L11
+.L10:
+	movl	(%rsi,%rax,4), %edi
+	cmpl	%edi, (%rcx,%rax,4)
+	je	.L9
+	setge	%al
+	movzbl	%al, %eax
+	leal	-1(%rax,%rax), %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	xorl	%eax, %eax
+	ret
+	.cfi_endproc
+.LFE41:
+	.size	candCmp, .-candCmp
+	.p2align 4
+	.type	windowCmp, @function
+windowCmp:
+.LFB94:
+	.cfi_startproc
+	movq	(%rdi), %rax
+	movq	(%rsi), %rdx
+	cmpq	%rdx, %rax
+	jne	.L15
+	movq	8(%rdi), %rax
+	movq	8(%rsi), %rdx
+	cmpq	%rdx, %rax
+	jne	.L15
+	movq	16(%rdi), %rax
+	movq	16(%rsi), %rdx
+	xorl	%ecx, %ecx
+	cmpq	%rdx, %rax
+	jne	.L15
+	movl	%ecx, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	xorl	%ecx, %ecx
+	cmpq	%rax, %rdx
+	setle	%cl
+	leal	-1(%rcx,%rcx), %ecx
+	movl	%ecx, %eax
+	ret
+	.cfi_endproc
+.LFE94:
+	.size	windowCmp, .-windowCmp
+	.p2align 4
+	.type	freeRepair, @function
+freeRepair:
+.LFB30:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	jmp	.L20
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	movq	32(%rbx), %rdi
+	call	topPQ@PLT
+	movq	%rax, %rdi
+	call	free@PLT
+	movq	32(%rbx), %rdi
+	call	popPQ@PLT
+.L20:
+	movq	32(%rbx), %rdi
+	call	isEmptyPQ@PLT
+	testl	%eax, %eax
+	je	.L21
+	movq	40(%rbx), %rdi
+	call	isEmptyPQ@PLT
+	testl	%eax, %eax
+	jne	.L25
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	movq	40(%rbx), %rdi
+	call	topPQ@PLT
+	movq	%rax, %rdi
+	call	free@PLT
+	movq	40(%rbx), %rdi
+	call	popPQ@PLT
+	movq	40(%rbx), %rdi
+	call	isEmptyPQ@PLT
+	testl	%eax, %eax
+	je	.L23
+.L25:
+	movq	32(%rbx), %rdi
+	call	freePQ@PLT
+	movq	40(%rbx), %rdi
+	call	freePQ@PLT
+	movq	80(%rbx), %rdi
+	call	free@PLT
+	movq	72(%rbx), %rdi
+	call	free@PLT
+	movq	64(%rbx), %rdi
+	call	free@PLT
+	movq	56(%rbx), %rdi
+	call	free@PLT
+	movq	48(%rbx), %rdi
+	call	free@PLT
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT
+	.cfi_endproc
+.LFE30:
+	.size	freeRepair, .-freeRepair
+	.p2align 4
+	.type	rebuildWork, @function
+rebuildWork:
+.LFB64:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	movl	(%rdi), %edx
+	testl	%edx, %edx
+	jle	.L31
+	movq	$0x000000000, (%rsp)
+	xorl	%ebx, %ebx
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	movq	8(%rbp), %rax
+	movq	(%rax,%rbx,8), %rdi
+	addq	$1, %rbx
+	call	stringSize@PLT
+	pxor	%xmm0, %xmm0
+	cvtsi2sdl	%eax, %xmm0
+	addsd	(%rsp), %xmm0
+	movsd	%xmm0, (%rsp)
+	cmpl	%ebx, 0(%rbp)
+	jg	.L28
+.L27:
+	movq	8(%rbp), %rax
+	movq	(%rax), %rdi
+	call	stringSigma@PLT
+	pxor	%xmm4, %xmm4
+	addl	$4, %eax
+	cvtsi2sdl	%eax, %xmm4
+	movl	16(%rbp), %eax
+	movsd	%xmm4, 8(%rsp)
+	testl	%eax, %eax
+	jle	.L29
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	leaq	1(%rax), %rbx
+	movq	24(%rbp), %rax
+	movq	(%rax,%rbx,8), %rdi
+	call	weightORT@PLT
+	pxor	%xmm0, %xmm0
+	leal	1(%rbx), %edx
+	cvtsi2sdl	%eax, %xmm0
+	mulsd	8(%rsp), %xmm0
+	movq	%rbx, %rax
+	addsd	(%rsp), %xmm0
+	movsd	%xmm0, (%rsp)
+	cmpl	%edx, 16(%rbp)
+	jge	.L30
+.L29:
+	movsd	(%rsp), %xmm0
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	addsd	%xmm0, %xmm0
+	cvttsd2siq	%xmm0, %rax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.cfi_restore_state
+	movq	$0x000000000, (%rsp)
+	jmp	.L27
+	.cfi_endproc
+.LFE64:
+	.size	rebuildWork, .-rebuildWork
+	.p2align 4
+	.type	succCandidate, @function
+succCandidate:
+.LFB48:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movsbl	%cl, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%r8, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	xorl	%ebx, %ebx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movl	(%rdi), %r13d
+	movq	%rsi, 8(%rsp)
+	testl	%r13d, %r13d
+	jle	.L40
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	movl	(%r14,%rbx,4), %eax
+	movl	%r12d, %esi
+	leal	1(%rax), %edx
+	movq	8(%r15), %rax
+	movq	(%rax,%rbx,8), %rdi
+	call	stringCeil@PLT
+	leal	1(%rbx), %edx
+	cmpl	%r13d, %edx
+	movl	%eax, 0(%rbp,%rbx,4)
+	setl	%cl
+	cmpl	$-2, %eax
+	setne	%dl
+	addq	$1, %rbx
+	testb	%dl, %cl
+	jne	.L39
+	cmpl	$-2, %eax
+	jne	.L40
+.L35:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	.cfi_restore_state
+	movl	%r13d, %esi
+	movq	%rbp, %rdi
+	call	plusPlus@PLT
+	movq	8(%rsp), %rdi
+	movq	%rbp, %rsi
+	call	countQ@PLT
+	movl	%r13d, %esi
+	movq	%rbp, %rdi
+	movl	%eax, %ebx
+	call	minusMinus@PLT
+	testl	%ebx, %ebx
+	jne	.L35
+	movq	112(%r15), %rdi
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 56
+	movq	%rbp, %rsi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	addSK@PLT
+	.cfi_endproc
+.LFE48:
+	.size	succCandidate, .-succCandidate
+	.p2align 4
+	.type	repairStart, @function
+repairStart:
+.LFB60:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movslq	%esi, %rax
+	movl	%edx, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rax, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	movl	(%rdi), %r13d
+	movq	%rax, 40(%rsp)
+	movq	8(%rdi), %rax
+	movl	$88, %edi
+	movq	(%rax,%r12,8), %rax
+	movq	%rax, 16(%rsp)
+	call	malloc@PLT
+	movl	%r15d, 36(%rsp)
+	movq	%rax, %rbx
+	movl	%r12d, (%rax)
+	movb	%r15b, 4(%rax)
+	movq	%r14, 8(%rax)
+	movslq	%r13d, %r14
+	movq	$0, 16(%rax)
+	movq	.LC1(%rip), %rax
+	leaq	0(,%r14,4), %r15
+	movq	%rax, 24(%rbx)
+	call	allocPQ@PLT
+	movq	16(%rsp), %rdi
+	movq	%rax, 40(%rbx)
+	call	stringSigma@PLT
+	movq	40(%rbx), %rdi
+	movl	%eax, %esi
+	call	expandPQ@PLT
+	call	allocPQ@PLT
+	movq	%r15, %rdi
+	movq	%r15, 8(%rsp)
+	movq	%rax, 32(%rbx)
+	call	malloc@PLT
+	movq	%r15, %rdi
+	movq	%rax, 48(%rbx)
+	movq	%rax, %r12
+	call	malloc@PLT
+	movq	%r15, %rdi
+	movq	%rax, 56(%rbx)
+	call	malloc@PLT
+	cmpb	$0, 36(%rsp)
+	movq	$0, 72(%rbx)
+	movq	%rax, 64(%rbx)
+	movq	$0, 80(%rbx)
+	jne	.L62
+.L47:
+	movq	16(%rsp), %rdi
+	xorl	%r14d, %r14d
+	call	stringFstLetter@PLT
+	movsbl	%al, %r15d
+	testl	%r13d, %r13d
+	jle	.L56
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	movq	8(%rbp), %rax
+	xorl	%edx, %edx
+	movl	%r15d, %esi
+	movq	(%rax,%r14,8), %rdi
+	call	stringCeil@PLT
+	leal	1(%r14), %edx
+	cmpl	%edx, %r13d
+	movl	%eax, %edx
+	movl	%eax, (%r12,%r14,4)
+	notl	%edx
+	setg	%sil
+	addq	$1, %r14
+	shrl	$31, %edx
+	testb	%dl, %sil
+	jne	.L55
+	testl	%eax, %eax
+	jns	.L56
+.L46:
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	.cfi_restore_state
+	movq	8(%rsp), %r15
+	xorl	%r14d, %r14d
+	movq	%r15, %rdi
+	call	malloc@PLT
+	movq	%r15, %rdi
+	movq	%rax, 72(%rbx)
+	movq	%rax, 24(%rsp)
+	call	malloc@PLT
+	movq	%rax, 80(%rbx)
+	movq	%rax, %r15
+	movsbl	36(%rsp), %eax
+	movl	%eax, 36(%rsp)
+	testl	%r13d, %r13d
+	jle	.L52
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	movq	24(%rsp), %rax
+	movl	36(%rsp), %esi
+	movl	$-1, (%rax,%r14)
+	movq	8(%rbp), %rax
+	movq	(%rax,%r14,2), %rdi
+	call	stringLast@PLT
+	movl	%eax, (%r15,%r14)
+	addq	$4, %r14
+	cmpq	%r14, 8(%rsp)
+	jne	.L51
+.L52:
+	movq	16(%rsp), %rdi
+	call	stringBegin@PLT
+	movl	%eax, %edx
+	movq	40(%rsp), %rax
+	leaq	(%r15,%rax,4), %r15
+	movl	(%r15), %eax
+	cmpl	%eax, %edx
+	jge	.L50
+	movq	24(%rsp), %rcx
+	movq	40(%rsp), %rsi
+	movl	%eax, (%rcx,%rsi,4)
+.L50:
+	movq	16(%rsp), %rdi
+	call	stringEnd@PLT
+	movl	%eax, (%r15)
+	jmp	.L47
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	movq	32(%rbx), %rdi
+	movq	%r12, %rsi
+	call	pushPQ@PLT
+	movq	32(%rbx), %rdi
+	call	markPQ@PLT
+	movq	8(%rsp), %rdi
+	call	malloc@PLT
+	movq	%rax, 48(%rbx)
+	jmp	.L46
+	.cfi_endproc
+.LFE60:
+	.size	repairStart, .-repairStart
+	.p2align 4
+	.type	boundCmp, @function
+boundCmp:
+.LFB96:
+	.cfi_startproc
+	movq	(%rsi), %rax
+	cmpq	%rax, (%rdi)
+	je	.L64
+	setle	%al
+	movzbl	%al, %eax
+	leal	-1(%rax,%rax), %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	movq	8(%rsi), %rax
+	cmpq	%rax, 8(%rdi)
+	movl	$-1, %edx
+	setg	%al
+	movzbl	%al, %eax
+	cmovl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE96:
+	.size	boundCmp, .-boundCmp
+	.p2align 4
+	.type	growPF, @function
+growPF:
+.LFB40:
+	.cfi_startproc
+	movslq	16(%rdi), %rax
+	movl	56(%rdi), %edx
+	cmpl	%edx, %eax
+	je	.L77
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leal	1(%rax), %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	cmpl	32(%rdi), %ebp
+	jne	.L71
+	leal	(%rbp,%rbp), %esi
+	leal	1(%rdx), %eax
+	cmpl	%esi, %edx
+	cmovl	%eax, %esi
+	movl	%esi, 32(%rdi)
+	movq	24(%rdi), %rdi
+	movslq	%esi, %rsi
+	salq	$3, %rsi
+	call	realloc@PLT
+	movl	32(%rbx), %esi
+	movq	%rax, 24(%rbx)
+	subl	%ebp, %esi
+	movslq	%ebp, %rbp
+	movslq	%esi, %rsi
+	leaq	(%rax,%rbp,8), %rdi
+	salq	$3, %rsi
+	call	bzero@PLT
+	movslq	16(%rbx), %rax
+.L71:
+	movq	24(%rbx), %rdx
+	cmpq	$0, 8(%rdx,%rax,8)
+	je	.L80
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	.cfi_restore_state
+	movl	72(%rbx), %eax
+	movl	(%rbx), %edi
+	testl	%eax, %eax
+	jne	.L81
+	call	allocORT@PLT
+.L75:
+	movslq	16(%rbx), %rcx
+	movq	24(%rbx), %rdx
+	movq	%rax, 8(%rdx,%rcx,8)
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	.cfi_restore 3
+	.cfi_restore 6
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+	call	allocORTGrow@PLT
+	jmp	.L75
+	.cfi_endproc
+.LFE40:
+	.size	growPF, .-growPF
+	.p2align 4
+	.type	indexMLCS.part.0, @function
+indexMLCS.part.0:
+.LFB102:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.cfi_offset 15, -24
+	movq	%rdi, %r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$56, %rsp
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movslq	(%rdi), %rax
+	movq	%rax, %rdi
+	leaq	15(,%rax,4), %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, -88(%rbp)
+	testl	%edi, %edi
+	jle	.L89
+	leal	-1(%rdi), %eax
+	cmpl	$2, %eax
+	jbe	.L98
+	movl	%edi, %edx
+	movq	%rsp, %rbx
+	movdqa	.LC2(%rip), %xmm0
+	shrl	$2, %edx
+	movq	%rbx, %rax
+	salq	$4, %rdx
+	addq	%rbx, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L87:
+	movups	%xmm0, (%rax)
+	addq	$16, %rax
+	cmpq	%rdx, %rax
+	jne	.L87
+	testb	$3, %dil
+	je	.L89
+	movl	%edi, %eax
+	andl	$-4, %eax
+.L86:
+	movq	-88(%rbp), %rbx
+	movslq	%eax, %rdx
+	leaq	0(,%rdx,4), %rcx
+	movl	$-2, (%rbx,%rdx,4)
+	leal	1(%rax), %edx
+	cmpl	%edx, %edi
+	jle	.L89
+	addl	$2, %eax
+	movl	$-2, 4(%rbx,%rcx)
+	cmpl	%eax, %edi
+	jle	.L89
+	movl	$-2, 8(%rbx,%rcx)
+.L89:
+	movl	72(%r15), %ecx
+	addl	$1, %edi
+	testl	%ecx, %ecx
+	je	.L113
+	call	allocORTGrow@PLT
+.L91:
+	movl	32(%r15), %edx
+	movq	%rax, 104(%r15)
+	leaq	-52(%rbp), %rax
+	movq	$0, -80(%rbp)
+	movq	%rax, -96(%rbp)
+	testl	%edx, %edx
+	jg	.L92
+	jmp	.L82
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	addq	$1, -80(%rbp)
+	movq	-80(%rbp), %rax
+	cmpl	%eax, 32(%r15)
+	jle	.L82
+.L92:
+	movq	24(%r15), %rax
+	movq	-80(%rbp), %rbx
+	movq	(%rax,%rbx,8), %rdi
+	testq	%rdi, %rdi
+	je	.L93
+	movq	-96(%rbp), %rdx
+	movq	-88(%rbp), %rsi
+	xorl	%r13d, %r13d
+	call	collect@PLT
+	movq	%rax, %r14
+	movl	%ebx, %eax
+	negl	%eax
+	movl	%eax, -68(%rbp)
+	movl	-52(%rbp), %eax
+	testl	%eax, %eax
+	jle	.L96
+	.p2align 4,,10
+	.p2align 3
+.L95:
+	movl	(%r15), %eax
+	movq	%rsp, %rbx
+	movq	(%r14,%r13,8), %rsi
+	leal	1(%rax), %ecx
+	movslq	%ecx, %rcx
+	leaq	0(,%rcx,4), %r12
+	leaq	15(%r12), %rax
+	leaq	-4(%r12), %rdx
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %r11
+	movq	%r11, %rdi
+	call	memcpy@PLT
+	movq	104(%r15), %rdi
+	movq	%rax, %r11
+	movl	-68(%rbp), %eax
+	movq	%r11, %rsi
+	movl	%eax, -4(%r11,%r12)
+	call	insert@PLT
+	movq	(%r14,%r13,8), %rdi
+	movq	%rbx, %rsp
+	addq	$1, %r13
+	call	free@PLT
+	cmpl	%r13d, -52(%rbp)
+	jg	.L95
+.L96:
+	movq	%r14, %rdi
+	call	free@PLT
+	addq	$1, -80(%rbp)
+	movq	-80(%rbp), %rax
+	cmpl	%eax, 32(%r15)
+	jg	.L92
+.L82:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L113:
+	.cfi_restore_state
+	call	allocORT@PLT
+	jmp	.L91
+.L98:
+	xorl	%eax, %eax
+	jmp	.L86
+	.cfi_endproc
+.LFE102:
+	.size	indexMLCS.part.0, .-indexMLCS.part.0
+	.p2align 4
+	.type	frontRemoved, @function
+frontRemoved:
+.LFB37:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.cfi_offset 15, -24
+	movq	%rdi, %r15
+	pushq	%r14
+	pushq	%r13
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	movq	%rdx, %r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$40, %rsp
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	104(%rdi), %r12
+	testl	%ecx, %ecx
+	movl	%esi, -56(%rbp)
+	setg	-69(%rbp)
+	movzbl	-69(%rbp), %eax
+	movl	%ecx, -52(%rbp)
+	testq	%r12, %r12
+	je	.L121
+	negl	%esi
+	movl	$1, %r14d
+	movl	%esi, -68(%rbp)
+	testb	%al, %al
+	je	.L121
+	.p2align 4,,10
+	.p2align 3
+.L120:
+	movl	(%r15), %eax
+	movq	-8(%r13,%r14,8), %rsi
+	movq	%rsp, -64(%rbp)
+	leal	1(%rax), %ecx
+	movslq	%ecx, %rcx
+	leaq	0(,%rcx,4), %rbx
+	leaq	15(%rbx), %rax
+	leaq	-4(%rbx), %rdx
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %rdi
+	call	memcpy@PLT
+	movq	%rax, %rdi
+	movl	-68(%rbp), %eax
+	movq	%rdi, %rsi
+	movl	%eax, -4(%rdi,%rbx)
+	movq	%r12, %rdi
+	call	delete@PLT
+	movq	104(%r15), %r12
+	cmpl	%r14d, -52(%rbp)
+	setg	%dl
+	movq	-64(%rbp), %rsp
+	testq	%r12, %r12
+	setne	%al
+	addq	$1, %r14
+	testb	%al, %dl
+	jne	.L120
+.L121:
+	movq	88(%r15), %rax
+	testq	%rax, %rax
+	je	.L114
+	cmpb	$0, -69(%rbp)
+	movl	$1, %r12d
+	je	.L114
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	movq	-8(%r13,%r12,8), %rdx
+	movl	(%r15), %ecx
+	movl	$-1, %r8d
+	movq	96(%r15), %rdi
+	movl	-56(%rbp), %esi
+	call	*%rax
+	movq	88(%r15), %rax
+	cmpl	%r12d, -52(%rbp)
+	setg	%cl
+	testq	%rax, %rax
+	setne	%dl
+	addq	$1, %r12
+	testb	%dl, %cl
+	jne	.L117
+.L114:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	frontRemoved, .-frontRemoved
+	.p2align 4
+	.type	freeFront, @function
+freeFront:
+.LFB38:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	movslq	%esi, %r13
+	pushq	%r12
+	.cfi_offset 12, -48
+	movq	%rdi, %r12
+	pushq	%rbx
+	subq	$24, %rsp
+	.cfi_offset 3, -56
+	cmpq	$0, 88(%rdi)
+	je	.L135
+	movq	%r13, %rbx
+	testl	%r13d, %r13d
+	je	.L135
+	movslq	(%rdi), %rax
+	movq	%rsp, %r14
+	movq	%rax, %rcx
+	leaq	15(,%rax,4), %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %rsi
+	testl	%ecx, %ecx
+	jle	.L142
+	leal	-1(%rcx), %eax
+	cmpl	$2, %eax
+	jbe	.L145
+	movl	%ecx, %edx
+	movdqa	.LC2(%rip), %xmm0
+	movq	%rsi, %rax
+	shrl	$2, %edx
+	salq	$4, %rdx
+	addq	%rsi, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	movups	%xmm0, (%rax)
+	addq	$16, %rax
+	cmpq	%rax, %rdx
+	jne	.L140
+	testb	$3, %cl
+	je	.L142
+	movl	%ecx, %eax
+	andl	$-4, %eax
+.L139:
+	movslq	%eax, %rdx
+	movl	$-2, (%rsi,%rdx,4)
+	leaq	0(,%rdx,4), %rdi
+	leal	1(%rax), %edx
+	cmpl	%edx, %ecx
+	jle	.L142
+	addl	$2, %eax
+	movl	$-2, 4(%rsi,%rdi)
+	cmpl	%eax, %ecx
+	jle	.L142
+	movl	$-2, 8(%rsi,%rdi)
+.L142:
+	movq	24(%r12), %rax
+	leaq	-52(%rbp), %rdx
+	movq	(%rax,%r13,8), %rdi
+	call	collect@PLT
+	movl	-52(%rbp), %ecx
+	movl	%ebx, %esi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	movq	%rax, %r15
+	xorl	%ebx, %ebx
+	call	frontRemoved
+	movl	-52(%rbp), %eax
+	testl	%eax, %eax
+	jle	.L138
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	movq	(%r15,%rbx,8), %rdi
+	addq	$1, %rbx
+	call	free@PLT
+	cmpl	%ebx, -52(%rbp)
+	jg	.L137
+.L138:
+	movq	%r15, %rdi
+	call	free@PLT
+	movq	%r14, %rsp
+.L135:
+	movq	24(%r12), %rax
+	movq	(%rax,%r13,8), %rdi
+	call	freeORT@PLT
+	movq	24(%r12), %rax
+	movq	$0, (%rax,%r13,8)
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L145:
+	.cfi_restore_state
+	xorl	%eax, %eax
+	jmp	.L139
+	.cfi_endproc
+.LFE38:
+	.size	freeFront, .-freeFront
+	.p2align 4
+	.type	buildFronts, @function
+buildFronts:
+.LFB42:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	movq	%rdi, %r12
+	pushq	%rbx
+	subq	$104, %rsp
+	.cfi_offset 3, -56
+	movq	8(%rdi), %rax
+	movl	(%rdi), %ecx
+	movq	(%rax), %rdi
+	movl	%ecx, %ebx
+	movl	%ecx, -68(%rbp)
+	call	stringSigma@PLT
+	movl	%eax, -84(%rbp)
+	movslq	%ebx, %rax
+	movq	%rax, %rcx
+	leaq	15(,%rax,4), %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %r9
+	testl	%ecx, %ecx
+	jle	.L166
+	movl	-68(%rbp), %ecx
+	leal	-1(%rcx), %eax
+	cmpl	$2, %eax
+	jbe	.L198
+	movl	%ecx, %eax
+	movdqa	.LC2(%rip), %xmm0
+	movq	%r9, %rdx
+	shrl	$2, %eax
+	salq	$4, %rax
+	addq	%r9, %rax
+.L164:
+	movups	%xmm0, (%rdx)
+	addq	$16, %rdx
+	cmpq	%rdx, %rax
+	jne	.L164
+	movl	-68(%rbp), %ecx
+	movl	%ecx, %eax
+	andl	$-4, %eax
+	andl	$3, %ecx
+	je	.L166
+.L163:
+	movslq	%eax, %rcx
+	movl	-68(%rbp), %edi
+	movl	$-2, (%r9,%rcx,4)
+	leaq	0(,%rcx,4), %rdx
+	leal	1(%rax), %ecx
+	cmpl	%ecx, %edi
+	jle	.L166
+	movl	$-2, 4(%r9,%rdx)
+	addl	$2, %eax
+	cmpl	%eax, %edi
+	jle	.L166
+	movl	$-2, 8(%r9,%rdx)
+.L166:
+	movl	4(%r12), %r10d
+	movl	$0, -88(%rbp)
+	movq	$8, -128(%rbp)
+	testl	%r10d, %r10d
+	jne	.L159
+	movq	%r9, -144(%rbp)
+.L161:
+	movl	-88(%rbp), %eax
+	cmpl	%eax, 56(%r12)
+	jle	.L159
+	movq	-128(%rbp), %rcx
+	movq	24(%r12), %rax
+	leaq	-56(%rbp), %rdx
+	movq	-144(%rbp), %rsi
+	movq	-8(%rax,%rcx), %rdi
+	call	collect@PLT
+	movl	-56(%rbp), %r13d
+	movl	-84(%rbp), %ecx
+	movq	%rax, -136(%rbp)
+	movq	%rax, %rbx
+	movl	-68(%rbp), %eax
+	imull	%r13d, %ecx
+	movl	%ecx, %r14d
+	leal	1(%rax), %ecx
+	movl	%ecx, -104(%rbp)
+	imull	%r14d, %ecx
+	movslq	%ecx, %rdi
+	salq	$2, %rdi
+	call	malloc@PLT
+	movslq	%r14d, %rcx
+	leaq	0(,%rcx,8), %rdi
+	movq	%rax, -96(%rbp)
+	call	malloc@PLT
+	movq	%rax, -112(%rbp)
+	testl	%r13d, %r13d
+	jle	.L169
+	movl	$0, -120(%rbp)
+	movq	%rbx, %r14
+	xorl	%ebx, %ebx
+	.p2align 4,,10
+	.p2align 3
+.L170:
+	movl	-84(%rbp), %r8d
+	xorl	%edi, %edi
+	movl	%ebx, %ecx
+	movq	%r14, %r15
+	movl	%edi, %esi
+	testl	%r8d, %r8d
+	jle	.L177
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	movl	-104(%rbp), %eax
+	movq	-96(%rbp), %rdi
+	leal	65(%rsi), %r11d
+	xorl	%ebx, %ebx
+	movl	-68(%rbp), %r9d
+	movsbl	%r11b, %r13d
+	imull	%ecx, %eax
+	cltq
+	leaq	(%rdi,%rax,4), %r14
+	movl	$0, (%r14)
+	testl	%r9d, %r9d
+	jle	.L174
+	movl	%ecx, -80(%rbp)
+	movq	%r12, %rax
+	movl	%r13d, %r12d
+	movl	%esi, -72(%rbp)
+	movq	%rax, %r13
+	.p2align 4,,10
+	.p2align 3
+.L173:
+	movq	(%r15), %rax
+	movl	%r12d, %esi
+	movl	(%rax,%rbx,4), %edx
+	movq	8(%r13), %rax
+	movq	(%rax,%rbx,8), %rdi
+	addl	$1, %edx
+	call	stringCeil@PLT
+	leal	1(%rbx), %edx
+	movl	%eax, 4(%r14,%rbx,4)
+	addl	%eax, (%r14)
+	cmpl	%edx, -68(%rbp)
+	setg	%sil
+	cmpl	$-2, %eax
+	setne	%dl
+	addq	$1, %rbx
+	testb	%dl, %sil
+	jne	.L173
+	movl	-80(%rbp), %ecx
+	movl	-72(%rbp), %esi
+	movq	%r13, %r12
+	cmpl	$-2, %eax
+	jne	.L174
+.L172:
+	addl	$1, %esi
+	cmpl	%esi, -84(%rbp)
+	jne	.L175
+	movl	%ecx, %ebx
+	movq	%r15, %r14
+.L177:
+	movq	(%r14), %rdi
+	addq	$8, %r14
+	call	free@PLT
+	addl	$1, -120(%rbp)
+	movl	-120(%rbp), %eax
+	cmpl	%eax, -56(%rbp)
+	jg	.L170
+	movq	-136(%rbp), %rdi
+	movl	%ebx, -80(%rbp)
+	call	free@PLT
+	movq	-112(%rbp), %rbx
+	movslq	-80(%rbp), %rsi
+	leaq	candCmp(%rip), %rcx
+	movl	-68(%rbp), %r15d
+	movl	$8, %edx
+	movq	%rbx, %rdi
+	movl	%esi, -72(%rbp)
+	movq	%rsi, -80(%rbp)
+	movl	%r15d, sortDim(%rip)
+	call	qsort@PLT
+	movl	%r15d, %edi
+	call	allocORT@PLT
+	movl	-72(%rbp), %r8d
+	movq	%rax, %rdi
+	testl	%r8d, %r8d
+	je	.L178
+	movq	-80(%rbp), %rsi
+	movl	$0, -72(%rbp)
+	xorl	%edx, %edx
+	movq	%rax, -80(%rbp)
+	movq	%rdx, %r15
+	movq	%rbx, -104(%rbp)
+	leaq	(%rbx,%rsi,8), %r13
+	movq	%r12, -120(%rbp)
+	movq	%rbx, %r12
+	.p2align 4,,10
+	.p2align 3
+.L183:
+	movq	%r15, %rcx
+	movq	(%r12), %r15
+	testq	%rcx, %rcx
+	je	.L179
+	movl	sortDim(%rip), %esi
+	testl	%esi, %esi
+	js	.L182
+	xorl	%eax, %eax
+	jmp	.L181
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	addq	$1, %rax
+	cmpl	%eax, %esi
+	jl	.L182
+.L181:
+	movl	(%r15,%rax,4), %edi
+	cmpl	%edi, (%rcx,%rax,4)
+	je	.L239
+.L179:
+	leaq	4(%r15), %rbx
+	movl	-68(%rbp), %esi
+	movq	%rbx, %rdi
+	call	plusPlus@PLT
+	movq	-80(%rbp), %rdi
+	movq	%rbx, %rsi
+	call	countQ@PLT
+	movl	-68(%rbp), %esi
+	movq	%rbx, %rdi
+	movl	%eax, %r14d
+	call	minusMinus@PLT
+	testl	%r14d, %r14d
+	jle	.L240
+.L182:
+	addq	$8, %r12
+	cmpq	%r13, %r12
+	jne	.L183
+	movq	-80(%rbp), %rdi
+	movq	-104(%rbp), %r15
+	movq	-120(%rbp), %r12
+	call	freeORT@PLT
+	movl	-72(%rbp), %esi
+	testl	%esi, %esi
+	jne	.L241
+.L185:
+	movq	-112(%rbp), %rdi
+	call	free@PLT
+	movq	-96(%rbp), %rdi
+	call	free@PLT
+.L159:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L174:
+	.cfi_restore_state
+	movq	-112(%rbp), %rdi
+	movslq	%ecx, %rax
+	addl	$1, %ecx
+	movq	%r14, (%rdi,%rax,8)
+	jmp	.L172
+.L240:
+	movq	-80(%rbp), %rdi
+	movq	%rbx, %rsi
+	call	insert@PLT
+	movslq	-72(%rbp), %rax
+	movq	-112(%rbp), %rdi
+	movq	%rbx, (%rdi,%rax,8)
+	leal	1(%rax), %eax
+	movl	%eax, -72(%rbp)
+	jmp	.L182
+.L241:
+	movq	%r12, %rdi
+	call	growPF
+	movq	-128(%rbp), %rcx
+	movq	24(%r12), %rax
+	movq	(%rax,%rcx), %rdi
+	call	freeORT@PLT
+	movl	72(%r12), %ecx
+	testl	%ecx, %ecx
+	jne	.L242
+	movl	-72(%rbp), %edx
+	movq	-112(%rbp), %rsi
+	movl	-68(%rbp), %edi
+	movq	-128(%rbp), %r15
+	addq	24(%r12), %r15
+	call	buildORT@PLT
+	movq	%rax, (%r15)
+.L188:
+	movq	88(%r12), %rax
+	addl	$1, -88(%rbp)
+	movl	$1, %r15d
+	movq	-112(%rbp), %rbx
+	testq	%rax, %rax
+	je	.L192
+.L189:
+	movq	-8(%rbx,%r15,8), %rdx
+	movl	-68(%rbp), %ecx
+	movl	$1, %r8d
+	movq	96(%r12), %rdi
+	movl	-88(%rbp), %esi
+	call	*%rax
+	movq	88(%r12), %rax
+	cmpl	%r15d, -72(%rbp)
+	setg	%cl
+	testq	%rax, %rax
+	setne	%dl
+	addq	$1, %r15
+	testb	%dl, %cl
+	jne	.L189
+.L192:
+	movl	60(%r12), %esi
+	addl	$1, 16(%r12)
+	testl	%esi, %esi
+	jg	.L243
+.L238:
+	movq	-112(%rbp), %rdi
+	call	free@PLT
+	movq	-96(%rbp), %rdi
+	call	free@PLT
+	movl	4(%r12), %eax
+	addq	$8, -128(%rbp)
+	testl	%eax, %eax
+	je	.L161
+	jmp	.L159
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	movq	-136(%rbp), %rdi
+	call	free@PLT
+	movl	-68(%rbp), %ebx
+	movq	-112(%rbp), %rdi
+	xorl	%esi, %esi
+	leaq	candCmp(%rip), %rcx
+	movl	$8, %edx
+	movl	%ebx, sortDim(%rip)
+	call	qsort@PLT
+	movl	%ebx, %edi
+	call	allocORT@PLT
+	movq	%rax, %rdi
+.L178:
+	call	freeORT@PLT
+	jmp	.L185
+.L242:
+	movl	-68(%rbp), %edi
+	movq	-128(%rbp), %rdx
+	addq	24(%r12), %rdx
+	movq	%rdx, -80(%rbp)
+	call	allocORTGrow@PLT
+	movq	-80(%rbp), %rdx
+	movq	-112(%rbp), %rcx
+	movq	%rax, (%rdx)
+	movslq	-72(%rbp), %rax
+	leaq	(%rcx,%rax,8), %rax
+	movq	%rax, %rbx
+.L187:
+	movq	24(%r12), %rdx
+	movq	-128(%rbp), %rax
+	addq	$8, %r15
+	movq	-8(%r15), %rsi
+	movq	(%rdx,%rax), %rdi
+	call	insert@PLT
+	cmpq	%rbx, %r15
+	jne	.L187
+	jmp	.L188
+.L243:
+	movq	24(%r12), %rax
+	movq	-128(%rbp), %rdi
+	leaq	-52(%rbp), %rcx
+	movq	64(%r12), %rdx
+	movq	(%rax,%rdi), %rdi
+	call	evictWorst@PLT
+	movl	-52(%rbp), %ecx
+	movl	-88(%rbp), %esi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	movq	%rax, %r15
+	call	frontRemoved
+	movl	-52(%rbp), %edx
+	xorl	%eax, %eax
+	movq	%rax, %rbx
+	testl	%edx, %edx
+	jle	.L195
+.L194:
+	movq	(%r15,%rbx,8), %rdi
+	addq	$1, %rbx
+	call	free@PLT
+	cmpl	%ebx, -52(%rbp)
+	jg	.L194
+.L195:
+	movq	%r15, %rdi
+	call	free@PLT
+	jmp	.L238
+.L198:
+	xorl	%eax, %eax
+	jmp	.L163
+	.cfi_endproc
+.LFE42:
+	.size	buildFronts, .-buildFronts
+	.p2align 4
+	.type	frontInsert, @function
+frontInsert:
+.LFB35:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	movq	%rdx, %r14
+	movslq	%esi, %rdx
+	pushq	%r13
+	.cfi_offset 13, -40
+	movl	%esi, %r13d
+	movq	%r14, %rsi
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	movq	24(%rdi), %rax
+	movq	(%rax,%rdx,8), %rdi
+	call	insert@PLT
+	movq	104(%rbx), %r15
+	testq	%r15, %r15
+	je	.L245
+	movl	(%rbx), %eax
+	movq	%rsp, -56(%rbp)
+	movq	%r14, %rsi
+	leal	1(%rax), %r12d
+	movslq	%r12d, %r12
+	salq	$2, %r12
+	leaq	15(%r12), %rax
+	leaq	-4(%r12), %rdx
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %rdi
+	call	memcpy@PLT
+	movq	%rax, %rdi
+	movl	%r13d, %eax
+	negl	%eax
+	movq	%rdi, %rsi
+	movl	%eax, -4(%rdi,%r12)
+	movq	%r15, %rdi
+	call	insert@PLT
+	movq	-56(%rbp), %rsp
+.L245:
+	movq	88(%rbx), %rax
+	testq	%rax, %rax
+	je	.L244
+	movl	(%rbx), %ecx
+	movq	96(%rbx), %rdi
+	movl	$1, %r8d
+	movq	%r14, %rdx
+	movl	%r13d, %esi
+	call	*%rax
+.L244:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE35:
+	.size	frontInsert, .-frontInsert
+	.p2align 4
+	.type	frontDelete, @function
+frontDelete:
+.LFB36:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.cfi_offset 15, -24
+	movq	%rdx, %r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	movslq	%esi, %r12
+	pushq	%rbx
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	movq	88(%rdi), %rax
+	testq	%rax, %rax
+	je	.L255
+	movl	(%rdi), %ecx
+	movl	$-1, %r8d
+	movq	96(%rdi), %rdi
+	movl	%r12d, %esi
+	call	*%rax
+.L255:
+	movq	104(%rbx), %r14
+	testq	%r14, %r14
+	je	.L256
+	movl	(%rbx), %eax
+	movq	%rsp, -56(%rbp)
+	movq	%r15, %rsi
+	leal	1(%rax), %r13d
+	movslq	%r13d, %r13
+	salq	$2, %r13
+	leaq	15(%r13), %rax
+	leaq	-4(%r13), %rdx
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %rdi
+	call	memcpy@PLT
+	movq	%rax, %rdi
+	movl	%r12d, %eax
+	negl	%eax
+	movq	%rdi, %rsi
+	movl	%eax, -4(%rdi,%r13)
+	movq	%r14, %rdi
+	call	delete@PLT
+	movq	-56(%rbp), %rsp
+.L256:
+	movq	24(%rbx), %rax
+	movq	%r15, %rsi
+	movq	(%rax,%r12,8), %rdi
+	call	delete@PLT
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	frontDelete, .-frontDelete
+	.p2align 4
+	.type	trimFronts, @function
+trimFronts:
+.LFB47:
+	.cfi_startproc
+	movl	60(%rdi), %esi
+	testl	%esi, %esi
+	je	.L301
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.cfi_offset 15, -24
+	movq	%rdi, %r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$120, %rsp
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movslq	(%rdi), %rax
+	movl	16(%rdi), %ecx
+	movq	%rsp, %r13
+	leaq	15(,%rax,4), %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, -80(%rbp)
+	testl	%ecx, %ecx
+	jle	.L304
+	leaq	-52(%rbp), %rax
+	movl	$1, -100(%rbp)
+	xorl	%r14d, %r14d
+	movq	$0, -88(%rbp)
+	movl	$0, -72(%rbp)
+	movq	%rax, -120(%rbp)
+	movq	%r13, -152(%rbp)
+.L267:
+	movl	-72(%rbp), %edx
+	leaq	8(%r14), %rax
+	testl	%edx, %edx
+	je	.L305
+	movq	-88(%rbp), %rcx
+	movq	%r14, -136(%rbp)
+	movq	%rax, %r14
+.L276:
+	movslq	-72(%rbp), %rax
+	movq	$0, -88(%rbp)
+	movq	%rcx, %r12
+	movl	$0, -72(%rbp)
+	leaq	(%rcx,%rax,8), %rax
+	movq	%rcx, -144(%rbp)
+	movq	%rax, -128(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L273:
+	movq	24(%r15), %rax
+	movq	(%r12), %rsi
+	movq	-120(%rbp), %rdx
+	movq	(%rax,%r14), %rdi
+	call	collect@PLT
+	movl	-52(%rbp), %ebx
+	movq	-88(%rbp), %rdi
+	movq	%rax, -96(%rbp)
+	movq	%rax, %r13
+	movl	-72(%rbp), %eax
+	leal	(%rbx,%rax), %esi
+	movslq	%esi, %rsi
+	salq	$3, %rsi
+	call	realloc@PLT
+	movq	%rax, -88(%rbp)
+	testl	%ebx, %ebx
+	jle	.L269
+	movq	%r12, -112(%rbp)
+	xorl	%ebx, %ebx
+	movq	%r13, %r12
+	movq	-136(%rbp), %r13
+	jmp	.L272
+	.p2align 4,,10
+	.p2align 3
+.L270:
+	movq	(%r12), %rdi
+	addl	$1, %ebx
+	addq	$8, %r12
+	call	free@PLT
+	cmpl	%ebx, -52(%rbp)
+	jle	.L306
+.L272:
+	movq	24(%r15), %rax
+	movq	(%r12), %rsi
+	movq	(%rax,%r14), %rdi
+	call	containsQ@PLT
+	testl	%eax, %eax
+	je	.L270
+	movq	24(%r15), %rax
+	movq	(%r12), %rsi
+	movq	-80(%rbp), %rdx
+	movq	(%rax,%r13), %rdi
+	call	dominatedFind@PLT
+	testl	%eax, %eax
+	jne	.L270
+	movq	(%r12), %rdx
+	movl	-100(%rbp), %esi
+	movq	%r15, %rdi
+	addl	$1, %ebx
+	addq	$8, %r12
+	call	frontDelete
+	movslq	-72(%rbp), %rax
+	movq	-8(%r12), %rdx
+	movq	-88(%rbp), %rsi
+	movq	%rdx, (%rsi,%rax,8)
+	leal	1(%rax), %eax
+	movl	%eax, -72(%rbp)
+	cmpl	%ebx, -52(%rbp)
+	jg	.L272
+	.p2align 4,,10
+	.p2align 3
+.L306:
+	movq	-112(%rbp), %r12
+.L269:
+	movq	-96(%rbp), %rdi
+	addq	$8, %r12
+	call	free@PLT
+	movq	-8(%r12), %rdi
+	call	free@PLT
+	cmpq	%r12, -128(%rbp)
+	jne	.L273
+	movq	-144(%rbp), %rcx
+.L278:
+	movq	%rcx, %rdi
+	call	free@PLT
+	movq	24(%r15), %rax
+	movq	64(%r15), %rdx
+	movl	60(%r15), %esi
+	movq	-120(%rbp), %rcx
+	movq	(%rax,%r14), %rdi
+	call	evictWorst@PLT
+	movl	-52(%rbp), %ecx
+	movl	-100(%rbp), %esi
+	movq	%r15, %rdi
+	movq	%rax, %rdx
+	movq	%rax, %rbx
+	call	frontRemoved
+	movl	-52(%rbp), %r12d
+	testl	%r12d, %r12d
+	jg	.L307
+	addl	$1, -100(%rbp)
+	movl	-100(%rbp), %eax
+	cmpl	%eax, 16(%r15)
+	jge	.L267
+	movl	-72(%rbp), %eax
+	movq	-152(%rbp), %r13
+	testl	%eax, %eax
+	je	.L268
+.L275:
+	movq	-88(%rbp), %rcx
+	movslq	-72(%rbp), %rax
+	movq	%rcx, %rbx
+	leaq	(%rcx,%rax,8), %r12
+	.p2align 4,,10
+	.p2align 3
+.L280:
+	movq	(%rbx), %rdi
+	addq	$8, %rbx
+	call	free@PLT
+	cmpq	%rbx, %r12
+	jne	.L280
+.L268:
+	movq	-88(%rbp), %rdi
+	call	free@PLT
+	movl	16(%r15), %eax
+	testl	%eax, %eax
+	jg	.L281
+	jmp	.L282
+	.p2align 4,,10
+	.p2align 3
+.L283:
+	movl	16(%r15), %eax
+	subl	$1, %eax
+	movl	%eax, 16(%r15)
+	testl	%eax, %eax
+	jle	.L282
+.L281:
+	movq	24(%r15), %rdx
+	cltq
+	movq	(%rdx,%rax,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	je	.L283
+.L282:
+	movq	%r13, %rsp
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L307:
+	.cfi_restore_state
+	movl	-72(%rbp), %ecx
+	movq	-88(%rbp), %rdi
+	leal	(%r12,%rcx), %r13d
+	movslq	%r13d, %rsi
+	salq	$3, %rsi
+	call	realloc@PLT
+	movslq	%r12d, %rdx
+	movq	%rbx, %rsi
+	movq	%rax, %rcx
+	movslq	-72(%rbp), %rax
+	salq	$3, %rdx
+	movq	%rcx, -72(%rbp)
+	leaq	(%rcx,%rax,8), %rdi
+	call	memcpy@PLT
+	movq	%rbx, %rdi
+	call	free@PLT
+	addl	$1, -100(%rbp)
+	movl	-100(%rbp), %eax
+	cmpl	16(%r15), %eax
+	movq	-72(%rbp), %rcx
+	jg	.L285
+	movq	%r14, -136(%rbp)
+	addq	$8, %r14
+	movl	%r13d, -72(%rbp)
+	jmp	.L276
+.L305:
+	movq	-88(%rbp), %rcx
+	movq	%rax, %r14
+	movq	$0, -88(%rbp)
+	jmp	.L278
+.L301:
+	.cfi_def_cfa 7, 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	ret
+.L285:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -56
+	.cfi_offset 6, -16
+	.cfi_offset 12, -48
+	.cfi_offset 13, -40
+	.cfi_offset 14, -32
+	.cfi_offset 15, -24
+	movl	%r13d, %r8d
+	movq	%rcx, -88(%rbp)
+	movq	-152(%rbp), %r13
+	movl	%r8d, -72(%rbp)
+	jmp	.L275
+.L304:
+	movq	$0, -88(%rbp)
+	jmp	.L268
+	.cfi_endproc
+.LFE47:
+	.size	trimFronts, .-trimFronts
+	.p2align 4
+	.type	cleanCovered, @function
+cleanCovered:
+.LFB59:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movslq	%edx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	salq	$3, %r13
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rcx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movslq	(%rsi), %r14
+	movl	%edx, 12(%rsp)
+	movq	%r14, %r15
+	salq	$2, %r14
+	jmp	.L309
+	.p2align 4,,10
+	.p2align 3
+.L311:
+	movq	%rbx, %rdi
+	call	topPQ@PLT
+	movq	%r14, %rdx
+	movq	%rbp, %rdi
+	movq	%rax, %rsi
+	call	memcpy@PLT
+	movl	%r15d, %esi
+	movq	%rbp, %rdi
+	call	plusPlus@PLT
+	movq	24(%r12), %rax
+	movq	%rbp, %rsi
+	movq	(%rax,%r13), %rdi
+	call	countQ@PLT
+	cmpl	$1, %eax
+	jle	.L310
+	movq	%rbx, %rdi
+	call	topPQ@PLT
+	movl	12(%rsp), %esi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	frontDelete
+.L310:
+	movq	%rbx, %rdi
+	call	topPQ@PLT
+	movq	%rax, %rdi
+	call	free@PLT
+	movq	%rbx, %rdi
+	call	popPQ@PLT
+.L309:
+	movq	%rbx, %rdi
+	call	isEmptyPQ@PLT
+	testl	%eax, %eax
+	je	.L311
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE59:
+	.size	cleanCovered, .-cleanCovered
+	.p2align 4
+	.type	removeCovered, @function
+removeCovered:
+.LFB44:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	%esi, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movl	(%rdi), %r13d
+	movq	%rdx, %rdi
+	movl	%r13d, %esi
+	call	minusMinus@PLT
+	movq	24(%r14), %rax
+	movslq	%r15d, %rcx
+	movq	%r12, %rsi
+	leaq	12(%rsp), %rdx
+	movq	(%rax,%rcx,8), %rdi
+	call	collect@PLT
+	movl	%r13d, %esi
+	movq	%r12, %rdi
+	movq	%rax, %rbp
+	call	plusPlus@PLT
+	movl	12(%rsp), %eax
+	testl	%eax, %eax
+	jle	.L314
+	xorl	%ebx, %ebx
+	jmp	.L317
+	.p2align 4,,10
+	.p2align 3
+.L315:
+	movq	0(%rbp,%rbx,8), %rdi
+	addq	$1, %rbx
+	call	free@PLT
+	cmpl	%ebx, 12(%rsp)
+	jle	.L314
+.L317:
+	movq	0(%rbp,%rbx,8), %rdi
+	movl	%r13d, %edx
+	movq	%r12, %rsi
+	call	pointEquals@PLT
+	testl	%eax, %eax
+	jne	.L315
+	movq	0(%rbp,%rbx,8), %rdx
+	movl	%r15d, %esi
+	movq	%r14, %rdi
+	call	frontDelete
+	jmp	.L315
+	.p2align 4,,10
+	.p2align 3
+.L314:
+	movq	%rbp, %rdi
+	call	free@PLT
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE44:
+	.size	removeCovered, .-removeCovered
+	.p2align 4
+	.type	rebuildMLCS, @function
+rebuildMLCS:
+.LFB43:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	movq	%rdi, %r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$88, %rsp
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movslq	(%rdi), %rcx
+	movq	104(%rdi), %r15
+	leaq	0(,%rcx,8), %r12
+	movq	%rcx, -88(%rbp)
+	movq	%rcx, %r13
+	leaq	15(%r12), %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	leaq	0(,%rcx,4), %rax
+	movq	%rax, -96(%rbp)
+	addq	$15, %rax
+	andq	$-16, %rax
+	movq	%rsp, -80(%rbp)
+	subq	%rax, %rsp
+	movq	128(%rdi), %rax
+	movq	%r15, %rdi
+	movq	%rsp, -72(%rbp)
+	testq	%rax, %rax
+	je	.L320
+	movq	%rax, %rdi
+	call	freeRepair
+	movq	104(%r14), %rdi
+	movq	$0, 128(%r14)
+.L320:
+	testq	%rdi, %rdi
+	je	.L321
+	call	freeORT@PLT
+	movq	$0, 104(%r14)
+.L321:
+	testl	%r13d, %r13d
+	jle	.L322
+	movq	$0, -64(%rbp)
+	movq	%r12, -104(%rbp)
+	movq	%r15, -112(%rbp)
+	movl	%r13d, -116(%rbp)
+	movq	%r14, -56(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L327:
+	movq	-56(%rbp), %r13
+	movq	-64(%rbp), %r15
+	movq	8(%r13), %r12
+	leaq	(%r15,%r15), %rbx
+	addq	%rbx, %r12
+	movq	(%r12), %rdi
+	call	stringOwn@PLT
+	addq	48(%r13), %rbx
+	movq	%rax, (%r12)
+	movq	(%rbx), %rdi
+	movq	%rax, %r14
+	movq	%r13, %r12
+	call	stringOwn@PLT
+	movq	%r14, %rdi
+	movq	%rax, (%rbx)
+	movq	%rax, %r13
+	call	stringSize@PLT
+	movq	40(%r12), %rdx
+	movq	%r13, %rdi
+	movq	%r12, -56(%rbp)
+	movq	%r15, %r12
+	subl	(%rdx,%r15), %eax
+	movl	%eax, %ebx
+	call	stringSize@PLT
+	addl	%eax, %ebx
+	movq	-72(%rbp), %rax
+	movl	%ebx, (%rax,%r15)
+	addl	$1, %ebx
+	movslq	%ebx, %rdi
+	xorl	%ebx, %ebx
+	call	malloc@PLT
+	movq	%r14, %rdi
+	movq	%rax, %r15
+	movq	-80(%rbp), %rax
+	movq	%r15, (%rax,%r12,2)
+	call	stringBegin@PLT
+	movq	-56(%rbp), %rcx
+	movq	40(%rcx), %rdx
+	addl	(%rdx,%r12), %eax
+	movl	%eax, %r12d
+	jmp	.L323
+	.p2align 4,,10
+	.p2align 3
+.L324:
+	movl	%r12d, %esi
+	movq	%r14, %rdi
+	addl	$1, %r12d
+	call	stringLetter@PLT
+	movb	%al, (%r15,%rbx)
+	addq	$1, %rbx
+.L323:
+	movq	%r14, %rdi
+	call	stringEnd@PLT
+	cmpl	%r12d, %eax
+	jg	.L324
+	movq	%r13, %rdi
+	movslq	%ebx, %rbx
+	call	stringBegin@PLT
+	addq	%r15, %rbx
+	movl	%eax, %r12d
+	jmp	.L325
+	.p2align 4,,10
+	.p2align 3
+.L326:
+	movl	%r12d, %esi
+	movq	%r13, %rdi
+	addl	$1, %r12d
+	addq	$1, %rbx
+	call	stringLetter@PLT
+	movb	%al, -1(%rbx)
+.L325:
+	movq	%r13, %rdi
+	call	stringEnd@PLT
+	cmpl	%r12d, %eax
+	jg	.L326
+	movq	%r14, %rdi
+	call	stringSize@PLT
+	movq	%r14, %rdi
+	movl	%eax, %esi
+	call	stringPopMany@PLT
+	movq	%r13, %rdi
+	call	stringSize@PLT
+	movq	%r13, %rdi
+	movl	%eax, %esi
+	call	stringPopMany@PLT
+	movq	-56(%rbp), %rax
+	movq	-64(%rbp), %rcx
+	movq	40(%rax), %rax
+	movl	$0, (%rax,%rcx)
+	addq	$4, %rcx
+	movq	%rcx, -64(%rbp)
+	cmpq	%rcx, -96(%rbp)
+	jne	.L327
+	movq	-56(%rbp), %r14
+	movq	-104(%rbp), %r12
+	movq	-112(%rbp), %r15
+	movl	-116(%rbp), %r13d
+	cmpl	$1, 32(%r14)
+	jle	.L369
+.L332:
+	movq	24(%r14), %rcx
+	xorl	%eax, %eax
+.L330:
+	cmpq	$0, 8(%rcx,%rax,8)
+	leaq	1(%rax), %rbx
+	je	.L336
+.L370:
+	leal	1(%rax), %esi
+	movq	%r14, %rdi
+	call	freeFront
+	movq	%rbx, %rax
+	leal	1(%rbx), %edx
+	cmpl	%edx, 32(%r14)
+	jle	.L338
+	movq	24(%r14), %rcx
+	leaq	1(%rax), %rbx
+	cmpq	$0, 8(%rcx,%rax,8)
+	jne	.L370
+.L336:
+	movq	%rbx, %rax
+	leal	1(%rbx), %edx
+	cmpl	%edx, 32(%r14)
+	jg	.L330
+.L338:
+	movl	$0, 16(%r14)
+	movl	$0, 4(%r14)
+	testl	%r13d, %r13d
+	jle	.L371
+.L334:
+	movq	%r12, -56(%rbp)
+	xorl	%r13d, %r13d
+	movq	%r15, -64(%rbp)
+	movq	%r14, %r15
+	.p2align 4,,10
+	.p2align 3
+.L341:
+	movq	-72(%rbp), %rax
+	movslq	(%rax,%r13,4), %rbx
+	testl	%ebx, %ebx
+	jle	.L372
+	movq	-80(%rbp), %rax
+	leaq	0(,%r13,8), %r12
+	movq	(%rax,%r13,8), %r14
+	addq	%r14, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L339:
+	movq	8(%r15), %rdx
+	movsbl	(%r14), %esi
+	addq	$1, %r14
+	movq	(%rdx,%r12), %rdi
+	call	stringAppend@PLT
+	cmpq	%r14, %rbx
+	jne	.L339
+.L340:
+	addq	$1, %r13
+	cmpq	%r13, -88(%rbp)
+	jne	.L341
+.L373:
+	movq	%r15, %r14
+	movq	-56(%rbp), %r12
+	movq	-64(%rbp), %r15
+	movq	%r14, %rdi
+	call	buildFronts
+	movq	-80(%rbp), %rbx
+	addq	%rbx, %r12
+	.p2align 4,,10
+	.p2align 3
+.L345:
+	movq	(%rbx), %rdi
+	addq	$8, %rbx
+	call	free@PLT
+	cmpq	%r12, %rbx
+	jne	.L345
+.L331:
+	movq	104(%r14), %rdi
+	testq	%r15, %r15
+	jne	.L346
+	testq	%rdi, %rdi
+	je	.L319
+	call	freeORT@PLT
+	movq	$0, 104(%r14)
+.L319:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L372:
+	.cfi_restore_state
+	jne	.L340
+	addl	$1, 4(%r15)
+	addq	$1, %r13
+	cmpq	%r13, -88(%rbp)
+	jne	.L341
+	jmp	.L373
+.L346:
+	testq	%rdi, %rdi
+	jne	.L319
+	movq	%r14, %rdi
+	call	indexMLCS.part.0
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L322:
+	.cfi_restore_state
+	cmpl	$1, 32(%r14)
+	jg	.L332
+	movl	$0, 16(%r14)
+	movq	%r14, %rdi
+	movl	$0, 4(%r14)
+	call	buildFronts
+	jmp	.L331
+.L369:
+	movl	$0, 16(%r14)
+	movl	$0, 4(%r14)
+	jmp	.L334
+.L371:
+	movq	%r14, %rdi
+	call	buildFronts
+	jmp	.L331
+	.cfi_endproc
+.LFE43:
+	.size	rebuildMLCS, .-rebuildMLCS
+	.p2align 4
+	.type	resizeMLCS, @function
+resizeMLCS:
+.LFB87:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movl	%esi, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	104(%rdi), %r13
+	testq	%r13, %r13
+	je	.L375
+	movq	%r13, %rdi
+	call	freeORT@PLT
+	movq	$0, 104(%rbp)
+.L375:
+	movl	32(%rbp), %eax
+	xorl	%ebx, %ebx
+	testl	%eax, %eax
+	jg	.L393
+	jmp	.L381
+	.p2align 4,,10
+	.p2align 3
+.L394:
+	movl	%ebx, %esi
+	movq	%rbp, %rdi
+	addq	$1, %rbx
+	call	freeFront
+	movl	32(%rbp), %eax
+	cmpl	%ebx, %eax
+	jle	.L381
+.L393:
+	movq	24(%rbp), %rdx
+.L376:
+	cmpq	$0, (%rdx,%rbx,8)
+	jne	.L394
+	addq	$1, %rbx
+	cmpl	%ebx, %eax
+	jg	.L376
+.L381:
+	movl	$0, 16(%rbp)
+	movq	112(%rbp), %rdi
+	movl	%r12d, 0(%rbp)
+	call	freeSK@PLT
+	movl	%r12d, %edi
+	call	allocSK@PLT
+	movslq	%r12d, %rdi
+	movq	%rax, 112(%rbp)
+	salq	$2, %rdi
+	call	malloc@PLT
+	movq	%rax, %rbx
+	testl	%r12d, %r12d
+	jle	.L378
+	movl	%r12d, %edx
+	movl	$255, %esi
+	movq	%rax, %rdi
+	salq	$2, %rdx
+	call	memset@PLT
+.L378:
+	movq	24(%rbp), %r14
+	movl	%r12d, %edi
+	call	allocORT@PLT
+	movq	%rbx, %rsi
+	movq	%rax, (%r14)
+	movq	24(%rbp), %rax
+	movq	(%rax), %rdi
+	call	insert@PLT
+	movq	%rbx, %rdi
+	call	free@PLT
+	movl	36(%rbp), %ebx
+	movl	$0, 36(%rbp)
+	movq	%rbp, %rdi
+	call	rebuildMLCS
+	movl	%ebx, 36(%rbp)
+	testq	%r13, %r13
+	je	.L395
+	cmpq	$0, 104(%rbp)
+	je	.L396
+.L374:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L395:
+	.cfi_restore_state
+	movq	104(%rbp), %rdi
+	testq	%rdi, %rdi
+	je	.L374
+	call	freeORT@PLT
+	movq	$0, 104(%rbp)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L396:
+	.cfi_restore_state
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	movq	%rbp, %rdi
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	indexMLCS.part.0
+	.cfi_endproc
+.LFE87:
+	.size	resizeMLCS, .-resizeMLCS
+	.p2align 4
+	.type	insertMinima.constprop.0, @function
+insertMinima.constprop.0:
+.LFB111:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.cfi_offset 15, -24
+	movq	%rdi, %r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movl	%esi, %ebx
+	subq	$40, %rsp
+	movq	112(%rdi), %rdi
+	movl	%esi, -76(%rbp)
+	call	minimaSK@PLT
+	testl	%eax, %eax
+	jle	.L397
+	movslq	%ebx, %r14
+	movl	%eax, %r13d
+	xorl	%r12d, %r12d
+	movq	%r14, %rax
+	salq	$3, %r14
+	negl	%eax
+	movl	%eax, -80(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L401:
+	movq	112(%r15), %rdi
+	movl	%r12d, %esi
+	call	pointSK@PLT
+	movq	%rax, %rbx
+	movq	24(%r15), %rax
+	movq	%rbx, %rsi
+	movq	(%rax,%r14), %rdi
+	call	insert@PLT
+	movq	104(%r15), %r8
+	testq	%r8, %r8
+	movq	%r8, -56(%rbp)
+	je	.L399
+	movl	(%r15), %eax
+	movq	%rsp, -64(%rbp)
+	movq	%rbx, %rsi
+	leal	1(%rax), %ecx
+	movslq	%ecx, %rcx
+	salq	$2, %rcx
+	leaq	15(%rcx), %rax
+	leaq	-4(%rcx), %rdx
+	movq	%rcx, -72(%rbp)
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %rdi
+	call	memcpy@PLT
+	movq	-72(%rbp), %rcx
+	movq	%rax, %rdi
+	movl	-80(%rbp), %eax
+	movq	%rdi, %rsi
+	movl	%eax, -4(%rdi,%rcx)
+	movq	-56(%rbp), %rdi
+	call	insert@PLT
+	movq	-64(%rbp), %rsp
+.L399:
+	movq	88(%r15), %rax
+	testq	%rax, %rax
+	je	.L400
+	movl	(%r15), %ecx
+	movq	96(%r15), %rdi
+	movl	$1, %r8d
+	movq	%rbx, %rdx
+	movl	-76(%rbp), %esi
+	call	*%rax
+.L400:
+	addl	$1, %r12d
+	cmpl	%r12d, %r13d
+	jne	.L401
+.L397:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE111:
+	.size	insertMinima.constprop.0, .-insertMinima.constprop.0
+	.p2align 4
+	.type	repairEnd, @function
+repairEnd:
+.LFB62:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.cfi_offset 15, -24
+	movq	%rdi, %r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$120, %rsp
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	32(%rsi), %rdi
+	movq	%rsi, -72(%rbp)
+	call	isEmptyPQ@PLT
+	movq	-72(%rbp), %r8
+	testl	%eax, %eax
+	movl	%eax, %r12d
+	jne	.L440
+.L411:
+	movq	%r8, %rdi
+	call	freeRepair
+	leaq	-40(%rbp), %rsp
+	movl	%r12d, %eax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L440:
+	.cfi_restore_state
+	movq	48(%r8), %rcx
+	movl	24(%r8), %edx
+	movq	%r15, %rsi
+	movq	40(%r8), %rdi
+	call	cleanCovered
+	movq	-72(%rbp), %r8
+	movsbl	4(%r8), %r14d
+	testb	%r14b, %r14b
+	je	.L411
+	movl	16(%r15), %eax
+	movl	24(%r8), %ebx
+	addl	$1, %eax
+	movl	%ebx, -92(%rbp)
+	cmpl	%ebx, %eax
+	jl	.L411
+	leaq	-52(%rbp), %rax
+	movl	%r12d, -148(%rbp)
+	movq	%rax, -128(%rbp)
+	jmp	.L424
+	.p2align 4,,10
+	.p2align 3
+.L412:
+	movq	%r8, -72(%rbp)
+	movq	-120(%rbp), %rsp
+	movq	%rax, %rdi
+	call	free@PLT
+	movq	-72(%rbp), %r8
+	movl	24(%r8), %eax
+	leal	1(%rax), %ebx
+	movl	%ebx, -92(%rbp)
+	movl	%ebx, 24(%r8)
+	cmpl	16(%r15), %eax
+	jg	.L438
+	movsbl	4(%r8), %r14d
+.L424:
+	movl	(%r8), %eax
+	movq	80(%r8), %rdx
+	movq	%r8, -88(%rbp)
+	movq	72(%r8), %rsi
+	movq	-128(%rbp), %rcx
+	movl	%eax, -80(%rbp)
+	movslq	-92(%rbp), %rax
+	movq	48(%r8), %r12
+	leaq	0(,%rax,8), %rbx
+	movq	24(%r15), %rax
+	movq	%rbx, -104(%rbp)
+	movq	-8(%rax,%rbx), %rdi
+	call	rangeCollect@PLT
+	movslq	(%r15), %rdx
+	movl	-52(%rbp), %ecx
+	movq	%rsp, -120(%rbp)
+	movq	-88(%rbp), %r8
+	movl	%edx, -72(%rbp)
+	leaq	15(,%rdx,4), %rdx
+	andq	$-16, %rdx
+	movl	%ecx, -96(%rbp)
+	subq	%rdx, %rsp
+	testl	%ecx, %ecx
+	movq	%rsp, -112(%rbp)
+	jle	.L412
+	movq	112(%r15), %rdi
+	movq	%rax, -88(%rbp)
+	movq	%r8, -136(%rbp)
+	call	clearSK@PLT
+	movq	-88(%rbp), %rax
+	movslq	-96(%rbp), %rcx
+	leaq	(%rax,%rcx,8), %rcx
+	movq	%rax, -144(%rbp)
+	movq	%rax, %rbx
+	movq	%rcx, -88(%rbp)
+.L413:
+	movl	-72(%rbp), %eax
+	movq	(%rbx), %rdi
+	testl	%eax, %eax
+	jle	.L423
+.L421:
+	xorl	%r13d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L418:
+	movq	8(%r15), %rax
+	movl	(%rdi,%r13,4), %edx
+	movl	%r14d, %esi
+	movq	(%rax,%r13,8), %rdi
+	addl	$1, %edx
+	call	stringCeil@PLT
+	movl	%eax, (%r12,%r13,4)
+	cmpl	%r13d, -80(%rbp)
+	je	.L441
+	leal	1(%r13), %edx
+	cmpl	%edx, -72(%rbp)
+	movq	(%rbx), %rdi
+	setg	%cl
+	cmpl	$-2, %eax
+	setne	%dl
+	addq	$1, %r13
+	testb	%dl, %cl
+	jne	.L418
+	xorl	%r13d, %r13d
+	cmpl	$-2, %eax
+	sete	%r13b
+	call	free@PLT
+	testl	%r13d, %r13d
+	je	.L419
+.L442:
+	movq	-88(%rbp), %rax
+	addq	$8, %rbx
+	cmpq	%rax, %rbx
+	je	.L437
+	movq	(%rbx), %rdi
+	jmp	.L421
+	.p2align 4,,10
+	.p2align 3
+.L441:
+	movq	8(%r15), %rax
+	movq	(%rax,%r13,8), %rdi
+	call	stringEnd@PLT
+	movq	(%rbx), %rdi
+	leal	1(%r13), %ecx
+	cmpl	%ecx, -72(%rbp)
+	movl	%eax, (%r12,%r13,4)
+	setg	%sil
+	movl	(%rdi,%r13,4), %edx
+	cmpl	%edx, %eax
+	setne	%cl
+	addq	$1, %r13
+	testb	%cl, %sil
+	jne	.L418
+	xorl	%r13d, %r13d
+	cmpl	%edx, %eax
+	sete	%r13b
+	call	free@PLT
+	testl	%r13d, %r13d
+	jne	.L442
+	.p2align 4,,10
+	.p2align 3
+.L419:
+	movl	-72(%rbp), %r13d
+	movq	%r12, %rdi
+	movl	%r13d, %esi
+	call	plusPlus@PLT
+	movq	-104(%rbp), %rsi
+	movq	24(%r15), %rax
+	movq	-112(%rbp), %rdx
+	movq	(%rax,%rsi), %rdi
+	movq	%r12, %rsi
+	call	dominatedFind@PLT
+	movl	%r13d, %esi
+	movq	%r12, %rdi
+	movl	%eax, -96(%rbp)
+	call	minusMinus@PLT
+	movl	-96(%rbp), %eax
+	testl	%eax, %eax
+	je	.L443
+.L422:
+	addq	$8, %rbx
+	cmpq	%rbx, -88(%rbp)
+	jne	.L413
+.L437:
+	movq	-144(%rbp), %rax
+	movq	-136(%rbp), %r8
+	movq	%r15, %rdi
+	movl	-92(%rbp), %esi
+	movq	%r8, -80(%rbp)
+	movq	%rax, -72(%rbp)
+	call	insertMinima.constprop.0
+	movq	-80(%rbp), %r8
+	movq	-72(%rbp), %rax
+	jmp	.L412
+	.p2align 4,,10
+	.p2align 3
+.L423:
+	call	free@PLT
+	jmp	.L419
+	.p2align 4,,10
+	.p2align 3
+.L443:
+	movq	112(%r15), %rdi
+	movq	%r12, %rsi
+	call	addSK@PLT
+	jmp	.L422
+.L438:
+	movl	-148(%rbp), %r12d
+	jmp	.L411
+	.cfi_endproc
+.LFE62:
+	.size	repairEnd, .-repairEnd
+	.p2align 4
+	.type	repairRun, @function
+repairRun:
+.LFB61:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.cfi_offset 15, -24
+	movq	%rdi, %r15
+	pushq	%r14
+	.cfi_offset 14, -32
+	movq	%rsi, %r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$216, %rsp
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movl	(%rsi), %r8d
+	movzbl	4(%rsi), %eax
+	movq	%rdx, -176(%rbp)
+	movq	8(%rdi), %rdx
+	movq	16(%rsi), %r10
+	movq	%rsi, -256(%rbp)
+	movb	%al, -233(%rbp)
+	movslq	%r8d, %rax
+	leaq	0(,%rax,8), %rcx
+	movq	%r10, -168(%rbp)
+	movq	%rcx, -248(%rbp)
+	movq	(%rdx,%rax,8), %rcx
+	salq	$2, %rax
+	movslq	(%rdi), %rdx
+	movq	%rax, -224(%rbp)
+	movq	%rcx, -184(%rbp)
+	movq	32(%rsi), %rcx
+	movl	%r8d, -96(%rbp)
+	movq	%rcx, -104(%rbp)
+	movq	40(%rsi), %rcx
+	movq	-104(%rbp), %rdi
+	movl	%edx, -144(%rbp)
+	movq	%rcx, -136(%rbp)
+	movq	48(%rsi), %rcx
+	leaq	0(,%rdx,4), %rsi
+	movq	%rsi, -80(%rbp)
+	addq	%rcx, %rax
+	movq	%rcx, -120(%rbp)
+	movq	%rax, -160(%rbp)
+	leaq	-52(%rbp), %rax
+	movq	%rax, -232(%rbp)
+	call	isEmptyPQ@PLT
+	testl	%eax, %eax
+	jne	.L514
+	.p2align 4,,10
+	.p2align 3
+.L488:
+	movq	16(%r14), %rdx
+	movl	28(%r14), %ecx
+	movq	-168(%rbp), %rsi
+	movq	%rdx, %rax
+	movl	%ecx, -140(%rbp)
+	subq	%rsi, %rax
+	testl	%ecx, %ecx
+	jne	.L444
+	cmpq	%rdx, 8(%r14)
+	jl	.L444
+	cmpq	%rax, -176(%rbp)
+	jle	.L444
+	movq	-104(%rbp), %rdi
+	call	markingTruePQ@PLT
+	testl	%eax, %eax
+	je	.L446
+	movl	24(%r14), %edx
+	movq	-120(%rbp), %rcx
+	movq	%r15, %rsi
+	movq	-136(%rbp), %rdi
+	call	cleanCovered
+	cmpb	$0, -233(%rbp)
+	jne	.L515
+.L447:
+	addl	$1, 24(%r14)
+	movq	-104(%rbp), %rdi
+	call	markPQ@PLT
+	movl	16(%r15), %ecx
+	movl	24(%r14), %eax
+	movq	16(%r14), %rsi
+	addl	$1, %ecx
+	leal	-1(%rax), %edi
+	movl	%eax, -92(%rbp)
+	subl	%eax, %ecx
+	movq	%rsi, %rax
+	movslq	%edi, %rdi
+	cqto
+	movslq	%ecx, %rcx
+	idivq	%rdi
+	imulq	%rax, %rcx
+	leaq	(%rcx,%rsi), %rax
+	cmpq	%rax, 8(%r14)
+	jl	.L516
+.L460:
+	movq	-104(%rbp), %rdi
+	call	topPQ@PLT
+	movq	-80(%rbp), %rdx
+	movq	-120(%rbp), %rdi
+	movq	%rax, %rsi
+	call	memcpy@PLT
+	movq	-160(%rbp), %rax
+	movq	-184(%rbp), %rdi
+	movl	(%rax), %esi
+	call	stringLetter@PLT
+	movl	-144(%rbp), %ecx
+	movsbl	%al, %ebx
+	testl	%ecx, %ecx
+	jle	.L464
+	movl	%ebx, -72(%rbp)
+	movq	%r15, %r13
+	movq	-120(%rbp), %r15
+	xorl	%r12d, %r12d
+	.p2align 4,,10
+	.p2align 3
+.L463:
+	movq	8(%r13), %rax
+	movq	56(%r14), %rbx
+	movl	-72(%rbp), %esi
+	movq	(%rax,%r12,2), %rdi
+	addq	%r12, %rbx
+	call	stringLast@PLT
+	movl	-72(%rbp), %esi
+	movl	%eax, (%rbx)
+	movl	(%r15,%r12), %eax
+	movq	64(%r14), %rbx
+	leal	-1(%rax), %edx
+	movq	8(%r13), %rax
+	addq	%r12, %rbx
+	movq	(%rax,%r12,2), %rdi
+	addq	$4, %r12
+	call	stringFloor@PLT
+	movl	%eax, (%rbx)
+	cmpq	%r12, -80(%rbp)
+	jne	.L463
+	movl	-72(%rbp), %ebx
+	movq	%r13, %r15
+.L464:
+	cmpl	$1, -92(%rbp)
+	movq	56(%r14), %rdx
+	movq	64(%r14), %rsi
+	movl	(%r15), %r9d
+	jne	.L465
+	movq	-160(%rbp), %rcx
+	movq	-224(%rbp), %rax
+	movl	(%rcx), %ecx
+	cmpl	%ecx, (%rdx,%rax)
+	jg	.L517
+.L466:
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L468:
+	movl	-92(%rbp), %ecx
+	addq	16(%r14), %rax
+	movl	$0, -56(%rbp)
+	movq	%rax, 16(%r14)
+	leal	1(%rcx), %edx
+	cmpl	32(%r15), %edx
+	jge	.L479
+	movq	24(%r15), %rdx
+	movslq	%ecx, %r13
+	leaq	1(%r13), %rbx
+	cmpq	$0, 8(%rdx,%r13,8)
+	je	.L479
+	movq	-104(%rbp), %rdi
+	call	topPQ@PLT
+	leaq	-56(%rbp), %rdx
+	movq	%rax, %rsi
+	movq	24(%r15), %rax
+	movq	(%rax,%rbx,8), %rdi
+	call	collect@PLT
+	movq	-104(%rbp), %rdi
+	movq	%rax, %r12
+	movl	-56(%rbp), %eax
+	addl	$1, %eax
+	cltq
+	addq	%rax, 16(%r14)
+	call	topPQ@PLT
+	movl	-92(%rbp), %esi
+	movq	%r15, %rdi
+	movq	%rax, %rdx
+	call	frontDelete
+	movl	-56(%rbp), %edx
+	testl	%edx, %edx
+	jle	.L486
+.L480:
+	leaq	0(,%r13,8), %rbx
+	movq	%r12, -72(%rbp)
+	movq	%rbx, %r13
+	movl	-140(%rbp), %ebx
+	.p2align 4,,10
+	.p2align 3
+.L487:
+	movq	24(%r15), %rax
+	movq	(%r12), %rsi
+	movq	(%rax,%r13), %rdi
+	call	countQ@PLT
+	testl	%eax, %eax
+	jne	.L483
+	movq	(%r12), %rsi
+	movq	-104(%rbp), %rdi
+	addl	$1, %ebx
+	addq	$8, %r12
+	call	pushPQ@PLT
+	movq	-80(%rbp), %rdi
+	call	malloc@PLT
+	movq	-80(%rbp), %rdx
+	movq	-8(%r12), %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movq	-136(%rbp), %rdi
+	movq	%rax, %rsi
+	call	pushPQ@PLT
+	movq	-8(%r12), %rdx
+	movl	-92(%rbp), %esi
+	movq	%r15, %rdi
+	call	frontInsert
+	cmpl	%ebx, -56(%rbp)
+	jg	.L487
+.L513:
+	movq	-72(%rbp), %r12
+.L486:
+	testq	%r12, %r12
+	je	.L482
+	movq	%r12, %rdi
+	call	free@PLT
+.L482:
+	movq	-104(%rbp), %rbx
+	movq	%rbx, %rdi
+	call	topPQ@PLT
+	movq	%rax, %rdi
+	call	free@PLT
+	movq	%rbx, %rdi
+	call	popPQ@PLT
+	movq	-104(%rbp), %rdi
+	call	isEmptyPQ@PLT
+	testl	%eax, %eax
+	je	.L488
+.L514:
+	movq	-256(%rbp), %rax
+	movq	-168(%rbp), %r10
+	movq	16(%rax), %rax
+	subq	%r10, %rax
+.L444:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L517:
+	.cfi_restore_state
+	movslq	%r9d, %rax
+	movl	%r9d, -72(%rbp)
+	leaq	0(,%rax,4), %r13
+	movq	%r13, %rdi
+	call	malloc@PLT
+	movq	-120(%rbp), %rsi
+	movq	%r13, %rdx
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	memcpy@PLT
+	movq	-224(%rbp), %rax
+	movq	-248(%rbp), %rcx
+	movl	%ebx, %esi
+	leaq	(%r12,%rax), %r13
+	movl	0(%r13), %eax
+	leal	1(%rax), %edx
+	movq	8(%r15), %rax
+	movq	(%rax,%rcx), %rdi
+	call	stringCeil@PLT
+	movl	-72(%rbp), %esi
+	movq	%r12, %rdi
+	movl	%eax, 0(%r13)
+	call	plusPlus@PLT
+	movq	24(%r15), %rax
+	movq	%r12, %rsi
+	movq	8(%rax), %rdi
+	call	countQ@PLT
+	movl	-72(%rbp), %esi
+	movq	%r12, %rdi
+	movl	%eax, %ebx
+	call	minusMinus@PLT
+	cmpl	$1, %ebx
+	je	.L518
+	movq	%r12, %rdi
+	call	free@PLT
+	jmp	.L466
+	.p2align 4,,10
+	.p2align 3
+.L483:
+	movq	(%r12), %rdi
+	addl	$1, %ebx
+	addq	$8, %r12
+	call	free@PLT
+	cmpl	%ebx, -56(%rbp)
+	jg	.L487
+	jmp	.L513
+	.p2align 4,,10
+	.p2align 3
+.L479:
+	addq	$1, %rax
+	movq	-104(%rbp), %rdi
+	xorl	%r12d, %r12d
+	movq	%rax, 16(%r14)
+	call	topPQ@PLT
+	movl	-92(%rbp), %ebx
+	movq	%r15, %rdi
+	movq	%rax, %rdx
+	movl	%ebx, %esi
+	movslq	%ebx, %r13
+	call	frontDelete
+	movl	-56(%rbp), %eax
+	testl	%eax, %eax
+	jg	.L480
+	jmp	.L482
+	.p2align 4,,10
+	.p2align 3
+.L446:
+	movl	24(%r14), %eax
+	movl	%eax, -92(%rbp)
+	jmp	.L460
+	.p2align 4,,10
+	.p2align 3
+.L465:
+	movslq	-92(%rbp), %r13
+	movq	-232(%rbp), %r8
+	movl	%r9d, -72(%rbp)
+	movq	%rsp, -192(%rbp)
+	leaq	0(,%r13,8), %rax
+	movq	%rax, %rcx
+	movq	%rax, -152(%rbp)
+	movq	24(%r15), %rax
+	movq	-8(%rax,%rcx), %rdi
+	movq	-120(%rbp), %rcx
+	call	cornerCollect@PLT
+	movslq	-72(%rbp), %rsi
+	movl	-52(%rbp), %ecx
+	movq	%rax, %rdi
+	movq	%rsi, %r9
+	salq	$2, %rsi
+	movl	%ecx, -200(%rbp)
+	leaq	15(%rsi), %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %r13
+	testl	%ecx, %ecx
+	jle	.L469
+	movl	$0, -88(%rbp)
+	movq	%rdi, %r12
+	movq	%rdi, -208(%rbp)
+	movq	%rsi, -128(%rbp)
+	movl	%ebx, -72(%rbp)
+	movq	%r13, %rbx
+	movq	%r14, -216(%rbp)
+	movl	%r9d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L470:
+	movq	(%r12), %rdi
+	xorl	%r13d, %r13d
+	testl	%r14d, %r14d
+	jle	.L519
+	movl	%r14d, -112(%rbp)
+	movq	%r12, %r14
+	movq	%rbx, %r12
+	movq	%r15, %rbx
+	movq	%r13, %r15
+	movq	-128(%rbp), %r13
+	jmp	.L471
+	.p2align 4,,10
+	.p2align 3
+.L520:
+	movq	(%r14), %rdi
+.L471:
+	movq	8(%rbx), %rax
+	movl	(%rdi,%r15), %edx
+	movl	-72(%rbp), %esi
+	movq	(%rax,%r15,2), %rdi
+	addl	$1, %edx
+	call	stringCeil@PLT
+	movl	%eax, (%r12,%r15)
+	addq	$4, %r15
+	cmpq	%r15, %r13
+	jne	.L520
+	movq	%rbx, %r15
+	movq	%r12, %rbx
+	movq	%r14, %r12
+	movl	-112(%rbp), %r14d
+	movq	(%r12), %rdi
+	call	free@PLT
+	movq	-120(%rbp), %rdi
+	movl	$1, %eax
+	.p2align 4,,10
+	.p2align 3
+.L474:
+	movl	-4(%rdi,%rax,4), %edx
+	movl	-4(%rbx,%rax,4), %r13d
+	cmpl	%r13d, %edx
+	sete	%sil
+	cmpl	%eax, %r14d
+	setg	%cl
+	addq	$1, %rax
+	testb	%cl, %sil
+	jne	.L474
+	movl	%r14d, %esi
+	movq	%rbx, %rdi
+	movl	%edx, -112(%rbp)
+	call	plusPlus@PLT
+	movl	-112(%rbp), %edx
+	cmpl	%r13d, %edx
+	jne	.L475
+.L473:
+	movl	%r14d, %esi
+	movq	%rbx, %rdi
+	call	minusMinus@PLT
+.L476:
+	addl	$1, -88(%rbp)
+	addq	$8, %r12
+	movl	-88(%rbp), %eax
+	cmpl	-52(%rbp), %eax
+	jl	.L470
+	movq	-208(%rbp), %rdi
+	movq	-216(%rbp), %r14
+.L469:
+	call	free@PLT
+	movq	-192(%rbp), %rsp
+	movslq	-200(%rbp), %rax
+	jmp	.L468
+	.p2align 4,,10
+	.p2align 3
+.L475:
+	movq	24(%r15), %rax
+	movq	-152(%rbp), %rcx
+	movq	%rbx, %rsi
+	movq	(%rax,%rcx), %rdi
+	call	countQ@PLT
+	movl	%r14d, %esi
+	movq	%rbx, %rdi
+	cmpl	$1, %eax
+	je	.L521
+	call	minusMinus@PLT
+	jmp	.L476
+	.p2align 4,,10
+	.p2align 3
+.L521:
+	call	minusMinus@PLT
+	movq	-128(%rbp), %rdi
+	call	malloc@PLT
+	movq	-128(%rbp), %rdx
+	movq	%rbx, %rsi
+	movq	%rax, %rdi
+	movq	%rax, %r13
+	call	memcpy@PLT
+	movl	-92(%rbp), %esi
+	movq	%r15, %rdi
+	movq	%r13, %rdx
+	call	frontInsert
+	movq	-136(%rbp), %rdi
+	movq	%r13, %rsi
+	call	pushPQ@PLT
+	jmp	.L476
+	.p2align 4,,10
+	.p2align 3
+.L519:
+	call	free@PLT
+	movl	%r14d, %esi
+	movq	%rbx, %rdi
+	call	plusPlus@PLT
+	jmp	.L473
+.L515:
+	movslq	24(%r14), %rax
+	movq	80(%r14), %rdx
+	movq	72(%r14), %rsi
+	movl	%eax, -192(%rbp)
+	salq	$3, %rax
+	movq	%rax, %rcx
+	movq	%rax, -112(%rbp)
+	movq	24(%r15), %rax
+	movq	-8(%rax,%rcx), %rdi
+	movq	-232(%rbp), %rcx
+	call	rangeCollect@PLT
+	movslq	(%r15), %rdx
+	movl	-52(%rbp), %ecx
+	movq	%rsp, -152(%rbp)
+	movq	%rdx, %r12
+	leaq	15(,%rdx,4), %rdx
+	movl	%ecx, -72(%rbp)
+	andq	$-16, %rdx
+	subq	%rdx, %rsp
+	testl	%ecx, %ecx
+	movq	%rsp, -128(%rbp)
+	jg	.L522
+.L448:
+	movq	-152(%rbp), %rsp
+	movq	%rax, %rdi
+	call	free@PLT
+	jmp	.L447
+.L522:
+	movq	112(%r15), %rdi
+	movsbl	-233(%rbp), %r13d
+	movq	%rax, -88(%rbp)
+	call	clearSK@PLT
+	movq	-88(%rbp), %rax
+	movslq	-72(%rbp), %rcx
+	movl	%r12d, -72(%rbp)
+	movq	%r14, -208(%rbp)
+	movq	-120(%rbp), %r14
+	leaq	(%rax,%rcx,8), %rcx
+	movq	%rax, -200(%rbp)
+	movq	%rax, %rbx
+	movq	%rcx, -88(%rbp)
+.L449:
+	movl	-72(%rbp), %esi
+	movq	(%rbx), %rdi
+	testl	%esi, %esi
+	jle	.L459
+.L457:
+	xorl	%r12d, %r12d
+	.p2align 4,,10
+	.p2align 3
+.L454:
+	movq	8(%r15), %rax
+	movl	(%rdi,%r12,4), %edx
+	movl	%r13d, %esi
+	movq	(%rax,%r12,8), %rdi
+	addl	$1, %edx
+	call	stringCeil@PLT
+	movl	%eax, (%r14,%r12,4)
+	cmpl	%r12d, -96(%rbp)
+	je	.L523
+	leal	1(%r12), %edx
+	cmpl	%edx, -72(%rbp)
+	movq	(%rbx), %rdi
+	setg	%cl
+	cmpl	$-2, %eax
+	setne	%dl
+	addq	$1, %r12
+	testb	%dl, %cl
+	jne	.L454
+	xorl	%r12d, %r12d
+	cmpl	$-2, %eax
+	sete	%r12b
+	call	free@PLT
+	testl	%r12d, %r12d
+	je	.L455
+.L524:
+	movq	-88(%rbp), %rax
+	addq	$8, %rbx
+	cmpq	%rax, %rbx
+	je	.L507
+	movq	(%rbx), %rdi
+	jmp	.L457
+	.p2align 4,,10
+	.p2align 3
+.L523:
+	movq	8(%r15), %rax
+	movq	(%rax,%r12,8), %rdi
+	call	stringEnd@PLT
+	movq	(%rbx), %rdi
+	movl	-72(%rbp), %esi
+	leal	1(%r12), %ecx
+	movl	%eax, (%r14,%r12,4)
+	movl	(%rdi,%r12,4), %edx
+	cmpl	%esi, %ecx
+	setl	%sil
+	cmpl	%edx, %eax
+	setne	%cl
+	addq	$1, %r12
+	testb	%cl, %sil
+	jne	.L454
+	xorl	%r12d, %r12d
+	cmpl	%edx, %eax
+	sete	%r12b
+	call	free@PLT
+	testl	%r12d, %r12d
+	jne	.L524
+.L455:
+	movl	-72(%rbp), %r12d
+	movq	%r14, %rdi
+	movl	%r12d, %esi
+	call	plusPlus@PLT
+	movq	-112(%rbp), %rcx
+	movq	24(%r15), %rax
+	movq	%r14, %rsi
+	movq	-128(%rbp), %rdx
+	movq	(%rax,%rcx), %rdi
+	call	dominatedFind@PLT
+	movl	%r12d, %esi
+	movq	%r14, %rdi
+	movl	%eax, -92(%rbp)
+	call	minusMinus@PLT
+	movl	-92(%rbp), %eax
+	testl	%eax, %eax
+	je	.L525
+.L458:
+	addq	$8, %rbx
+	cmpq	%rbx, -88(%rbp)
+	jne	.L449
+.L507:
+	movq	-200(%rbp), %rax
+	movl	-192(%rbp), %esi
+	movq	%r15, %rdi
+	movq	-208(%rbp), %r14
+	movq	%rax, -72(%rbp)
+	call	insertMinima.constprop.0
+	movq	-72(%rbp), %rax
+	jmp	.L448
+.L525:
+	movq	112(%r15), %rdi
+	movq	%r14, %rsi
+	call	addSK@PLT
+	jmp	.L458
+.L459:
+	call	free@PLT
+	jmp	.L455
+.L518:
+	movq	%r15, %rdi
+	movq	%r12, %rdx
+	movl	$1, %esi
+	call	frontInsert
+	movq	-136(%rbp), %rdi
+	movq	%r12, %rsi
+	call	pushPQ@PLT
+	jmp	.L466
+.L516:
+	movq	-256(%rbp), %rax
+	movq	-168(%rbp), %r10
+	movl	$1, 28(%rax)
+	leaq	-40(%rbp), %rsp
+	movq	%rsi, %rax
+	popq	%rbx
+	subq	%r10, %rax
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE61:
+	.size	repairRun, .-repairRun
+	.p2align 4
+	.type	finishRepair, @function
+finishRepair:
+.LFB67:
+	.cfi_startproc
+	movq	128(%rdi), %rsi
+	testq	%rsi, %rsi
+	je	.L533
+	movabsq	$9223372036854775807, %rdx
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	call	repairRun
+	movq	128(%rbx), %rsi
+	movq	%rbx, %rdi
+	movslq	(%rsi), %rbp
+	movq	$0, 128(%rbx)
+	call	repairEnd
+	movslq	16(%rbx), %rdx
+	movq	24(%rbx), %rax
+	movq	(%rax,%rdx,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	jne	.L528
+	subl	$1, 16(%rbx)
+.L528:
+	movq	8(%rbx), %rax
+	movq	(%rax,%rbp,8), %rdi
+	call	stringPop@PLT
+	movq	40(%rbx), %rax
+	subl	$1, (%rax,%rbp,4)
+	addl	$1, 76(%rbx)
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L533:
+	.cfi_restore 3
+	.cfi_restore 6
+	ret
+	.cfi_endproc
+.LFE67:
+	.size	finishRepair, .-finishRepair
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC3:
+	.string	"@ %d : "
+.LC4:
+	.string	") "
+.LC5:
+	.string	"%d, "
+	.text
+	.p2align 4
+	.globl	printMLCS
+	.type	printMLCS, @function
+printMLCS:
+.LFB22:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	movq	%rdi, %r12
+	pushq	%rbx
+	subq	$56, %rsp
+	.cfi_offset 3, -56
+	movslq	(%rdi), %rdx
+	movq	%rdx, %rax
+	leaq	15(,%rdx,4), %rdx
+	andq	$-16, %rdx
+	subq	%rdx, %rsp
+	movq	%rsp, -88(%rbp)
+	testl	%eax, %eax
+	jle	.L540
+	movl	%eax, %eax
+	movq	%rsp, %rdi
+	movl	$255, %esi
+	leaq	0(,%rax,4), %rdx
+	call	memset@PLT
+.L540:
+	movl	16(%r12), %ecx
+	leaq	-52(%rbp), %rax
+	movq	$0, -72(%rbp)
+	leaq	.LC5(%rip), %r13
+	movq	%rax, -96(%rbp)
+	testl	%ecx, %ecx
+	js	.L536
+	.p2align 4,,10
+	.p2align 3
+.L538:
+	movl	$10, %edi
+	xorl	%r14d, %r14d
+	call	putchar@PLT
+	movq	-72(%rbp), %rbx
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	movl	%ebx, %esi
+	call	printf@PLT
+	movq	24(%r12), %rax
+	movq	-96(%rbp), %rdx
+	movl	$0, -52(%rbp)
+	movq	-88(%rbp), %rsi
+	movq	(%rax,%rbx,8), %rdi
+	call	collect@PLT
+	movl	-52(%rbp), %edx
+	movq	%rax, -80(%rbp)
+	movq	%rax, %rbx
+	testl	%edx, %edx
+	jle	.L544
+	.p2align 4,,10
+	.p2align 3
+.L543:
+	movl	$40, %edi
+	xorl	%r15d, %r15d
+	call	putchar@PLT
+	movl	(%r12), %eax
+	testl	%eax, %eax
+	jle	.L545
+	.p2align 4,,10
+	.p2align 3
+.L542:
+	movq	(%rbx), %rax
+	movq	%r13, %rdi
+	movl	(%rax,%r15,4), %esi
+	xorl	%eax, %eax
+	addq	$1, %r15
+	call	printf@PLT
+	cmpl	%r15d, (%r12)
+	jg	.L542
+.L545:
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, %r14d
+	addq	$8, %rbx
+	call	printf@PLT
+	movq	-8(%rbx), %rdi
+	call	free@PLT
+	cmpl	%r14d, -52(%rbp)
+	jg	.L543
+.L544:
+	movl	$10, %edi
+	call	putchar@PLT
+	movq	-80(%rbp), %rdi
+	call	free@PLT
+	addq	$1, -72(%rbp)
+	movq	-72(%rbp), %rax
+	cmpl	%eax, 16(%r12)
+	jge	.L538
+.L536:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	printMLCS, .-printMLCS
+	.p2align 4
+	.globl	allocMLCS
+	.type	allocMLCS, @function
+allocMLCS:
+.LFB23:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movslq	%edi, %r14
+	movl	$136, %edi
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%r14, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%esi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	call	malloc@PLT
+	movd	%r14d, %xmm1
+	movl	$8, %esi
+	movl	$3, %edi
+	movl	$0, 16(%rax)
+	pshufd	$0xe0, %xmm1, %xmm0
+	movq	%rax, %rbx
+	movl	$3, 32(%rax)
+	movq	%xmm0, (%rax)
+	call	calloc@PLT
+	movl	$8, %esi
+	movq	%r14, %rdi
+	movq	%r14, 8(%rsp)
+	movq	%rax, 24(%rbx)
+	call	calloc@PLT
+	movq	%rax, 8(%rbx)
+	testl	%r14d, %r14d
+	jle	.L556
+	salq	$3, %r14
+	xorl	%r12d, %r12d
+	jmp	.L557
+	.p2align 4,,10
+	.p2align 3
+.L563:
+	movq	8(%rbx), %rax
+.L557:
+	movl	%ebp, %edi
+	leaq	(%rax,%r12), %r15
+	addq	$8, %r12
+	call	stringAlloc@PLT
+	movq	%rax, (%r15)
+	cmpq	%r12, %r14
+	jne	.L563
+.L556:
+	movl	$0, 36(%rbx)
+	pxor	%xmm0, %xmm0
+	movl	%r13d, %edi
+	movq	.LC6(%rip), %rax
+	movq	$0, 64(%rbx)
+	movq	%rax, 56(%rbx)
+	movq	$0, 72(%rbx)
+	movl	$0, 80(%rbx)
+	movq	$0, 88(%rbx)
+	movups	%xmm0, 96(%rbx)
+	call	allocSK@PLT
+	movq	8(%rsp), %r15
+	movl	$4, %esi
+	movq	$0, 120(%rbx)
+	movq	%rax, 112(%rbx)
+	movq	$0, 128(%rbx)
+	movq	%r15, %rdi
+	call	calloc@PLT
+	movl	$8, %esi
+	movq	%r15, %rdi
+	movq	%rax, 40(%rbx)
+	call	calloc@PLT
+	leaq	0(,%r15,4), %rdx
+	movq	%r15, %rcx
+	movq	%rax, 48(%rbx)
+	movq	%rdx, 8(%rsp)
+	testl	%r13d, %r13d
+	jle	.L558
+	salq	$3, %rcx
+	xorl	%r14d, %r14d
+	movq	%rcx, %r12
+	jmp	.L560
+	.p2align 4,,10
+	.p2align 3
+.L564:
+	movq	48(%rbx), %rax
+.L560:
+	movl	%ebp, %edi
+	leaq	(%rax,%r14), %r15
+	addq	$8, %r14
+	call	stringAlloc@PLT
+	movq	%rax, (%r15)
+	cmpq	%r14, %r12
+	jne	.L564
+	movq	8(%rsp), %rdi
+	call	malloc@PLT
+	movl	%r13d, %edx
+	movl	$255, %esi
+	salq	$2, %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	memset@PLT
+.L561:
+	movq	24(%rbx), %r12
+	movl	%r13d, %edi
+	call	allocORT@PLT
+	movq	%rbp, %rsi
+	movq	%rax, (%r12)
+	movq	24(%rbx), %rax
+	movq	(%rax), %rdi
+	call	insert@PLT
+	movq	%rbp, %rdi
+	call	free@PLT
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L558:
+	.cfi_restore_state
+	movq	%rdx, %rdi
+	call	malloc@PLT
+	movq	%rax, %rbp
+	jmp	.L561
+	.cfi_endproc
+.LFE23:
+	.size	allocMLCS, .-allocMLCS
+	.p2align 4
+	.globl	allocMLCSThreshold
+	.type	allocMLCSThreshold, @function
+allocMLCSThreshold:
+.LFB24:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movl	%edx, %ebx
+	call	allocMLCS
+	movl	%ebx, 56(%rax)
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	allocMLCSThreshold, .-allocMLCSThreshold
+	.p2align 4
+	.globl	allocMLCSApprox
+	.type	allocMLCSApprox, @function
+allocMLCSApprox:
+.LFB26:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%edx, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rcx, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	call	allocMLCS
+	testq	%rbx, %rbx
+	leaq	sumScore(%rip), %rdx
+	cmove	%rdx, %rbx
+	movl	%ebp, 60(%rax)
+	movq	%rbx, 64(%rax)
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	allocMLCSApprox, .-allocMLCSApprox
+	.p2align 4
+	.globl	allocMLCSGrow
+	.type	allocMLCSGrow, @function
+allocMLCSGrow:
+.LFB27:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	call	allocMLCS
+	movl	$1, 72(%rax)
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	allocMLCSGrow, .-allocMLCSGrow
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC8:
+	.string	"[STATS] repairs %d rebuilds %d\n"
+	.text
+	.p2align 4
+	.globl	printStatsMLCS
+	.type	printStatsMLCS, @function
+printStatsMLCS:
+.LFB28:
+	.cfi_startproc
+	movl	80(%rdi), %edx
+	movl	76(%rdi), %esi
+	xorl	%eax, %eax
+	leaq	.LC8(%rip), %rdi
+	jmp	printf@PLT
+	.cfi_endproc
+.LFE28:
+	.size	printStatsMLCS, .-printStatsMLCS
+	.p2align 4
+	.globl	feedMLCS
+	.type	feedMLCS, @function
+feedMLCS:
+.LFB29:
+	.cfi_startproc
+	movq	%rsi, 88(%rdi)
+	movq	%rdx, 96(%rdi)
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	feedMLCS, .-feedMLCS
+	.p2align 4
+	.globl	freeMLCS
+	.type	freeMLCS, @function
+freeMLCS:
+.LFB31:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movl	(%rdi), %edx
+	testl	%edx, %edx
+	jle	.L578
+	.p2align 4,,10
+	.p2align 3
+.L575:
+	movq	8(%rbx), %rax
+	movq	(%rax,%rbp,8), %rdi
+	addq	$1, %rbp
+	call	stringFree@PLT
+	cmpl	%ebp, (%rbx)
+	jg	.L575
+.L578:
+	movq	8(%rbx), %rdi
+	xorl	%ebp, %ebp
+	call	free@PLT
+	movl	(%rbx), %eax
+	movq	$0, 8(%rbx)
+	testl	%eax, %eax
+	jle	.L577
+	.p2align 4,,10
+	.p2align 3
+.L576:
+	movq	48(%rbx), %rax
+	movq	(%rax,%rbp,8), %rdi
+	addq	$1, %rbp
+	call	stringFree@PLT
+	cmpl	%ebp, (%rbx)
+	jg	.L576
+.L577:
+	movq	48(%rbx), %rdi
+	call	free@PLT
+	movq	$0, 48(%rbx)
+	movq	40(%rbx), %rdi
+	call	free@PLT
+	movl	32(%rbx), %edx
+	movq	$0, 40(%rbx)
+	testl	%edx, %edx
+	jle	.L602
+	movq	24(%rbx), %rax
+	xorl	%ebp, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L584:
+	movq	(%rax,%rbp,8), %rdi
+	testq	%rdi, %rdi
+	je	.L581
+	call	freeORT@PLT
+	movq	24(%rbx), %rax
+	movl	32(%rbx), %edx
+	movq	$0, (%rax,%rbp,8)
+	addq	$1, %rbp
+	cmpl	%ebp, %edx
+	jg	.L584
+.L583:
+	movq	%rax, %rdi
+	call	free@PLT
+	movq	104(%rbx), %rdi
+	testq	%rdi, %rdi
+	je	.L585
+	call	freeORT@PLT
+.L585:
+	movq	$0, 104(%rbx)
+	movq	112(%rbx), %rdi
+	call	freeSK@PLT
+	movq	128(%rbx), %rdi
+	movq	$0, 112(%rbx)
+	testq	%rdi, %rdi
+	je	.L586
+	call	freeRepair
+.L586:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT
+	.p2align 4,,10
+	.p2align 3
+.L581:
+	.cfi_restore_state
+	addq	$1, %rbp
+	cmpl	%ebp, %edx
+	jg	.L584
+	jmp	.L583
+	.p2align 4,,10
+	.p2align 3
+.L602:
+	movq	24(%rbx), %rax
+	jmp	.L583
+	.cfi_endproc
+.LFE31:
+	.size	freeMLCS, .-freeMLCS
+	.p2align 4
+	.globl	indexMLCS
+	.type	indexMLCS, @function
+indexMLCS:
+.LFB39:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	movq	104(%rdi), %rdi
+	testl	%esi, %esi
+	jne	.L604
+	testq	%rdi, %rdi
+	je	.L603
+	call	freeORT@PLT
+	movq	$0, 104(%rbx)
+.L603:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L604:
+	.cfi_restore_state
+	testq	%rdi, %rdi
+	jne	.L603
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	jmp	indexMLCS.part.0
+	.cfi_endproc
+.LFE39:
+	.size	indexMLCS, .-indexMLCS
+	.p2align 4
+	.globl	buildMLCS
+	.type	buildMLCS, @function
+buildMLCS:
+.LFB57:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rdx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movslq	%edi, %rbx
+	movl	%ebx, %edi
+	call	allocMLCS
+	movq	%rax, %r14
+	testl	%ebx, %ebx
+	jle	.L609
+	leaq	0(%r13,%rbx,8), %r12
+	xorl	%ebp, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L612:
+	movq	0(%r13), %rax
+	cmpb	$0, (%rax)
+	je	.L610
+	subl	$1, 4(%r14)
+	movsbl	(%rax), %esi
+	testb	%sil, %sil
+	je	.L610
+	movl	$1, %ebx
+	.p2align 4,,10
+	.p2align 3
+.L611:
+	movq	8(%r14), %rax
+	movq	(%rax,%rbp), %rdi
+	call	stringAppend@PLT
+	movq	0(%r13), %rax
+	movsbl	(%rax,%rbx), %esi
+	addq	$1, %rbx
+	testb	%sil, %sil
+	jne	.L611
+.L610:
+	addq	$8, %r13
+	addq	$8, %rbp
+	cmpq	%r13, %r12
+	jne	.L612
+.L609:
+	movq	%r14, %rdi
+	call	buildFronts
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	movq	%r14, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE57:
+	.size	buildMLCS, .-buildMLCS
+	.p2align 4
+	.globl	rebaseMLCS
+	.type	rebaseMLCS, @function
+rebaseMLCS:
+.LFB68:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.cfi_offset 15, -24
+	movq	%rdi, %r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$56, %rsp
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movslq	(%rdi), %r13
+	leaq	0(,%r13,4), %rcx
+	movl	%r13d, -68(%rbp)
+	movq	%rcx, -80(%rbp)
+	addq	$15, %rcx
+	movq	%rcx, -88(%rbp)
+	andq	$-16, %rcx
+	subq	%rcx, %rsp
+	call	finishRepair
+	movl	-68(%rbp), %edx
+	testl	%edx, %edx
+	jle	.L619
+	movq	%rsp, %r12
+	xorl	%r14d, %r14d
+	xorl	%ebx, %ebx
+	.p2align 4,,10
+	.p2align 3
+.L620:
+	movq	8(%r15), %rax
+	movq	(%rax,%r14,8), %rdi
+	call	stringBegin@PLT
+	testl	%eax, %eax
+	movl	%eax, (%r12,%r14,4)
+	setg	%al
+	addq	$1, %r14
+	orl	%ebx, %eax
+	movzbl	%al, %ebx
+	cmpq	%r14, %r13
+	jne	.L620
+	testb	%al, %al
+	je	.L619
+	movq	-80(%rbp), %rax
+	movq	%r12, %rbx
+	xorl	%r14d, %r14d
+	leaq	(%r12,%rax), %r8
+	.p2align 4,,10
+	.p2align 3
+.L624:
+	movl	(%rbx), %eax
+	testl	%eax, %eax
+	jle	.L623
+	movq	8(%r15), %rsi
+	movq	%r8, -64(%rbp)
+	addq	%r14, %rsi
+	movq	(%rsi), %rdi
+	movq	%rsi, -56(%rbp)
+	call	stringOwn@PLT
+	movq	-56(%rbp), %rsi
+	movq	%rax, (%rsi)
+	movq	8(%r15), %rax
+	movl	(%rbx), %esi
+	movq	(%rax,%r14), %rdi
+	call	stringRebase@PLT
+	movq	-64(%rbp), %r8
+.L623:
+	addq	$4, %rbx
+	addq	$8, %r14
+	cmpq	%r8, %rbx
+	jne	.L624
+	movl	32(%r15), %edx
+	movl	$8, %ebx
+	movl	$1, %r14d
+	cmpl	$1, %edx
+	jg	.L644
+	.p2align 4,,10
+	.p2align 3
+.L630:
+	movq	104(%r15), %r8
+	testq	%r8, %r8
+	je	.L627
+.L626:
+	movq	-88(%rbp), %rax
+	movl	-68(%rbp), %edx
+	movq	%rsp, -56(%rbp)
+	movl	$255, %esi
+	movq	-80(%rbp), %r14
+	movq	%r8, -96(%rbp)
+	andq	$-16, %rax
+	salq	$2, %rdx
+	subq	%rax, %rsp
+	addq	$19, %r14
+	movq	%rdx, -80(%rbp)
+	movq	%rsp, %rbx
+	andq	$-16, %r14
+	subq	%r14, %rsp
+	movq	%rbx, %rdi
+	movq	%rsp, %r14
+	movq	%rsp, -64(%rbp)
+	call	memset@PLT
+	movq	-80(%rbp), %rdx
+	movq	%r12, %rsi
+	movq	%r14, %rdi
+	call	memcpy@PLT
+	movl	(%r15), %eax
+	movl	$0, (%r14,%r13,4)
+	movq	%rbx, %rsi
+	leal	1(%rax), %r13d
+	movslq	%r13d, %r13
+	salq	$2, %r13
+	leaq	15(%r13), %rax
+	leaq	-4(%r13), %rdx
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %rdi
+	call	memcpy@PLT
+	movq	-96(%rbp), %rdi
+	movl	$0, -4(%rax,%r13)
+	movq	%rax, %rsi
+	call	delete@PLT
+	movq	-64(%rbp), %rsp
+	movq	104(%r15), %rdi
+	movq	%r14, %rsi
+	call	rebaseORT@PLT
+	movl	(%r15), %eax
+	movq	%rbx, %rsi
+	leal	1(%rax), %r13d
+	movslq	%r13d, %r13
+	salq	$2, %r13
+	leaq	15(%r13), %rax
+	leaq	-4(%r13), %rdx
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %r8
+	movq	%r8, %rdi
+	call	memcpy@PLT
+	movq	104(%r15), %rdi
+	movl	$0, -4(%rax,%r13)
+	movq	%rax, %rsi
+	call	insert@PLT
+	movq	-56(%rbp), %rsp
+.L627:
+	movq	88(%r15), %rax
+	testq	%rax, %rax
+	je	.L619
+	movq	96(%r15), %rdi
+	movl	-68(%rbp), %ecx
+	xorl	%r8d, %r8d
+	movq	%r12, %rdx
+	xorl	%esi, %esi
+	call	*%rax
+.L619:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L645:
+	.cfi_restore_state
+	movq	%r12, %rsi
+	addl	$1, %r14d
+	addq	$8, %rbx
+	call	rebaseORT@PLT
+	movl	32(%r15), %edx
+	cmpl	%edx, %r14d
+	jge	.L630
+.L644:
+	movq	24(%r15), %rsi
+.L625:
+	movq	(%rsi,%rbx), %rdi
+	testq	%rdi, %rdi
+	jne	.L645
+	addl	$1, %r14d
+	addq	$8, %rbx
+	cmpl	%edx, %r14d
+	jl	.L625
+	movq	104(%r15), %r8
+	testq	%r8, %r8
+	jne	.L626
+	jmp	.L627
+	.cfi_endproc
+.LFE68:
+	.size	rebaseMLCS, .-rebaseMLCS
+	.p2align 4
+	.type	popMany.part.0, @function
+popMany.part.0:
+.LFB104:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movslq	%esi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movl	%edx, %ebx
+	subq	$216, %rsp
+	.cfi_def_cfa_offset 272
+	movq	8(%rdi), %rax
+	leaq	(%rax,%r12,8), %rbp
+	movq	0(%rbp), %rdi
+	call	stringOwn@PLT
+	movq	%rax, 120(%rsp)
+	movq	%rax, 0(%rbp)
+	testl	%ebx, %ebx
+	jg	.L647
+	movl	%ebx, %esi
+	movq	%rax, %rdi
+	call	stringPopMany@PLT
+.L648:
+	movq	%r15, %rdi
+	call	trimFronts
+	movq	8(%r15), %rax
+	movq	(%rax,%r12,8), %rdi
+	call	stringBegin@PLT
+	cmpl	$1073741823, %eax
+	jg	.L788
+	addq	$216, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L647:
+	.cfi_restore_state
+	movq	%rax, %rdi
+	call	stringSize@PLT
+	cmpl	%eax, %ebx
+	je	.L789
+	movq	120(%rsp), %rdi
+	movl	%ebx, %esi
+	call	stringPopMany@PLT
+.L650:
+	movl	16(%r15), %edi
+	testl	%edi, %edi
+	jle	.L648
+	movl	(%r15), %ebx
+	movq	120(%rsp), %rdi
+	movl	%ebx, 24(%rsp)
+	call	stringSigma@PLT
+	movl	%eax, 28(%rsp)
+	movslq	%ebx, %rax
+	leaq	0(,%rax,4), %r14
+	movq	%r14, %rdi
+	movq	%r14, 160(%rsp)
+	call	malloc@PLT
+	movq	%r14, %rdi
+	movq	%rax, 56(%rsp)
+	call	malloc@PLT
+	movq	%r14, %rdi
+	movq	%rax, 128(%rsp)
+	call	malloc@PLT
+	movl	$8, %edi
+	movq	%rax, 144(%rsp)
+	call	malloc@PLT
+	movl	$8, %edi
+	movq	%rax, %rbp
+	call	malloc@PLT
+	movl	%ebx, %edi
+	movq	%rax, 80(%rsp)
+	call	allocPH@PLT
+	movl	%ebx, %edi
+	movq	%rax, 104(%rsp)
+	call	allocPH@PLT
+	movq	%rax, 136(%rsp)
+	call	allocPQ@PLT
+	movq	%r14, %rdi
+	movq	%rax, 48(%rsp)
+	call	malloc@PLT
+	movq	%rax, %rcx
+	testl	%ebx, %ebx
+	jle	.L654
+	movl	24(%rsp), %edx
+	movl	$255, %esi
+	movq	%rax, %rdi
+	salq	$2, %rdx
+	call	memset@PLT
+	movq	%rax, %rcx
+.L654:
+	movq	48(%rsp), %rdi
+	movq	%rcx, %rsi
+	call	pushPQ@PLT
+	movl	16(%r15), %esi
+	testl	%esi, %esi
+	jle	.L785
+	movq	144(%rsp), %rax
+	movq	%rbp, %r14
+	movl	$0, 88(%rsp)
+	movl	88(%rsp), %ecx
+	movq	%r12, 152(%rsp)
+	leaq	(%rax,%r12,4), %rbx
+	movl	$1, 116(%rsp)
+	movq	%rax, %r12
+	movq	%rbx, 168(%rsp)
+	leaq	200(%rsp), %rbx
+	movq	$8, 40(%rsp)
+	movl	$1, 112(%rsp)
+	movq	%rbx, 176(%rsp)
+	testl	%ecx, %ecx
+	jle	.L790
+.L722:
+	cmpl	$1, 112(%rsp)
+	je	.L660
+	movq	80(%rsp), %rbx
+	movslq	88(%rsp), %rax
+	leaq	204(%rsp), %rcx
+	movl	$0, 200(%rsp)
+	movq	$0, (%rsp)
+	leaq	(%rbx,%rax,8), %rax
+	movq	%rcx, 64(%rsp)
+	movq	%rbx, %rsi
+	movq	104(%rsp), %rbx
+	movq	%rax, 32(%rsp)
+	movq	%r12, 72(%rsp)
+	movq	40(%rsp), %r12
+	movq	%r14, 88(%rsp)
+	movq	%rsi, %r14
+.L659:
+	movq	24(%r15), %rax
+	movq	(%r14), %rsi
+	xorl	%r13d, %r13d
+	movq	64(%rsp), %rdx
+	movq	(%rax,%r12), %rdi
+	call	collect@PLT
+	movl	204(%rsp), %ecx
+	movq	(%rsp), %rdi
+	movq	%rax, 8(%rsp)
+	movq	%rax, %rbp
+	movl	%ecx, %esi
+	addl	200(%rsp), %esi
+	movl	%ecx, 16(%rsp)
+	movslq	%esi, %rsi
+	salq	$3, %rsi
+	call	realloc@PLT
+	movl	16(%rsp), %ecx
+	movq	%rax, (%rsp)
+	testl	%ecx, %ecx
+	jg	.L669
+	jmp	.L670
+	.p2align 4,,10
+	.p2align 3
+.L667:
+	movq	0(%rbp), %rdi
+	call	free@PLT
+.L668:
+	addl	$1, %r13d
+	addq	$8, %rbp
+	cmpl	204(%rsp), %r13d
+	jge	.L670
+.L669:
+	movq	0(%rbp), %rsi
+	movq	%rbx, %rdi
+	call	containsPH@PLT
+	testl	%eax, %eax
+	jne	.L667
+	movq	24(%r15), %rax
+	movq	0(%rbp), %rsi
+	movq	-8(%rax,%r12), %rdi
+	call	countQ@PLT
+	testl	%eax, %eax
+	jne	.L667
+	movq	0(%rbp), %rsi
+	movq	%rbx, %rdi
+	call	insertPH@PLT
+	movslq	200(%rsp), %rax
+	movq	(%rsp), %rcx
+	leal	1(%rax), %edx
+	movl	%edx, 200(%rsp)
+	movq	0(%rbp), %rdx
+	movq	%rdx, (%rcx,%rax,8)
+	jmp	.L668
+.L670:
+	movq	8(%rsp), %rdi
+	addq	$8, %r14
+	call	free@PLT
+	movq	32(%rsp), %rax
+	cmpq	%rax, %r14
+	jne	.L659
+	movl	200(%rsp), %eax
+	movq	72(%rsp), %r12
+	xorl	%ecx, %ecx
+	movq	88(%rsp), %r14
+	testl	%eax, %eax
+	jle	.L663
+	movq	(%rsp), %r13
+	movl	112(%rsp), %ebp
+	movq	%r12, 16(%rsp)
+	movq	%rcx, %r12
+	movl	116(%rsp), %ebx
+	jmp	.L676
+	.p2align 4,,10
+	.p2align 3
+.L672:
+	movq	0(%r13,%r12,8), %rdx
+	movl	%ebp, %esi
+	movq	%r15, %rdi
+	movq	%rdx, (%r14,%r12,8)
+	call	frontDelete
+	leaq	1(%r12), %rax
+	cmpl	%eax, 200(%rsp)
+	jle	.L675
+	movq	%rax, %r12
+.L676:
+	cmpl	%r12d, %ebx
+	jne	.L672
+	addl	%ebx, %ebx
+	movq	%r14, %rdi
+	movslq	%ebx, %rsi
+	salq	$3, %rsi
+	movq	%rsi, 8(%rsp)
+	call	realloc@PLT
+	movq	8(%rsp), %rsi
+	movq	80(%rsp), %rdi
+	movq	%rax, %r14
+	call	realloc@PLT
+	movq	%rax, 80(%rsp)
+	jmp	.L672
+.L675:
+	movq	%r12, %rcx
+	movl	%ebx, 116(%rsp)
+	movq	16(%rsp), %r12
+	leal	1(%rcx), %eax
+	movl	%eax, 88(%rsp)
+.L681:
+	movq	(%rsp), %rdi
+	call	free@PLT
+.L682:
+	movq	80(%rsp), %rax
+	movq	%r14, 80(%rsp)
+	movq	%rax, %r14
+.L664:
+	movq	112(%r15), %rdi
+	call	clearSK@PLT
+	movl	112(%rsp), %eax
+	movq	48(%rsp), %rbp
+	movq	%r12, 8(%rsp)
+	movq	56(%rsp), %r13
+	movl	28(%rsp), %r12d
+	movq	%r14, 16(%rsp)
+	leal	-1(%rax), %ebx
+	movq	%rbp, %rdi
+	movq	40(%rsp), %r14
+	movl	%ebx, (%rsp)
+	call	isEmptyPQ@PLT
+	movl	%eax, %ebx
+	testl	%eax, %eax
+	jne	.L791
+	.p2align 4,,10
+	.p2align 3
+.L687:
+	movl	60(%r15), %eax
+	testl	%eax, %eax
+	jle	.L684
+	movq	%rbp, %rdi
+	call	topPQ@PLT
+	movl	(%rsp), %esi
+	movq	%r15, %rdi
+	movq	%rax, %rdx
+	call	removeCovered
+.L684:
+	testl	%r12d, %r12d
+	jle	.L686
+	.p2align 4,,10
+	.p2align 3
+.L685:
+	movq	%rbp, %rdi
+	call	topPQ@PLT
+	leal	65(%rbx), %ecx
+	movq	%r13, %r8
+	movq	%r15, %rdi
+	movq	%rax, %rdx
+	movq	24(%r15), %rax
+	movsbl	%cl, %ecx
+	addl	$1, %ebx
+	movq	(%rax,%r14), %rsi
+	call	succCandidate
+	cmpl	%ebx, %r12d
+	jne	.L685
+.L686:
+	movq	%rbp, %rdi
+	call	topPQ@PLT
+	movq	%rax, %rdi
+	call	free@PLT
+	movq	%rbp, %rdi
+	call	popPQ@PLT
+	movq	%rbp, %rdi
+	call	isEmptyPQ@PLT
+	movl	%eax, %ebx
+	testl	%eax, %eax
+	je	.L687
+.L791:
+	movslq	88(%rsp), %rax
+	movq	8(%rsp), %r12
+	movq	16(%rsp), %r14
+	testl	%eax, %eax
+	je	.L688
+	movq	40(%rsp), %rbx
+	subq	$8, %rbx
+	movq	%rbx, 64(%rsp)
+	movl	28(%rsp), %ebx
+	testl	%ebx, %ebx
+	jle	.L688
+	movq	80(%rsp), %rbx
+	movq	128(%rsp), %rbp
+	movq	%r14, 184(%rsp)
+	movq	%r15, %r14
+	leaq	(%rbx,%rax,8), %rax
+	movq	%rbx, 16(%rsp)
+	movq	%rax, 96(%rsp)
+	leaq	204(%rsp), %rax
+	movq	%rax, 72(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L690:
+	xorl	%r8d, %r8d
+	movq	%r14, %r13
+.L699:
+	movl	24(%rsp), %r10d
+	leal	65(%r8), %eax
+	movl	%r8d, %ecx
+	movq	%r13, %r15
+	movb	%al, (%rsp)
+	testl	%r10d, %r10d
+	jle	.L692
+	.p2align 4,,10
+	.p2align 3
+.L694:
+	movq	16(%rsp), %rax
+	movsbl	(%rsp), %ebx
+	movl	%ecx, 8(%rsp)
+	xorl	%r13d, %r13d
+	movq	(%rax), %r14
+	movq	%r15, %rax
+	movq	%r14, %r15
+	movq	%rax, %r14
+	.p2align 4,,10
+	.p2align 3
+.L691:
+	movl	(%r15,%r13,4), %eax
+	movl	%ebx, %esi
+	leal	-1(%rax), %edx
+	movq	8(%r14), %rax
+	movq	(%rax,%r13,8), %rdi
+	call	stringFloor@PLT
+	movl	%ebx, %esi
+	movl	%eax, 0(%rbp,%r13,4)
+	movq	8(%r14), %rax
+	movq	(%rax,%r13,8), %rdi
+	call	stringLast@PLT
+	leal	1(%r13), %edx
+	cmpl	%edx, 24(%rsp)
+	setg	%sil
+	cmpl	$-2, %eax
+	movl	%eax, (%r12,%r13,4)
+	setne	%dl
+	addq	$1, %r13
+	testb	%dl, %sil
+	jne	.L691
+	movl	8(%rsp), %ecx
+	movq	%r14, %r15
+	cmpl	$-2, %eax
+	jne	.L772
+	addl	$1, %ecx
+	cmpl	%ecx, 28(%rsp)
+	je	.L693
+	leal	65(%rcx), %eax
+	movb	%al, (%rsp)
+	jmp	.L694
+.L772:
+	movl	%ecx, %r8d
+	movq	%r14, %r13
+.L692:
+	movq	64(%rsp), %rbx
+	movq	24(%r13), %rax
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	72(%rsp), %rcx
+	movl	%r8d, 8(%rsp)
+	xorl	%r15d, %r15d
+	movq	(%rax,%rbx), %rdi
+	call	rangeCollect@PLT
+	movsbl	(%rsp), %r14d
+	movl	8(%rsp), %r8d
+	movl	204(%rsp), %r11d
+	movq	%rax, %rbx
+	testl	%r11d, %r11d
+	jle	.L792
+	movl	%r8d, 32(%rsp)
+	movl	%r14d, %ebx
+	movq	56(%rsp), %r14
+	movq	%rbp, (%rsp)
+	movq	%r15, %rbp
+	movq	40(%rsp), %r15
+	movq	%r12, 8(%rsp)
+	movq	%rax, %r12
+	.p2align 4,,10
+	.p2align 3
+.L698:
+	movq	24(%r13), %rcx
+	movq	(%r12,%rbp,8), %rdx
+	movq	%r14, %r8
+	movq	%r13, %rdi
+	movq	(%rcx,%r15), %rsi
+	movl	%ebx, %ecx
+	call	succCandidate
+	movq	(%r12,%rbp,8), %rdi
+	addq	$1, %rbp
+	call	free@PLT
+	cmpl	%ebp, 204(%rsp)
+	jg	.L698
+	movq	%r12, %rbx
+	movq	(%rsp), %rbp
+	movl	32(%rsp), %r8d
+	movq	8(%rsp), %r12
+.L696:
+	movq	%rbx, %rdi
+	movl	%r8d, (%rsp)
+	call	free@PLT
+	movl	(%rsp), %r8d
+.L697:
+	addl	$1, %r8d
+	cmpl	%r8d, 28(%rsp)
+	jne	.L699
+	movq	%r13, %r14
+	.p2align 4,,10
+	.p2align 3
+.L693:
+	addq	$8, 16(%rsp)
+	movq	96(%rsp), %rbx
+	movq	16(%rsp), %rax
+	cmpq	%rbx, %rax
+	jne	.L690
+	movq	%r14, %r15
+	movq	184(%rsp), %r14
+.L688:
+	movq	112(%r15), %rdi
+	movl	(%r15), %ebx
+	call	minimaSK@PLT
+	movl	%eax, %esi
+	testl	%eax, %eax
+	jle	.L707
+	cmpq	$0, 48(%rsp)
+	je	.L793
+	movq	%r12, (%rsp)
+	movslq	%ebx, %rax
+	xorl	%ecx, %ecx
+	movl	112(%rsp), %r12d
+	movq	%r14, 8(%rsp)
+	leaq	0(,%rax,4), %r13
+	movl	%esi, %r14d
+	movl	%ecx, %ebp
+.L706:
+	movq	112(%r15), %rdi
+	movl	%ebp, %esi
+	call	pointSK@PLT
+	movl	%r12d, %esi
+	movq	%r15, %rdi
+	movq	%rax, %rdx
+	call	frontInsert
+	movq	%r13, %rdi
+	call	malloc@PLT
+	movq	112(%r15), %rdi
+	movl	%ebp, %esi
+	addl	$1, %ebp
+	movq	%rax, %rbx
+	call	pointSK@PLT
+	movq	%r13, %rdx
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	memcpy@PLT
+	movq	48(%rsp), %rdi
+	movq	%rbx, %rsi
+	call	pushPQ@PLT
+	cmpl	%ebp, %r14d
+	jne	.L706
+	movq	(%rsp), %r12
+	movq	8(%rsp), %r14
+.L707:
+	movl	60(%r15), %esi
+	testl	%esi, %esi
+	jg	.L794
+.L702:
+	movq	136(%rsp), %rdi
+	call	freePH@PLT
+	movl	24(%rsp), %edi
+	call	allocPH@PLT
+	movq	104(%rsp), %rcx
+	addl	$1, 112(%rsp)
+	addq	$8, 40(%rsp)
+	movl	112(%rsp), %ebx
+	movq	%rcx, 136(%rsp)
+	cmpl	16(%r15), %ebx
+	jg	.L735
+	movl	88(%rsp), %ecx
+	movq	%rax, 104(%rsp)
+	testl	%ecx, %ecx
+	jg	.L722
+.L790:
+	movq	48(%rsp), %rdi
+	call	isEmptyPQ@PLT
+	movl	%eax, 88(%rsp)
+	testl	%eax, %eax
+	jne	.L795
+	cmpl	$1, 112(%rsp)
+	je	.L660
+	movl	$0, 200(%rsp)
+	movq	80(%rsp), %rax
+	movq	%r14, 80(%rsp)
+	movq	%rax, %r14
+	jmp	.L664
+.L792:
+	testq	%rax, %rax
+	je	.L697
+	jmp	.L696
+.L793:
+	xorl	%ebx, %ebx
+	movl	112(%rsp), %r13d
+	movl	%ebx, %ebp
+	movl	%eax, %ebx
+.L704:
+	movq	112(%r15), %rdi
+	movl	%ebp, %esi
+	addl	$1, %ebp
+	call	pointSK@PLT
+	movl	%r13d, %esi
+	movq	%r15, %rdi
+	movq	%rax, %rdx
+	call	frontInsert
+	cmpl	%ebp, %ebx
+	jne	.L704
+	movl	60(%r15), %esi
+	testl	%esi, %esi
+	jle	.L702
+.L794:
+	movq	24(%r15), %rax
+	movq	40(%rsp), %rbx
+	leaq	204(%rsp), %rcx
+	movq	64(%r15), %rdx
+	movq	(%rax,%rbx), %rdi
+	call	evictWorst@PLT
+	movl	204(%rsp), %ecx
+	movl	112(%rsp), %esi
+	movq	%r15, %rdi
+	movq	%rax, %rdx
+	movq	%rax, (%rsp)
+	call	frontRemoved
+	movl	204(%rsp), %r9d
+	movq	(%rsp), %rdx
+	testl	%r9d, %r9d
+	jle	.L708
+	movl	88(%rsp), %r13d
+	xorl	%ebx, %ebx
+	movq	%rdx, %rbp
+	jmp	.L712
+.L797:
+	movq	0(%rbp,%rbx,8), %rdi
+	addq	$1, %rbx
+	call	free@PLT
+	cmpl	%ebx, 204(%rsp)
+	jle	.L796
+.L712:
+	movq	0(%rbp,%rbx,8), %rsi
+	movq	112(%r15), %rdi
+	call	findSK@PLT
+	testl	%eax, %eax
+	jne	.L797
+	movq	0(%rbp,%rbx,8), %rsi
+	movq	104(%rsp), %rdi
+	call	insertPH@PLT
+	movl	116(%rsp), %eax
+	cmpl	%eax, %r13d
+	je	.L798
+.L711:
+	movq	0(%rbp,%rbx,8), %rsi
+	movq	80(%rsp), %rcx
+	movslq	%r13d, %rax
+	addq	$1, %rbx
+	addl	$1, %r13d
+	movq	%rsi, (%rcx,%rax,8)
+	cmpl	%ebx, 204(%rsp)
+	jg	.L712
+.L796:
+	movl	%r13d, 88(%rsp)
+	movq	%rbp, %rdx
+.L713:
+	movq	%rdx, %rdi
+	call	free@PLT
+.L714:
+	call	allocPQ@PLT
+	movl	204(%rsp), %r8d
+	movq	48(%rsp), %r13
+	movq	%rax, %rbx
+	testl	%r8d, %r8d
+	jle	.L716
+.L715:
+	movq	%r13, %rdi
+	call	isEmptyPQ@PLT
+	testl	%eax, %eax
+	jne	.L716
+	movq	%r13, %rdi
+	call	topPQ@PLT
+	movq	40(%rsp), %rcx
+	movq	%rax, %rsi
+	movq	24(%r15), %rax
+	movq	(%rax,%rcx), %rdi
+	call	containsQ@PLT
+	movq	%r13, %rdi
+	testl	%eax, %eax
+	je	.L717
+	call	topPQ@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	pushPQ@PLT
+	movq	%r13, %rdi
+	call	popPQ@PLT
+	movl	204(%rsp), %edi
+	testl	%edi, %edi
+	jg	.L715
+	movq	%rbx, %rdi
+	call	isEmptyPQ@PLT
+	movq	%rbx, %rdi
+	testl	%eax, %eax
+	jne	.L799
+.L721:
+	call	topPQ@PLT
+	movq	48(%rsp), %rdi
+	movq	%rax, %rsi
+	call	pushPQ@PLT
+	movq	%rbx, %rdi
+	call	popPQ@PLT
+.L716:
+	movq	%rbx, %rdi
+	call	isEmptyPQ@PLT
+	movq	%rbx, %rdi
+	testl	%eax, %eax
+	je	.L721
+.L799:
+	call	freePQ@PLT
+	jmp	.L702
+.L660:
+	movl	24(%rsp), %ecx
+	xorl	%ebx, %ebx
+	testl	%ecx, %ecx
+	jle	.L658
+	movq	160(%rsp), %r13
+	movq	128(%rsp), %rbp
+.L657:
+	movq	8(%r15), %rax
+	movl	$-1, 0(%rbp,%rbx)
+	movq	(%rax,%rbx,2), %rdi
+	call	stringEnd@PLT
+	movl	%eax, (%r12,%rbx)
+	addq	$4, %rbx
+	cmpq	%rbx, %r13
+	jne	.L657
+.L658:
+	movq	120(%rsp), %rdi
+	call	stringBegin@PLT
+	movq	168(%rsp), %rbx
+	movq	176(%rsp), %rcx
+	movq	%r12, %rdx
+	movq	128(%rsp), %rsi
+	movl	%eax, (%rbx)
+	movq	24(%r15), %rax
+	movq	8(%rax), %rdi
+	call	rangeCollect@PLT
+	movl	200(%rsp), %edx
+	xorl	%ecx, %ecx
+	movq	%rax, (%rsp)
+	testl	%edx, %edx
+	jle	.L663
+	movl	116(%rsp), %r13d
+	movq	%rax, %rbx
+	movq	%rcx, %rbp
+	jmp	.L671
+.L677:
+	movq	(%rbx,%rbp,8), %rdx
+	movl	$1, %esi
+	movq	%r15, %rdi
+	movq	%rdx, (%r14,%rbp,8)
+	call	frontDelete
+	leaq	1(%rbp), %rax
+	cmpl	%eax, 200(%rsp)
+	jle	.L680
+	movq	%rax, %rbp
+.L671:
+	movq	(%rbx,%rbp,8), %rsi
+	movq	104(%rsp), %rdi
+	call	insertPH@PLT
+	cmpl	%ebp, %r13d
+	jne	.L677
+	addl	%r13d, %r13d
+	movq	%r14, %rdi
+	movslq	%r13d, %rsi
+	salq	$3, %rsi
+	movq	%rsi, 8(%rsp)
+	call	realloc@PLT
+	movq	8(%rsp), %rsi
+	movq	80(%rsp), %rdi
+	movq	%rax, %r14
+	call	realloc@PLT
+	movq	%rax, 80(%rsp)
+	jmp	.L677
+.L680:
+	leal	1(%rbp), %eax
+	movl	%r13d, 116(%rsp)
+	movl	%eax, 88(%rsp)
+	jmp	.L681
+.L717:
+	call	topPQ@PLT
+	movq	%rax, %rdi
+	call	free@PLT
+	movq	%r13, %rdi
+	call	popPQ@PLT
+	movl	204(%rsp), %esi
+	testl	%esi, %esi
+	jg	.L715
+	jmp	.L716
+.L798:
+	leal	(%r13,%r13), %eax
+	movq	80(%rsp), %rdi
+	movslq	%eax, %rsi
+	movl	%eax, 116(%rsp)
+	salq	$3, %rsi
+	movq	%rsi, (%rsp)
+	call	realloc@PLT
+	movq	(%rsp), %rsi
+	movq	%r14, %rdi
+	movq	%rax, 80(%rsp)
+	call	realloc@PLT
+	movq	%rax, %r14
+	jmp	.L711
+.L708:
+	testq	%rdx, %rdx
+	je	.L714
+	jmp	.L713
+	.p2align 4,,10
+	.p2align 3
+.L663:
+	cmpq	$0, (%rsp)
+	movl	$0, 88(%rsp)
+	je	.L682
+	jmp	.L681
+	.p2align 4,,10
+	.p2align 3
+.L788:
+	addq	$216, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r15, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	rebaseMLCS
+.L789:
+	.cfi_restore_state
+	addl	$1, 4(%r15)
+	movq	120(%rsp), %rdi
+	movl	%ebx, %esi
+	call	stringPopMany@PLT
+	jmp	.L650
+.L735:
+	movq	%rax, 104(%rsp)
+	movq	152(%rsp), %r12
+	movq	%r14, %rbp
+	movq	48(%rsp), %rbx
+	jmp	.L724
+	.p2align 4,,10
+	.p2align 3
+.L726:
+	movl	60(%r15), %edx
+	testl	%edx, %edx
+	jle	.L725
+	movq	%rbx, %rdi
+	call	topPQ@PLT
+	movl	16(%r15), %esi
+	movq	%r15, %rdi
+	movq	%rax, %rdx
+	call	removeCovered
+.L725:
+	movq	%rbx, %rdi
+	call	topPQ@PLT
+	movq	%rax, %rdi
+	call	free@PLT
+	movq	%rbx, %rdi
+	call	popPQ@PLT
+.L724:
+	movq	%rbx, %rdi
+	call	isEmptyPQ@PLT
+	testl	%eax, %eax
+	je	.L726
+	movq	48(%rsp), %rdi
+	call	freePQ@PLT
+	movq	136(%rsp), %rdi
+	call	freePH@PLT
+	movq	104(%rsp), %rdi
+	call	freePH@PLT
+	movq	80(%rsp), %rdi
+	call	free@PLT
+	movq	%rbp, %rdi
+	call	free@PLT
+	movl	16(%r15), %eax
+	testl	%eax, %eax
+	jg	.L727
+	jmp	.L728
+	.p2align 4,,10
+	.p2align 3
+.L729:
+	movl	16(%r15), %eax
+	subl	$1, %eax
+	movl	%eax, 16(%r15)
+	testl	%eax, %eax
+	jle	.L728
+.L727:
+	movq	24(%r15), %rdx
+	cltq
+	movq	(%rdx,%rax,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	je	.L729
+.L728:
+	movq	144(%rsp), %rdi
+	call	free@PLT
+	movq	128(%rsp), %rdi
+	call	free@PLT
+	movq	56(%rsp), %rdi
+	call	free@PLT
+	jmp	.L648
+.L795:
+	movq	152(%rsp), %r12
+	movq	%r14, %rbp
+.L785:
+	movq	48(%rsp), %rbx
+	jmp	.L724
+	.cfi_endproc
+.LFE104:
+	.size	popMany.part.0, .-popMany.part.0
+	.p2align 4
+	.type	pop.part.0, @function
+pop.part.0:
+.LFB105:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movslq	%esi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%r13, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	8(%rdi), %rax
+	movq	%rdi, %rbx
+	leaq	(%rax,%r13,8), %r14
+	movq	(%r14), %rdi
+	call	stringOwn@PLT
+	movq	%rax, (%r14)
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	stringSize@PLT
+	cmpl	$1, %eax
+	jne	.L801
+	addl	$1, 4(%rbx)
+.L801:
+	movl	16(%rbx), %eax
+	testl	%eax, %eax
+	jg	.L802
+.L809:
+	movq	%rbp, %rdi
+	call	stringPop@PLT
+	addl	$1, 76(%rbx)
+.L806:
+	movq	8(%rbx), %rax
+	movq	(%rax,%r13,8), %rdi
+	call	stringBegin@PLT
+	cmpl	$1073741823, %eax
+	jg	.L810
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L802:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	call	rebuildWork
+	xorl	%edx, %edx
+	movl	%r12d, %esi
+	movq	%rbx, %rdi
+	movq	%rax, %rcx
+	call	repairStart
+	movq	%rbx, %rdi
+	movabsq	$9223372036854775807, %rdx
+	movq	%rax, %r12
+	movq	%rax, %rsi
+	call	repairRun
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	repairEnd
+	testl	%eax, %eax
+	jne	.L811
+	movq	%rbp, %rdi
+	call	stringPop@PLT
+	addl	$1, 80(%rbx)
+	movq	%rbx, %rdi
+	call	rebuildMLCS
+	jmp	.L806
+	.p2align 4,,10
+	.p2align 3
+.L810:
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	rebaseMLCS
+	.p2align 4,,10
+	.p2align 3
+.L811:
+	.cfi_restore_state
+	movslq	16(%rbx), %rdx
+	movq	24(%rbx), %rax
+	movq	(%rax,%rdx,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	jne	.L809
+	subl	$1, 16(%rbx)
+	jmp	.L809
+	.cfi_endproc
+.LFE105:
+	.size	pop.part.0, .-pop.part.0
+	.p2align 4
+	.globl	forkMLCS
+	.type	forkMLCS, @function
+forkMLCS:
+.LFB75:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movl	(%rdi), %eax
+	movq	128(%rdi), %rsi
+	movl	%eax, 12(%rsp)
+	testq	%rsi, %rsi
+	je	.L813
+	movabsq	$9223372036854775807, %rdx
+	call	repairRun
+	movq	128(%r12), %rsi
+	movq	%r12, %rdi
+	movslq	(%rsi), %rbx
+	movq	$0, 128(%r12)
+	call	repairEnd
+	movslq	16(%r12), %rdx
+	movq	24(%r12), %rax
+	movq	(%rax,%rdx,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	je	.L830
+.L814:
+	movq	8(%r12), %rax
+	movq	(%rax,%rbx,8), %rdi
+	call	stringPop@PLT
+	movq	40(%r12), %rax
+	subl	$1, (%rax,%rbx,4)
+	addl	$1, 76(%r12)
+.L813:
+	movl	$136, %edi
+	call	malloc@PLT
+	movdqu	(%r12), %xmm0
+	movdqu	16(%r12), %xmm1
+	movl	$8, %esi
+	movdqu	32(%r12), %xmm2
+	movdqu	48(%r12), %xmm3
+	movq	%rax, %rbp
+	movdqu	64(%r12), %xmm4
+	movups	%xmm0, (%rax)
+	movslq	12(%rsp), %r15
+	movdqu	80(%r12), %xmm5
+	movdqu	96(%r12), %xmm6
+	movups	%xmm1, 16(%rax)
+	movdqu	112(%r12), %xmm7
+	movups	%xmm2, 32(%rax)
+	movq	%r15, %rdi
+	movups	%xmm3, 48(%rax)
+	movups	%xmm4, 64(%rax)
+	movups	%xmm5, 80(%rax)
+	movups	%xmm6, 96(%rax)
+	movups	%xmm7, 112(%rax)
+	movq	128(%r12), %rax
+	movq	%rax, 128(%rbp)
+	call	calloc@PLT
+	movl	$8, %esi
+	movq	%r15, %rdi
+	movq	%rax, 8(%rbp)
+	movq	%rax, %r13
+	call	calloc@PLT
+	movl	$4, %esi
+	movq	%r15, %rdi
+	movq	%rax, 48(%rbp)
+	call	calloc@PLT
+	movq	%rax, 40(%rbp)
+	testl	%r15d, %r15d
+	jle	.L815
+	salq	$2, %r15
+	xorl	%ebx, %ebx
+	jmp	.L816
+	.p2align 4,,10
+	.p2align 3
+.L831:
+	movq	8(%rbp), %r13
+.L816:
+	movq	8(%r12), %rax
+	leaq	(%rbx,%rbx), %r14
+	addq	%r14, %r13
+	movq	(%rax,%rbx,2), %rdi
+	call	stringShare@PLT
+	addq	48(%rbp), %r14
+	movq	%rax, 0(%r13)
+	movq	48(%r12), %rax
+	movq	(%rax,%rbx,2), %rdi
+	call	stringShare@PLT
+	movq	%rax, (%r14)
+	movq	40(%r12), %rax
+	movl	(%rax,%rbx), %edx
+	movq	40(%rbp), %rax
+	movl	%edx, (%rax,%rbx)
+	addq	$4, %rbx
+	cmpq	%rbx, %r15
+	jne	.L831
+.L815:
+	movslq	32(%rbp), %rdi
+	movl	$8, %esi
+	xorl	%ebx, %ebx
+	movq	%rdi, %r13
+	call	calloc@PLT
+	movq	%rax, 24(%rbp)
+	testl	%r13d, %r13d
+	jg	.L829
+	jmp	.L822
+	.p2align 4,,10
+	.p2align 3
+.L832:
+	addq	24(%rbp), %rax
+	addq	$1, %rbx
+	movq	%rax, %r13
+	call	forkORT@PLT
+	movq	%rax, 0(%r13)
+	movl	32(%rbp), %r13d
+	cmpl	%ebx, %r13d
+	jle	.L822
+.L829:
+	movq	24(%r12), %rdx
+.L817:
+	movq	(%rdx,%rbx,8), %rdi
+	leaq	0(,%rbx,8), %rax
+	testq	%rdi, %rdi
+	jne	.L832
+	addq	$1, %rbx
+	cmpl	%ebx, %r13d
+	jg	.L817
+.L822:
+	movq	104(%r12), %rdi
+	movq	$0, 88(%rbp)
+	movq	$0, 96(%rbp)
+	testq	%rdi, %rdi
+	je	.L819
+	call	forkORT@PLT
+	movq	%rax, 104(%rbp)
+.L819:
+	movl	12(%rsp), %edi
+	call	allocSK@PLT
+	movq	%rax, 112(%rbp)
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L830:
+	.cfi_restore_state
+	subl	$1, 16(%r12)
+	jmp	.L814
+	.cfi_endproc
+.LFE75:
+	.size	forkMLCS, .-forkMLCS
+	.p2align 4
+	.globl	pop
+	.type	pop, @function
+pop:
+.LFB76:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movl	36(%rdi), %edx
+	testl	%edx, %edx
+	jne	.L840
+	movl	56(%rdi), %eax
+	cmpl	%eax, 16(%rdi)
+	je	.L837
+	movl	60(%rdi), %eax
+	testl	%eax, %eax
+	jle	.L838
+.L837:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbx, %rdi
+	movl	$1, %edx
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	popMany.part.0
+	.p2align 4,,10
+	.p2align 3
+.L838:
+	.cfi_restore_state
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	pop.part.0
+	.p2align 4,,10
+	.p2align 3
+.L840:
+	.cfi_restore_state
+	movq	8(%rdi), %rax
+	movslq	%esi, %rbp
+	leaq	0(,%rbp,8), %r12
+	movq	(%rax,%rbp,8), %rdi
+	call	stringSize@PLT
+	movq	40(%rbx), %rdx
+	movl	%eax, %r13d
+	leaq	(%rdx,%rbp,4), %rcx
+	movl	(%rcx), %edx
+	subl	%edx, %r13d
+	testl	%r13d, %r13d
+	jle	.L835
+	addl	$1, %edx
+	movl	%edx, (%rcx)
+.L836:
+	movq	120(%rbx), %rsi
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	paceMLCS
+	.p2align 4,,10
+	.p2align 3
+.L835:
+	.cfi_restore_state
+	addq	48(%rbx), %r12
+	movl	%eax, (%rcx)
+	movq	(%r12), %rdi
+	call	stringOwn@PLT
+	movl	$1, %esi
+	movq	%rax, (%r12)
+	movq	48(%rbx), %rax
+	subl	%r13d, %esi
+	movq	(%rax,%rbp,8), %rdi
+	call	stringPopMany@PLT
+	jmp	.L836
+	.cfi_endproc
+.LFE76:
+	.size	pop, .-pop
+	.p2align 4
+	.globl	paceMLCS
+	.type	paceMLCS, @function
+paceMLCS:
+.LFB70:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movl	36(%rdi), %eax
+	movl	(%rdi), %r12d
+	movl	$0, 36(%rdi)
+	movl	%eax, 4(%rsp)
+	testq	%rsi, %rsi
+	jg	.L842
+	jmp	.L857
+	.p2align 4,,10
+	.p2align 3
+.L847:
+	subq	%r14, %rbp
+	testq	%rbp, %rbp
+	jle	.L857
+.L842:
+	movq	128(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L874
+.L843:
+	movq	%rbx, %rdi
+	movq	%rbp, %rdx
+	call	repairRun
+	movq	%rax, %r14
+	movq	128(%rbx), %rax
+	movq	32(%rax), %rdi
+	call	isEmptyPQ@PLT
+	testl	%eax, %eax
+	je	.L847
+	movq	128(%rbx), %rsi
+	movq	%rbx, %rdi
+	movslq	(%rsi), %r15
+	movq	$0, 128(%rbx)
+	call	repairEnd
+	movslq	16(%rbx), %rdx
+	movq	24(%rbx), %rax
+	movq	(%rax,%rdx,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	jne	.L848
+	subl	$1, 16(%rbx)
+.L848:
+	movq	8(%rbx), %rax
+	movq	(%rax,%r15,8), %rdi
+	call	stringPop@PLT
+	movq	40(%rbx), %rax
+	subl	$1, (%rax,%r15,4)
+	movq	8(%rbx), %rax
+	addl	$1, 76(%rbx)
+	movq	(%rax,%r15,8), %rdi
+	call	stringBegin@PLT
+	cmpl	$1073741823, %eax
+	jle	.L847
+	movq	%rbx, %rdi
+	call	rebaseMLCS
+	jmp	.L847
+	.p2align 4,,10
+	.p2align 3
+.L874:
+	xorl	%r14d, %r14d
+	testl	%r12d, %r12d
+	jle	.L845
+.L844:
+	movq	40(%rbx), %rdx
+	xorl	%esi, %esi
+	movq	%rdx, %rax
+	jmp	.L846
+	.p2align 4,,10
+	.p2align 3
+.L852:
+	addl	$1, %esi
+	addq	$4, %rax
+	cmpl	%esi, %r12d
+	je	.L851
+.L846:
+	movl	(%rax), %edi
+	testl	%edi, %edi
+	je	.L852
+	cmpl	%esi, %r12d
+	jle	.L851
+	movl	16(%rbx), %ecx
+	movslq	%esi, %rax
+	testl	%ecx, %ecx
+	je	.L855
+	cmpl	56(%rbx), %ecx
+	je	.L855
+	movl	60(%rbx), %ecx
+	testl	%ecx, %ecx
+	jle	.L856
+.L855:
+	subl	$1, (%rdx,%rax,4)
+	movq	%rbx, %rdi
+	call	pop
+	movl	16(%rbx), %eax
+	addl	$1, %eax
+	cltq
+	subq	%rax, %rbp
+	testq	%rbp, %rbp
+	jle	.L857
+	movq	128(%rbx), %rsi
+	testq	%rsi, %rsi
+	jne	.L843
+	jmp	.L844
+	.p2align 4,,10
+	.p2align 3
+.L851:
+	movslq	%r12d, %r15
+	xorl	%r13d, %r13d
+	jmp	.L854
+	.p2align 4,,10
+	.p2align 3
+.L860:
+	addq	$1, %r13
+	cmpq	%r13, %r15
+	je	.L875
+.L854:
+	movq	48(%rbx), %rax
+	movl	%r13d, %r14d
+	movq	(%rax,%r13,8), %rdi
+	call	stringSize@PLT
+	testl	%eax, %eax
+	je	.L860
+.L845:
+	cmpl	%r14d, %r12d
+	je	.L857
+	movq	48(%rbx), %rax
+	movslq	%r14d, %r15
+	leaq	0(,%r15,8), %rdx
+	movq	(%rax,%r15,8), %rdi
+	movq	%rdx, 8(%rsp)
+	call	stringFstLetter@PLT
+	movq	8(%rsp), %rdx
+	addq	48(%rbx), %rdx
+	movq	(%rdx), %rdi
+	movq	%rdx, 8(%rsp)
+	movl	%eax, %r13d
+	call	stringOwn@PLT
+	movq	8(%rsp), %rdx
+	movq	%rax, (%rdx)
+	movq	48(%rbx), %rax
+	movq	(%rax,%r15,8), %rdi
+	call	stringPop@PLT
+	movsbl	%r13b, %edx
+	movl	%r14d, %esi
+	movq	%rbx, %rdi
+	call	append
+	movl	16(%rbx), %eax
+	addl	$1, %eax
+	cltq
+	subq	%rax, %rbp
+	testq	%rbp, %rbp
+	jg	.L842
+.L857:
+	movl	4(%rsp), %eax
+	movl	%eax, 36(%rbx)
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L875:
+	.cfi_restore_state
+	addl	$1, %r14d
+	jmp	.L845
+.L856:
+	movq	8(%rbx), %rdx
+	movl	%esi, 8(%rsp)
+	leaq	(%rdx,%rax,8), %r14
+	movq	(%r14), %rdi
+	call	stringOwn@PLT
+	movq	%rax, (%r14)
+	movq	%rax, %rdi
+	call	stringSize@PLT
+	movl	8(%rsp), %esi
+	cmpl	$1, %eax
+	jne	.L859
+	addl	$1, 4(%rbx)
+.L859:
+	movabsq	$9223372036854775807, %rcx
+	xorl	%edx, %edx
+	movq	%rbx, %rdi
+	call	repairStart
+	movq	%rax, 128(%rbx)
+	movq	%rax, %rsi
+	testq	%rax, %rax
+	jne	.L843
+	jmp	.L844
+	.cfi_endproc
+.LFE70:
+	.size	paceMLCS, .-paceMLCS
+	.p2align 4
+	.globl	append
+	.type	append, @function
+append:
+.LFB54:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movslq	%esi, %rax
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.cfi_offset 15, -24
+	movq	%rax, %r15
+	pushq	%r14
+	pushq	%r13
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	movq	%rdi, %r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movsbl	%dl, %ebx
+	subq	$152, %rsp
+	movl	36(%rdi), %ecx
+	movq	%rax, -72(%rbp)
+	salq	$3, %rax
+	movl	%ebx, -92(%rbp)
+	testl	%ecx, %ecx
+	jne	.L961
+	addq	8(%rdi), %rax
+	movq	(%rax), %rdi
+	movq	%rax, %rbx
+	call	stringOwn@PLT
+	movq	%rax, (%rbx)
+	movq	%rax, %rdi
+	movq	%rax, -136(%rbp)
+	call	stringSize@PLT
+	testl	%eax, %eax
+	je	.L879
+	movl	4(%r13), %r14d
+	testl	%r14d, %r14d
+	je	.L962
+.L881:
+	movl	-92(%rbp), %esi
+	movq	-136(%rbp), %rdi
+	call	stringAppend@PLT
+	movq	%r13, %rdi
+	call	trimFronts
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L879:
+	.cfi_restore_state
+	movl	4(%r13), %eax
+	leal	-1(%rax), %r14d
+	movl	%r14d, 4(%r13)
+	testl	%r14d, %r14d
+	jne	.L881
+.L962:
+	movq	%r13, %rdi
+	call	growPF
+	movslq	0(%r13), %rbx
+	movq	%rbx, %r12
+	salq	$2, %rbx
+	movq	%rbx, %rdi
+	movq	%rbx, -80(%rbp)
+	call	malloc@PLT
+	movq	%rbx, %rdi
+	movq	%rax, -176(%rbp)
+	call	malloc@PLT
+	movq	%rbx, %rdi
+	xorl	%ebx, %ebx
+	movq	%rax, -128(%rbp)
+	call	malloc@PLT
+	movq	%rax, -104(%rbp)
+	testl	%r12d, %r12d
+	jle	.L885
+	movl	%r15d, -88(%rbp)
+	movq	-80(%rbp), %r12
+	movq	%r13, %r15
+	movl	%r14d, -80(%rbp)
+	movq	-104(%rbp), %r13
+	movq	%rbx, %r14
+	movq	-128(%rbp), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L882:
+	movq	8(%r15), %rax
+	movl	-92(%rbp), %esi
+	movl	$-1, (%rbx,%r14)
+	movq	(%rax,%r14,2), %rdi
+	call	stringLast@PLT
+	movl	%eax, 0(%r13,%r14)
+	addq	$4, %r14
+	cmpq	%r14, %r12
+	jne	.L882
+	movq	%r15, %r13
+	movl	-80(%rbp), %r14d
+	movl	-88(%rbp), %r15d
+.L885:
+	movq	-72(%rbp), %rcx
+	movq	-128(%rbp), %rax
+	movl	-92(%rbp), %esi
+	leaq	0(,%rcx,4), %rbx
+	leaq	(%rax,%rbx), %r12
+	movq	8(%r13), %rax
+	movq	(%rax,%rcx,8), %rdi
+	call	stringLast@PLT
+	movq	-72(%rbp), %rcx
+	movl	%eax, (%r12)
+	movq	-104(%rbp), %rax
+	addq	%rax, %rbx
+	movq	8(%r13), %rax
+	movq	(%rax,%rcx,8), %rdi
+	call	stringEnd@PLT
+	movl	%eax, (%rbx)
+	movl	16(%r13), %eax
+	movl	%eax, -80(%rbp)
+	cmpl	56(%r13), %eax
+	jl	.L883
+	leal	1(%rax), %ebx
+.L886:
+	movslq	0(%r13), %rax
+	movq	%rsp, %r12
+	leaq	15(,%rax,4), %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, -72(%rbp)
+	cmpl	$1, %ebx
+	jle	.L931
+	movq	%r12, -88(%rbp)
+	movq	%r13, %r12
+	movl	%r14d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L960:
+	movl	%ebx, %r14d
+.L890:
+	leal	(%r14,%r13), %ebx
+	movq	24(%r12), %rax
+	movq	-104(%rbp), %rsi
+	sarl	%ebx
+	movslq	%ebx, %rdx
+	movq	(%rax,%rdx,8), %rdi
+	movq	-72(%rbp), %rdx
+	call	dominatedFind@PLT
+	testl	%eax, %eax
+	je	.L888
+	leal	1(%rbx), %eax
+	cmpl	%eax, %r14d
+	jle	.L952
+	movl	%ebx, %r13d
+	jmp	.L890
+	.p2align 4,,10
+	.p2align 3
+.L961:
+	addq	48(%rdi), %rax
+	movq	(%rax), %rdi
+	movq	%rax, %rbx
+	call	stringOwn@PLT
+	movl	-92(%rbp), %esi
+	movq	%rax, (%rbx)
+	movq	48(%r13), %rax
+	movq	-72(%rbp), %rbx
+	movq	(%rax,%rbx,8), %rdi
+	call	stringAppend@PLT
+	movq	120(%r13), %rsi
+	movq	%r13, %rdi
+	call	paceMLCS
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L883:
+	.cfi_restore_state
+	movl	%eax, %ebx
+	addl	$1, %ebx
+	movl	%ebx, -80(%rbp)
+	jmp	.L886
+	.p2align 4,,10
+	.p2align 3
+.L888:
+	leal	1(%r13), %eax
+	cmpl	%eax, %ebx
+	jg	.L960
+.L952:
+	movq	%r12, %r13
+	movq	-88(%rbp), %r12
+.L887:
+	movl	-80(%rbp), %ebx
+	movq	104(%r13), %r14
+	movq	%r12, %rsp
+	cmpl	%eax, %ebx
+	cmovle	%ebx, %eax
+	movl	%eax, -96(%rbp)
+	testq	%r14, %r14
+	je	.L963
+	movl	-96(%rbp), %eax
+	testl	%eax, %eax
+	jg	.L964
+.L893:
+	movslq	-96(%rbp), %rax
+	cmpl	16(%r13), %eax
+	jg	.L965
+.L928:
+	movq	-104(%rbp), %rdi
+	call	free@PLT
+	movq	-128(%rbp), %rdi
+	call	free@PLT
+	movq	-176(%rbp), %rdi
+	call	free@PLT
+	jmp	.L881
+.L965:
+	movq	24(%r13), %rdx
+	movq	(%rdx,%rax,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	jle	.L928
+	addl	$1, 16(%r13)
+	jmp	.L928
+.L963:
+	movl	$8, %ecx
+	movl	$1, %esi
+	leaq	-52(%rbp), %r8
+	testl	%eax, %eax
+	jle	.L893
+	movl	%esi, -112(%rbp)
+	movq	-176(%rbp), %r12
+	movq	%rcx, -120(%rbp)
+	movl	%r15d, -80(%rbp)
+	movq	%r8, -168(%rbp)
+	jmp	.L892
+	.p2align 4,,10
+	.p2align 3
+.L894:
+	movq	-160(%rbp), %rsp
+	movq	%rax, %rdi
+	call	free@PLT
+	addl	$1, -112(%rbp)
+	movl	-112(%rbp), %eax
+	addq	$8, -120(%rbp)
+	cmpl	%eax, -96(%rbp)
+	jl	.L893
+.L892:
+	movq	24(%r13), %rax
+	movq	-120(%rbp), %rbx
+	movq	-168(%rbp), %rcx
+	movq	-104(%rbp), %rdx
+	movq	-8(%rax,%rbx), %rdi
+	movq	-128(%rbp), %rsi
+	call	rangeCollect@PLT
+	movslq	0(%r13), %rdx
+	movl	-52(%rbp), %ecx
+	movq	%rsp, -160(%rbp)
+	movq	%rdx, %r14
+	leaq	15(,%rdx,4), %rdx
+	movl	%ecx, -72(%rbp)
+	andq	$-16, %rdx
+	subq	%rdx, %rsp
+	testl	%ecx, %ecx
+	movq	%rsp, -152(%rbp)
+	jle	.L894
+	movq	112(%r13), %rdi
+	movq	%rax, -88(%rbp)
+	call	clearSK@PLT
+	movq	-88(%rbp), %rax
+	movslq	-72(%rbp), %rcx
+	movl	%r14d, -72(%rbp)
+	movl	-92(%rbp), %r15d
+	leaq	(%rax,%rcx,8), %rsi
+	movq	%rax, -184(%rbp)
+	movq	%rax, %rbx
+	movq	%rsi, -88(%rbp)
+.L895:
+	movl	-72(%rbp), %edx
+	movq	(%rbx), %rdi
+	testl	%edx, %edx
+	jle	.L905
+.L903:
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L900:
+	movq	8(%r13), %rax
+	movl	(%rdi,%r14,4), %edx
+	movl	%r15d, %esi
+	movq	(%rax,%r14,8), %rdi
+	addl	$1, %edx
+	call	stringCeil@PLT
+	movl	%eax, (%r12,%r14,4)
+	cmpl	%r14d, -80(%rbp)
+	je	.L966
+	leal	1(%r14), %edx
+	cmpl	%edx, -72(%rbp)
+	movq	(%rbx), %rdi
+	setg	%cl
+	cmpl	$-2, %eax
+	setne	%dl
+	addq	$1, %r14
+	testb	%dl, %cl
+	jne	.L900
+	xorl	%r14d, %r14d
+	cmpl	$-2, %eax
+	sete	%r14b
+	call	free@PLT
+	testl	%r14d, %r14d
+	je	.L901
+.L967:
+	movq	-88(%rbp), %rax
+	addq	$8, %rbx
+	cmpq	%rax, %rbx
+	je	.L955
+	movq	(%rbx), %rdi
+	jmp	.L903
+	.p2align 4,,10
+	.p2align 3
+.L966:
+	movq	8(%r13), %rax
+	movq	(%rax,%r14,8), %rdi
+	call	stringEnd@PLT
+	movq	(%rbx), %rdi
+	leal	1(%r14), %ecx
+	cmpl	%ecx, -72(%rbp)
+	movl	%eax, (%r12,%r14,4)
+	setg	%sil
+	movl	(%rdi,%r14,4), %edx
+	cmpl	%edx, %eax
+	setne	%cl
+	addq	$1, %r14
+	testb	%cl, %sil
+	jne	.L900
+	xorl	%r14d, %r14d
+	cmpl	%edx, %eax
+	sete	%r14b
+	call	free@PLT
+	testl	%r14d, %r14d
+	jne	.L967
+	.p2align 4,,10
+	.p2align 3
+.L901:
+	movl	-72(%rbp), %r14d
+	movq	%r12, %rdi
+	movl	%r14d, %esi
+	call	plusPlus@PLT
+	movq	-120(%rbp), %rsi
+	movq	24(%r13), %rax
+	movq	-152(%rbp), %rdx
+	movq	(%rax,%rsi), %rdi
+	movq	%r12, %rsi
+	call	dominatedFind@PLT
+	movl	%r14d, %esi
+	movq	%r12, %rdi
+	movl	%eax, -140(%rbp)
+	call	minusMinus@PLT
+	movl	-140(%rbp), %eax
+	testl	%eax, %eax
+	je	.L968
+.L904:
+	movq	-88(%rbp), %rax
+	addq	$8, %rbx
+	cmpq	%rax, %rbx
+	jne	.L895
+.L955:
+	movq	-184(%rbp), %rax
+	movl	-112(%rbp), %esi
+	movq	%r13, %rdi
+	movq	%rax, -72(%rbp)
+	call	insertMinima.constprop.0
+	movq	-72(%rbp), %rax
+	jmp	.L894
+	.p2align 4,,10
+	.p2align 3
+.L905:
+	call	free@PLT
+	jmp	.L901
+	.p2align 4,,10
+	.p2align 3
+.L968:
+	movq	112(%r13), %rdi
+	movq	%r12, %rsi
+	call	addSK@PLT
+	jmp	.L904
+.L964:
+	movl	0(%r13), %ecx
+	movq	%rsp, -192(%rbp)
+	leal	1(%rcx), %eax
+	movl	%ecx, -88(%rbp)
+	cltq
+	leaq	0(,%rax,4), %rsi
+	leaq	15(%rsi), %rax
+	leaq	-4(%rsi), %r11
+	movq	-128(%rbp), %rsi
+	shrq	$4, %rax
+	movq	%r11, %rdx
+	movq	%r11, -72(%rbp)
+	salq	$4, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %r12
+	subq	%rax, %rsp
+	movq	%r12, %rdi
+	movq	%rsp, %rbx
+	call	memcpy@PLT
+	movq	-72(%rbp), %r11
+	movq	-104(%rbp), %rsi
+	movq	%rbx, %rdi
+	movq	%r11, %rdx
+	movq	%r11, -80(%rbp)
+	call	memcpy@PLT
+	movl	-96(%rbp), %esi
+	movslq	-88(%rbp), %rcx
+	movq	%rbx, %rdx
+	movl	$1, %eax
+	movq	%r14, %rdi
+	subl	%esi, %eax
+	movl	$1, (%rbx,%rcx,4)
+	movq	%r12, %rsi
+	movl	%eax, (%r12,%rcx,4)
+	leaq	-52(%rbp), %rcx
+	call	rangeCollect@PLT
+	xorl	%esi, %esi
+	movq	%rax, %r14
+	movl	-96(%rbp), %eax
+	leal	1(%rax), %edx
+	movslq	%edx, %rdx
+	salq	$2, %rdx
+	leaq	15(%rdx), %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	leaq	-4(%rdx), %rax
+	leaq	3(%rsp), %rcx
+	movq	%rax, -72(%rbp)
+	leaq	11(%rdx), %rax
+	andq	$-16, %rax
+	movq	%rcx, %r12
+	andq	$-4, %rcx
+	subq	%rax, %rsp
+	movq	%rcx, %rdi
+	shrq	$2, %r12
+	call	memset@PLT
+	movl	-52(%rbp), %r8d
+	movq	-80(%rbp), %r11
+	movq	%rsp, %rbx
+	movq	%rax, %rcx
+	testl	%r8d, %r8d
+	jle	.L910
+	movslq	%r8d, %rax
+	movq	%r14, %rdx
+	movl	$1, %esi
+	leaq	(%r14,%rax,8), %rdi
+	.p2align 4,,10
+	.p2align 3
+.L909:
+	movq	(%rdx), %rax
+	movl	%esi, %r9d
+	addq	$8, %rdx
+	subl	(%rax,%r11), %r9d
+	movslq	%r9d, %rax
+	addl	$1, (%rcx,%rax,4)
+	cmpq	%rdi, %rdx
+	jne	.L909
+.L910:
+	movl	-96(%rbp), %esi
+	movl	0(,%r12,4), %edx
+	leaq	4(%rcx), %rax
+	subl	$1, %esi
+	leaq	8(%rcx,%rsi,4), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L908:
+	addl	(%rax), %edx
+	addq	$4, %rax
+	movl	%edx, -4(%rax)
+	cmpq	%rsi, %rax
+	jne	.L908
+	movq	-72(%rbp), %rdx
+	movq	%rcx, %rsi
+	movq	%rbx, %rdi
+	movq	%r11, -88(%rbp)
+	movl	%r8d, -80(%rbp)
+	movq	%rcx, -72(%rbp)
+	call	memcpy@PLT
+	movslq	-80(%rbp), %r8
+	movq	-72(%rbp), %rcx
+	movq	-88(%rbp), %r11
+	testl	%r8d, %r8d
+	jle	.L969
+	leaq	0(,%r8,8), %r12
+	movq	%rcx, -80(%rbp)
+	movq	%r12, %rdi
+	movq	%r11, -72(%rbp)
+	call	malloc@PLT
+	movq	-72(%rbp), %r11
+	movq	-80(%rbp), %rcx
+	movq	%r14, %rsi
+	movq	%rax, %r10
+	leaq	(%r12,%r14), %r9
+	.p2align 4,,10
+	.p2align 3
+.L913:
+	movq	(%rsi), %rdi
+	addq	$8, %rsi
+	movl	(%rdi,%r11), %eax
+	negl	%eax
+	cltq
+	movslq	(%rbx,%rax,4), %rdx
+	leal	1(%rdx), %r8d
+	movq	%rdi, (%r10,%rdx,8)
+	movl	%r8d, (%rbx,%rax,4)
+	cmpq	%r9, %rsi
+	jne	.L913
+.L912:
+	movq	%r14, %rdi
+	movq	%rcx, -88(%rbp)
+	movq	%r10, -72(%rbp)
+	call	free@PLT
+	movq	-72(%rbp), %r10
+	movq	-88(%rbp), %rsi
+	movl	$1, %eax
+	movq	%rax, %rcx
+	movl	%r15d, -80(%rbp)
+	movq	-176(%rbp), %rbx
+	movq	%r10, -184(%rbp)
+	movq	%rsi, %rax
+	jmp	.L926
+	.p2align 4,,10
+	.p2align 3
+.L914:
+	addq	$1, %rcx
+	movq	%r15, %rsp
+	cmpl	%ecx, -96(%rbp)
+	jl	.L970
+.L926:
+	movslq	0(%r13), %rsi
+	movslq	-4(%rax,%rcx,4), %rdi
+	movq	%rsp, %r15
+	movl	(%rax,%rcx,4), %edx
+	movq	%rsi, %r12
+	leaq	15(,%rsi,4), %rsi
+	subl	%edi, %edx
+	andq	$-16, %rsi
+	subq	%rsi, %rsp
+	testl	%edx, %edx
+	movl	%edx, -72(%rbp)
+	movq	%rsp, -120(%rbp)
+	jle	.L914
+	movq	%rax, -160(%rbp)
+	movq	-184(%rbp), %rax
+	movl	%ecx, -140(%rbp)
+	leaq	(%rax,%rdi,8), %r14
+	movq	112(%r13), %rdi
+	movq	%rcx, -152(%rbp)
+	call	clearSK@PLT
+	movslq	-72(%rbp), %rdx
+	movq	%r14, -88(%rbp)
+	movq	%r15, -168(%rbp)
+	leaq	(%r14,%rdx,8), %rax
+	movq	%rax, -112(%rbp)
+.L915:
+	movq	-88(%rbp), %rax
+	movq	(%rax), %r15
+	testl	%r12d, %r12d
+	jle	.L925
+	movl	%r12d, -72(%rbp)
+	movl	-92(%rbp), %r14d
+.L923:
+	xorl	%r12d, %r12d
+	.p2align 4,,10
+	.p2align 3
+.L920:
+	movl	(%r15,%r12,4), %eax
+	movl	%r14d, %esi
+	leal	1(%rax), %edx
+	movq	8(%r13), %rax
+	movq	(%rax,%r12,8), %rdi
+	call	stringCeil@PLT
+	movl	%eax, (%rbx,%r12,4)
+	cmpl	%r12d, -80(%rbp)
+	je	.L971
+	leal	1(%r12), %edx
+	cmpl	%edx, -72(%rbp)
+	setg	%cl
+	cmpl	$-2, %eax
+	setne	%dl
+	addq	$1, %r12
+	testb	%dl, %cl
+	jne	.L920
+	xorl	%r12d, %r12d
+	cmpl	$-2, %eax
+	movq	%r15, %rdi
+	sete	%r12b
+	call	free@PLT
+	testl	%r12d, %r12d
+	je	.L956
+.L972:
+	addq	$8, -88(%rbp)
+	movq	-112(%rbp), %rsi
+	movq	-88(%rbp), %rax
+	cmpq	%rsi, %rax
+	je	.L958
+	movq	(%rax), %r15
+	jmp	.L923
+.L969:
+	movl	$8, %edi
+	call	malloc@PLT
+	movq	-72(%rbp), %rcx
+	movq	%rax, %r10
+	jmp	.L912
+	.p2align 4,,10
+	.p2align 3
+.L971:
+	movq	8(%r13), %rax
+	movq	(%rax,%r12,8), %rdi
+	call	stringEnd@PLT
+	movl	-72(%rbp), %esi
+	leal	1(%r12), %ecx
+	movl	%eax, (%rbx,%r12,4)
+	movl	(%r15,%r12,4), %edx
+	cmpl	%esi, %ecx
+	setl	%sil
+	cmpl	%edx, %eax
+	setne	%cl
+	addq	$1, %r12
+	testb	%cl, %sil
+	jne	.L920
+	xorl	%r12d, %r12d
+	cmpl	%edx, %eax
+	movq	%r15, %rdi
+	sete	%r12b
+	call	free@PLT
+	testl	%r12d, %r12d
+	jne	.L972
+.L956:
+	movl	-72(%rbp), %r12d
+.L921:
+	movl	%r12d, %esi
+	movq	%rbx, %rdi
+	call	plusPlus@PLT
+	movl	0(%r13), %eax
+	movq	%rsp, -72(%rbp)
+	movq	%rbx, %rsi
+	leal	1(%rax), %ecx
+	movslq	%ecx, %rcx
+	leaq	0(,%rcx,4), %r15
+	leaq	15(%r15), %rax
+	leaq	-4(%r15), %rdx
+	shrq	$4, %rax
+	salq	$4, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %r8
+	subq	%rax, %rsp
+	movq	%r8, %rdi
+	movq	%rsp, %r14
+	call	memcpy@PLT
+	movl	-140(%rbp), %esi
+	movq	104(%r13), %rdi
+	movq	%r14, %rdx
+	movq	%rax, %r8
+	movl	$1, %eax
+	subl	%esi, %eax
+	movq	%r8, %rsi
+	movl	%eax, -4(%r8,%r15)
+	call	dominatedFind@PLT
+	movslq	0(%r13), %rdx
+	movq	-120(%rbp), %rdi
+	movq	%r14, %rsi
+	movl	%eax, %r15d
+	salq	$2, %rdx
+	call	memcpy@PLT
+	movq	-72(%rbp), %rsp
+	movl	%r12d, %esi
+	movq	%rbx, %rdi
+	call	minusMinus@PLT
+	testl	%r15d, %r15d
+	je	.L973
+.L924:
+	addq	$8, -88(%rbp)
+	movq	-112(%rbp), %rsi
+	movq	-88(%rbp), %rax
+	cmpq	%rsi, %rax
+	jne	.L915
+.L958:
+	movq	-152(%rbp), %rcx
+	movq	-160(%rbp), %rax
+	movq	%r13, %rdi
+	movq	-168(%rbp), %r15
+	movl	%ecx, %esi
+	movq	%rax, -88(%rbp)
+	movq	%rcx, -72(%rbp)
+	call	insertMinima.constprop.0
+	movq	-88(%rbp), %rax
+	movq	-72(%rbp), %rcx
+	jmp	.L914
+	.p2align 4,,10
+	.p2align 3
+.L925:
+	movq	%r15, %rdi
+	call	free@PLT
+	jmp	.L921
+	.p2align 4,,10
+	.p2align 3
+.L973:
+	movq	112(%r13), %rdi
+	movq	%rbx, %rsi
+	call	addSK@PLT
+	jmp	.L924
+.L970:
+	movq	-184(%rbp), %rdi
+	call	free@PLT
+	movq	-192(%rbp), %rsp
+	jmp	.L893
+.L931:
+	movl	$1, %eax
+	jmp	.L887
+	.cfi_endproc
+.LFE54:
+	.size	append, .-append
+	.p2align 4
+	.globl	appendRun
+	.type	appendRun, @function
+appendRun:
+.LFB55:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_offset 13, -40
+	movl	%ecx, %r13d
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	%rdx, %rbx
+	movslq	%esi, %rdx
+	leaq	0(,%rdx,8), %r15
+	subq	$184, %rsp
+	movl	36(%rdi), %eax
+	movq	%rdx, -128(%rbp)
+	movq	%rsp, -200(%rbp)
+	movl	%eax, -144(%rbp)
+	testl	%eax, %eax
+	jne	.L1051
+	addq	8(%rdi), %r15
+	movq	(%r15), %rdi
+	call	stringOwn@PLT
+	movq	%rax, -112(%rbp)
+	movq	%rax, %rdi
+	movq	%rax, (%r15)
+	testl	%r13d, %r13d
+	jg	.L1052
+	call	stringSigma@PLT
+	movl	%eax, %esi
+	cltq
+	leaq	15(,%rax,4), %rdx
+	addq	$15, %rax
+	andq	$-16, %rdx
+	andq	$-16, %rax
+	subq	%rdx, %rsp
+	movq	%rsp, %rcx
+	subq	%rax, %rsp
+	movq	%rsp, -184(%rbp)
+	testl	%esi, %esi
+	jle	.L991
+.L1015:
+	testl	%esi, %esi
+	movl	$1, %edi
+	cmovg	%esi, %edi
+	cmpl	$3, %esi
+	jle	.L1016
+	movl	%edi, %edx
+	movdqa	.LC9(%rip), %xmm0
+	movq	%rcx, %rax
+	shrl	$2, %edx
+	salq	$4, %rdx
+	addq	%rcx, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L984:
+	movups	%xmm0, (%rax)
+	addq	$16, %rax
+	cmpq	%rax, %rdx
+	jne	.L984
+	movl	%edi, %eax
+	andl	$-4, %eax
+	andl	$3, %edi
+	je	.L987
+.L983:
+	movslq	%eax, %rdx
+	leal	1(%rax), %edi
+	leaq	(%rcx,%rdx,4), %rdx
+	movl	$-3, (%rdx)
+	cmpl	%edi, %esi
+	jle	.L987
+	addl	$2, %eax
+	movl	$-3, 4(%rdx)
+	cmpl	%eax, %esi
+	jle	.L987
+	movl	$-3, 8(%rdx)
+.L987:
+	testl	%r13d, %r13d
+	jle	.L991
+.L982:
+	movslq	%r13d, %rdx
+	movq	%rbx, -72(%rbp)
+	movq	%rbx, %r13
+	movq	%r14, -80(%rbp)
+	leaq	(%rbx,%rdx), %r12
+	movq	%rcx, %r14
+	movl	-144(%rbp), %ebx
+	jmp	.L989
+	.p2align 4,,10
+	.p2align 3
+.L988:
+	addq	$1, %r13
+	cmpq	%r13, %r12
+	je	.L1053
+.L989:
+	movsbl	0(%r13), %esi
+	leal	-65(%rsi), %r15d
+	movslq	%r15d, %r15
+	cmpl	$-3, (%r14,%r15,4)
+	jne	.L988
+	movq	-112(%rbp), %rdi
+	addq	$1, %r13
+	call	stringLast@PLT
+	movzbl	-1(%r13), %esi
+	movq	-184(%rbp), %rcx
+	movl	%eax, (%r14,%r15,4)
+	movslq	%ebx, %rax
+	addl	$1, %ebx
+	movb	%sil, (%rcx,%rax)
+	cmpq	%r13, %r12
+	jne	.L989
+.L1053:
+	movl	%ebx, -144(%rbp)
+	movq	%r14, %r15
+	movq	-112(%rbp), %r13
+	movq	-72(%rbp), %rbx
+	movq	-80(%rbp), %r14
+	.p2align 4,,10
+	.p2align 3
+.L990:
+	movsbl	(%rbx), %esi
+	movq	%r13, %rdi
+	addq	$1, %rbx
+	call	stringAppend@PLT
+	cmpq	%rbx, %r12
+	jne	.L990
+	movl	4(%r14), %edx
+	movq	%r13, -112(%rbp)
+	testl	%edx, %edx
+	je	.L1054
+.L991:
+	movq	%r14, %rdi
+	call	trimFronts
+	movq	-200(%rbp), %rsp
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L1052:
+	.cfi_restore_state
+	call	stringSize@PLT
+	testl	%eax, %eax
+	jne	.L981
+	subl	$1, 4(%r14)
+.L981:
+	movq	-112(%rbp), %rdi
+	call	stringSigma@PLT
+	movl	%eax, %esi
+	cltq
+	leaq	15(,%rax,4), %rdx
+	addq	$15, %rax
+	andq	$-16, %rdx
+	andq	$-16, %rax
+	subq	%rdx, %rsp
+	movq	%rsp, %rcx
+	subq	%rax, %rsp
+	movq	%rsp, -184(%rbp)
+	testl	%esi, %esi
+	jg	.L1015
+	jmp	.L982
+	.p2align 4,,10
+	.p2align 3
+.L1051:
+	movq	48(%rdi), %r12
+	addq	%r15, %r12
+	movq	(%r12), %rdi
+	call	stringOwn@PLT
+	movq	%rax, (%r12)
+	movslq	%r13d, %r12
+	addq	%rbx, %r12
+	testl	%r13d, %r13d
+	jle	.L979
+	.p2align 4,,10
+	.p2align 3
+.L978:
+	movq	48(%r14), %rax
+	movsbl	(%rbx), %esi
+	addq	$1, %rbx
+	movq	(%rax,%r15), %rdi
+	call	stringAppend@PLT
+	cmpq	%rbx, %r12
+	jne	.L978
+.L979:
+	movq	120(%r14), %rsi
+	movq	%r14, %rdi
+	call	paceMLCS
+	movq	-200(%rbp), %rsp
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L1054:
+	.cfi_restore_state
+	movslq	(%r14), %rax
+	movl	%edx, -88(%rbp)
+	xorl	%r12d, %r12d
+	movq	%r15, -104(%rbp)
+	leaq	0(,%rax,4), %rbx
+	movq	%rax, %r15
+	movl	%eax, -140(%rbp)
+	movq	%rbx, %rdi
+	movq	%rbx, -80(%rbp)
+	call	malloc@PLT
+	movq	%rbx, %rdi
+	movq	%rax, -72(%rbp)
+	call	malloc@PLT
+	movq	%rbx, %rdi
+	movq	%rax, -96(%rbp)
+	call	malloc@PLT
+	movq	%rbx, %rdi
+	movq	%rax, -216(%rbp)
+	call	malloc@PLT
+	testl	%r15d, %r15d
+	movl	-88(%rbp), %edx
+	movq	-104(%rbp), %rcx
+	movq	%rax, -208(%rbp)
+	movq	%rax, %rsi
+	leaq	(%rbx,%rax), %r13
+	movslq	-144(%rbp), %rax
+	movq	%rax, -136(%rbp)
+	jle	.L1000
+	movq	%rcx, -160(%rbp)
+	movq	%r14, %r15
+	movq	%r13, -120(%rbp)
+	movl	%edx, -152(%rbp)
+	movq	%r12, %rdx
+	movq	%rsi, %r12
+	.p2align 4,,10
+	.p2align 3
+.L999:
+	movl	-144(%rbp), %esi
+	movl	$-1, (%r12)
+	testl	%esi, %esi
+	je	.L996
+	movq	-184(%rbp), %rax
+	movl	$-1, %ebx
+	movq	%r15, %r13
+	movq	%r12, -88(%rbp)
+	movq	-136(%rbp), %rcx
+	movl	%ebx, %r15d
+	movq	%rdx, %rbx
+	movq	%rax, %r14
+	addq	%rcx, %rax
+	movq	%rax, -104(%rbp)
+	jmp	.L998
+	.p2align 4,,10
+	.p2align 3
+.L997:
+	addq	$1, %r14
+	cmpq	%r14, -104(%rbp)
+	je	.L1043
+.L1055:
+	movq	-88(%rbp), %rax
+	movl	(%rax), %r15d
+.L998:
+	movq	8(%r13), %rax
+	movsbl	(%r14), %r12d
+	movq	(%rax,%rbx), %rdi
+	movl	%r12d, %esi
+	call	stringLast@PLT
+	cmpl	%r15d, %eax
+	jle	.L997
+	movq	8(%r13), %rax
+	movl	%r12d, %esi
+	addq	$1, %r14
+	movq	(%rax,%rbx), %rdi
+	call	stringLast@PLT
+	movq	-88(%rbp), %rdx
+	movl	%eax, (%rdx)
+	cmpq	%r14, -104(%rbp)
+	jne	.L1055
+.L1043:
+	movq	-88(%rbp), %r12
+	movq	%rbx, %rdx
+	movq	%r13, %r15
+.L996:
+	addq	$4, %r12
+	addq	$8, %rdx
+	cmpq	%r12, -120(%rbp)
+	jne	.L999
+	movl	-152(%rbp), %edx
+	movq	-160(%rbp), %rcx
+	movq	%r15, %r14
+.L1000:
+	movq	-128(%rbp), %rbx
+	movq	-208(%rbp), %rax
+	movq	%rcx, -104(%rbp)
+	movq	-112(%rbp), %rdi
+	movl	%edx, -88(%rbp)
+	salq	$2, %rbx
+	leaq	(%rax,%rbx), %r12
+	call	stringEnd@PLT
+	movl	16(%r14), %edi
+	movl	%eax, (%r12)
+	movl	$8, %r12d
+	testl	%edi, %edi
+	js	.L995
+	movq	-96(%rbp), %rax
+	movq	-216(%rbp), %r15
+	movq	%r12, -120(%rbp)
+	movq	-184(%rbp), %rcx
+	movl	-88(%rbp), %edx
+	addq	%rbx, %rax
+	movq	%rax, -152(%rbp)
+	leaq	(%r15,%rbx), %rax
+	movq	%rax, -160(%rbp)
+	movslq	-144(%rbp), %rax
+	movl	%edx, -188(%rbp)
+	addq	%rcx, %rax
+	movq	-104(%rbp), %rcx
+	movq	%rax, -176(%rbp)
+	movl	%edx, %eax
+	movq	%rcx, -168(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L994:
+	cmpl	%eax, 56(%r14)
+	jle	.L995
+	movq	-120(%rbp), %rcx
+	movq	-72(%rbp), %rdx
+	movq	-208(%rbp), %rsi
+	leaq	-8(%rcx), %rax
+	movq	%rax, -128(%rbp)
+	movq	24(%r14), %rax
+	movq	-8(%rax,%rcx), %rdi
+	call	dominatedFind@PLT
+	testl	%eax, %eax
+	je	.L995
+	movq	%r14, %rdi
+	movq	%r14, %r13
+	call	growPF
+	movq	112(%r14), %rdi
+	call	clearSK@PLT
+	movq	-184(%rbp), %rax
+	movl	-144(%rbp), %ecx
+	movq	%rax, -88(%rbp)
+	leaq	-52(%rbp), %rax
+	movq	%rax, -136(%rbp)
+	testl	%ecx, %ecx
+	je	.L1011
+	.p2align 4,,10
+	.p2align 3
+.L1012:
+	movq	-88(%rbp), %rax
+	movl	-140(%rbp), %edx
+	xorl	%r12d, %r12d
+	movsbl	(%rax), %ebx
+	testl	%edx, %edx
+	jle	.L1007
+	movq	%r13, %r14
+	movl	%ebx, %r13d
+	movq	-96(%rbp), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L1004:
+	movq	8(%r14), %rax
+	movl	$-1, (%rbx,%r12)
+	movl	%r13d, %esi
+	movq	(%rax,%r12,2), %rdi
+	call	stringLast@PLT
+	movl	%eax, (%r15,%r12)
+	addq	$4, %r12
+	cmpq	%r12, -80(%rbp)
+	jne	.L1004
+	movl	%r13d, %ebx
+	movq	%r14, %r13
+.L1007:
+	movq	-168(%rbp), %rcx
+	leal	-65(%rbx), %eax
+	movq	-112(%rbp), %rdi
+	xorl	%r12d, %r12d
+	cltq
+	movq	-152(%rbp), %rdx
+	movl	(%rcx,%rax,4), %eax
+	movl	%eax, (%rdx)
+	call	stringEnd@PLT
+	movq	-160(%rbp), %rcx
+	movq	-128(%rbp), %rdx
+	movq	-96(%rbp), %rsi
+	movl	%eax, (%rcx)
+	movq	24(%r13), %rax
+	movq	-136(%rbp), %rcx
+	movq	(%rax,%rdx), %rdi
+	movq	%r15, %rdx
+	call	rangeCollect@PLT
+	movq	%rax, %r14
+	movl	-52(%rbp), %eax
+	testl	%eax, %eax
+	jle	.L1056
+	movq	%r15, -104(%rbp)
+	movq	%r14, %r15
+	movl	%ebx, %r14d
+	movq	%r13, %rbx
+	movq	-120(%rbp), %r13
+	.p2align 4,,10
+	.p2align 3
+.L1005:
+	movq	24(%rbx), %rcx
+	movq	(%r15,%r12,8), %rdx
+	movq	%rbx, %rdi
+	movq	-72(%rbp), %r8
+	movq	(%rcx,%r13), %rsi
+	movl	%r14d, %ecx
+	call	succCandidate
+	movq	(%r15,%r12,8), %rdi
+	addq	$1, %r12
+	call	free@PLT
+	cmpl	%r12d, -52(%rbp)
+	jg	.L1005
+	movq	%r15, %r14
+	movq	-104(%rbp), %r15
+	movq	%rbx, %r13
+.L1008:
+	movq	%r14, %rdi
+	call	free@PLT
+	addq	$1, -88(%rbp)
+	movq	-88(%rbp), %rax
+	cmpq	%rax, -176(%rbp)
+	jne	.L1012
+.L1050:
+	movq	%r13, %r14
+.L1011:
+	movl	-188(%rbp), %r13d
+	movq	%r14, %rdi
+	leal	1(%r13), %ebx
+	movl	%ebx, %esi
+	call	insertMinima.constprop.0
+	movl	16(%r14), %eax
+	cmpl	%r13d, %eax
+	je	.L1057
+.L1003:
+	addq	$8, -120(%rbp)
+	cmpl	%eax, %ebx
+	jg	.L995
+	movl	%ebx, -188(%rbp)
+	movl	%ebx, %eax
+	jmp	.L994
+	.p2align 4,,10
+	.p2align 3
+.L1056:
+	testq	%r14, %r14
+	jne	.L1008
+	addq	$1, -88(%rbp)
+	movq	-88(%rbp), %rax
+	cmpq	%rax, -176(%rbp)
+	jne	.L1012
+	jmp	.L1050
+.L1057:
+	movq	24(%r14), %rax
+	movq	-120(%rbp), %rcx
+	movq	(%rax,%rcx), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	movl	16(%r14), %eax
+	jle	.L1003
+	addl	$1, %eax
+	movl	%eax, 16(%r14)
+	jmp	.L1003
+.L995:
+	movq	-208(%rbp), %rdi
+	call	free@PLT
+	movq	-216(%rbp), %rdi
+	call	free@PLT
+	movq	-96(%rbp), %rdi
+	call	free@PLT
+	movq	-72(%rbp), %rdi
+	call	free@PLT
+	jmp	.L991
+.L1016:
+	xorl	%eax, %eax
+	jmp	.L983
+	.cfi_endproc
+.LFE55:
+	.size	appendRun, .-appendRun
+	.p2align 4
+	.globl	appendColumn
+	.type	appendColumn, @function
+appendColumn:
+.LFB56:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$152, %rsp
+	movl	(%rdi), %r11d
+	movl	36(%rdi), %edi
+	movq	%rsp, -184(%rbp)
+	testl	%edi, %edi
+	jne	.L1143
+	movslq	%r11d, %rax
+	movq	%rax, -104(%rbp)
+	salq	$2, %rax
+	movq	%rax, -152(%rbp)
+	addq	$15, %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, -144(%rbp)
+	testl	%r11d, %r11d
+	jle	.L1064
+	xorl	%r12d, %r12d
+	movl	%r11d, %r15d
+	movq	%rsi, %r14
+	.p2align 4,,10
+	.p2align 3
+.L1068:
+	movq	8(%rbx), %rax
+	leaq	(%rax,%r12,8), %r13
+	movq	0(%r13), %rdi
+	call	stringOwn@PLT
+	movq	%rax, 0(%r13)
+	movq	8(%rbx), %rax
+	movsbl	(%r14,%r12), %esi
+	movq	(%rax,%r12,8), %rdi
+	call	stringLast@PLT
+	movq	-144(%rbp), %rcx
+	movl	%eax, (%rcx,%r12,4)
+	movq	8(%rbx), %rax
+	movq	(%rax,%r12,8), %rdi
+	call	stringSize@PLT
+	testl	%eax, %eax
+	jne	.L1065
+	subl	$1, 4(%rbx)
+.L1065:
+	movq	8(%rbx), %rax
+	movsbl	(%r14,%r12), %esi
+	movq	(%rax,%r12,8), %rdi
+	addq	$1, %r12
+	call	stringAppend@PLT
+	cmpq	%r12, -104(%rbp)
+	jne	.L1068
+	movq	%r14, -88(%rbp)
+	movq	-152(%rbp), %r14
+	movl	%r15d, -112(%rbp)
+	movq	%r14, %rdi
+	call	malloc@PLT
+	movq	%r14, %rdi
+	movq	%rax, -80(%rbp)
+	call	malloc@PLT
+	movq	%r14, %rdi
+	xorl	%r14d, %r14d
+	movq	%rax, -72(%rbp)
+	call	malloc@PLT
+	movq	-88(%rbp), %r8
+	movl	-112(%rbp), %r11d
+	movq	%rax, %r13
+	movq	-104(%rbp), %rax
+	movq	%r13, -88(%rbp)
+	addq	%r8, %rax
+	movl	%r11d, -120(%rbp)
+	movq	%rax, -96(%rbp)
+	movq	%r8, -112(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L1072:
+	movq	-88(%rbp), %rax
+	movl	$-1, %r15d
+	movq	-112(%rbp), %r13
+	leaq	0(,%r14,8), %r12
+	movl	$-1, (%rax,%r14,4)
+	movq	%rbx, %rax
+	movl	%r15d, %ebx
+	movq	%rax, %r15
+	jmp	.L1071
+	.p2align 4,,10
+	.p2align 3
+.L1069:
+	movq	-96(%rbp), %rax
+	addq	$1, %r13
+	cmpq	%rax, %r13
+	je	.L1070
+.L1144:
+	movq	-88(%rbp), %rax
+	movl	(%rax,%r14,4), %ebx
+.L1071:
+	movq	8(%r15), %rax
+	movsbl	0(%r13), %esi
+	movq	(%rax,%r12), %rdi
+	call	stringLast@PLT
+	cmpl	%ebx, %eax
+	jle	.L1069
+	movq	8(%r15), %rax
+	movsbl	0(%r13), %esi
+	addq	$1, %r13
+	movq	(%rax,%r12), %rdi
+	call	stringLast@PLT
+	movq	-88(%rbp), %rcx
+	movl	%eax, (%rcx,%r14,4)
+	movq	-96(%rbp), %rax
+	cmpq	%rax, %r13
+	jne	.L1144
+.L1070:
+	movq	%r15, %rbx
+	addq	$1, %r14
+	cmpq	%r14, -104(%rbp)
+	jne	.L1072
+	movq	-88(%rbp), %r13
+	movl	-120(%rbp), %r11d
+	movq	-112(%rbp), %r8
+.L1106:
+	movl	$0, -160(%rbp)
+	movl	16(%rbx), %eax
+	movq	%rsp, %r15
+	leal	1(%rax), %r12d
+	movslq	(%rbx), %rax
+	leaq	15(,%rax,4), %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, -88(%rbp)
+	cmpl	$1, %r12d
+	jle	.L1073
+	movl	%r11d, -96(%rbp)
+	movl	%r12d, %r14d
+	movq	%r8, -104(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L1076:
+	movl	-160(%rbp), %eax
+	movq	%r13, %rsi
+	leal	(%rax,%r14), %ecx
+	movq	24(%rbx), %rax
+	sarl	%ecx
+	movslq	%ecx, %rdx
+	movq	(%rax,%rdx,8), %rdi
+	movq	%rdx, %r12
+	movq	-88(%rbp), %rdx
+	call	dominatedFind@PLT
+	testl	%eax, %eax
+	je	.L1074
+	leal	1(%r12), %eax
+	cmpl	%eax, %r14d
+	jle	.L1145
+	movl	%r12d, -160(%rbp)
+	jmp	.L1076
+.L1143:
+	movslq	%r11d, %r12
+	xorl	%r13d, %r13d
+	movq	%rsi, %r15
+	testl	%r11d, %r11d
+	jle	.L1063
+.L1062:
+	movq	48(%rbx), %rax
+	leaq	(%rax,%r13,8), %r14
+	movq	(%r14), %rdi
+	call	stringOwn@PLT
+	movq	%rax, (%r14)
+	movq	48(%rbx), %rax
+	movsbl	(%r15,%r13), %esi
+	movq	(%rax,%r13,8), %rdi
+	addq	$1, %r13
+	call	stringAppend@PLT
+	cmpq	%r12, %r13
+	jne	.L1062
+.L1063:
+	movq	120(%rbx), %rsi
+	movq	%rbx, %rdi
+	call	paceMLCS
+	movq	-184(%rbp), %rsp
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L1074:
+	.cfi_restore_state
+	movl	-160(%rbp), %eax
+	addl	$1, %eax
+	cmpl	%eax, %r12d
+	jle	.L1134
+	movl	%r12d, %r14d
+	jmp	.L1076
+.L1134:
+	movl	-96(%rbp), %r11d
+	movq	-104(%rbp), %r8
+.L1073:
+	movl	16(%rbx), %esi
+	movq	%r15, %rsp
+	testl	%esi, %esi
+	js	.L1078
+	movl	56(%rbx), %ecx
+	testl	%ecx, %ecx
+	jle	.L1078
+	leaq	-52(%rbp), %rax
+	movq	$8, -104(%rbp)
+	movl	$0, -156(%rbp)
+	movq	%rax, -168(%rbp)
+	movq	%r13, -96(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L1104:
+	movq	%rbx, %rdi
+	movq	%r8, -112(%rbp)
+	movl	%r11d, -88(%rbp)
+	call	growPF
+	movq	112(%rbx), %rdi
+	call	clearSK@PLT
+	movl	-88(%rbp), %r11d
+	movq	-112(%rbp), %r8
+	testl	%r11d, %r11d
+	jle	.L1084
+	movsbl	(%r8), %eax
+	xorl	%r12d, %r12d
+	movq	-96(%rbp), %r15
+	movl	%r11d, -112(%rbp)
+	movq	-152(%rbp), %r14
+	movq	-72(%rbp), %r13
+	movq	%r8, -128(%rbp)
+	movl	%eax, -88(%rbp)
+	movb	%al, -120(%rbp)
+	movq	%rbx, %rax
+	movq	%r12, %rbx
+	movq	%rax, %r12
+	.p2align 4,,10
+	.p2align 3
+.L1082:
+	movq	8(%r12), %rax
+	movl	-88(%rbp), %esi
+	movl	$-1, 0(%r13,%rbx)
+	movq	(%rax,%rbx,2), %rdi
+	call	stringLast@PLT
+	movl	%eax, (%r15,%rbx)
+	addq	$4, %rbx
+	cmpq	%rbx, %r14
+	jne	.L1082
+	movl	-112(%rbp), %r11d
+	movzbl	-120(%rbp), %r10d
+	movq	%r12, %rbx
+	movq	-128(%rbp), %r8
+	testl	%r11d, %r11d
+	jle	.L1095
+	movl	-88(%rbp), %r13d
+	xorl	%r12d, %r12d
+	.p2align 4,,10
+	.p2align 3
+.L1100:
+	cmpb	%r10b, (%r8,%r12)
+	je	.L1146
+.L1096:
+	addq	$1, %r12
+	cmpl	%r12d, %r11d
+	jg	.L1100
+.L1095:
+	movl	$1, %r15d
+	cmpl	$1, %r11d
+	je	.L1084
+	movq	%r15, %rdi
+	movq	%rbx, %r15
+.L1083:
+	movzbl	(%r8,%rdi), %r10d
+	movl	$1, %eax
+	movl	%edi, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L1085:
+	movzbl	-1(%r8,%rax), %edx
+	cmpl	%eax, %edi
+	setg	%sil
+	cmpb	%r10b, %dl
+	setne	%cl
+	addq	$1, %rax
+	testb	%cl, %sil
+	jne	.L1085
+	cmpb	%r10b, %dl
+	jne	.L1093
+.L1087:
+	addq	$1, %rdi
+	cmpl	%edi, %r11d
+	jg	.L1083
+	movq	%r15, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L1084:
+	movl	-156(%rbp), %eax
+	movq	112(%rbx), %rdi
+	movq	%r8, -112(%rbp)
+	xorl	%r12d, %r12d
+	movl	%r11d, -88(%rbp)
+	leal	1(%rax), %r14d
+	call	minimaSK@PLT
+	movl	-88(%rbp), %r11d
+	movq	-112(%rbp), %r8
+	testl	%eax, %eax
+	movl	%eax, %r15d
+	jle	.L1081
+	movq	%r8, -88(%rbp)
+	movl	%r11d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L1080:
+	movq	112(%rbx), %rdi
+	movl	%r12d, %esi
+	addl	$1, %r12d
+	call	pointSK@PLT
+	movl	%r14d, %esi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	frontInsert
+	cmpl	%r12d, %r15d
+	jne	.L1080
+	movq	-88(%rbp), %r8
+	movl	%r13d, %r11d
+.L1081:
+	movl	16(%rbx), %eax
+	movl	-156(%rbp), %ecx
+	cmpl	%ecx, %eax
+	je	.L1147
+.L1102:
+	cmpl	%eax, %r14d
+	jg	.L1139
+.L1151:
+	addq	$8, -104(%rbp)
+	cmpl	56(%rbx), %r14d
+	jge	.L1139
+	movl	-160(%rbp), %eax
+	cmpl	%eax, %r14d
+	jg	.L1139
+	movl	%r14d, -156(%rbp)
+	jmp	.L1104
+.L1093:
+	movl	%r11d, -112(%rbp)
+	xorl	%r12d, %r12d
+	movq	%r15, %rax
+	movsbl	%r10b, %ebx
+	movq	%rdi, -120(%rbp)
+	movq	-152(%rbp), %r14
+	movq	%r12, %r15
+	movq	%rax, %r12
+	movb	%r10b, -128(%rbp)
+	movq	%r8, -136(%rbp)
+	movl	%r13d, -88(%rbp)
+	movq	-96(%rbp), %r13
+	.p2align 4,,10
+	.p2align 3
+.L1086:
+	movq	-72(%rbp), %rax
+	movl	%ebx, %esi
+	movl	$-1, (%rax,%r15)
+	movq	8(%r12), %rax
+	movq	(%rax,%r15,2), %rdi
+	call	stringLast@PLT
+	movl	%eax, 0(%r13,%r15)
+	addq	$4, %r15
+	cmpq	%r15, %r14
+	jne	.L1086
+	movl	-88(%rbp), %r13d
+	movl	-112(%rbp), %r11d
+	movq	%r12, %r15
+	movq	-120(%rbp), %rdi
+	movzbl	-128(%rbp), %r10d
+	movq	-136(%rbp), %r8
+	cmpl	%r11d, %r13d
+	jge	.L1087
+	movq	%rdi, -88(%rbp)
+	movq	%rdi, %r12
+	.p2align 4,,10
+	.p2align 3
+.L1092:
+	cmpb	%r10b, (%r8,%r12)
+	je	.L1148
+.L1088:
+	addq	$1, %r12
+	cmpl	%r12d, %r11d
+	jg	.L1092
+	movq	-88(%rbp), %rdi
+	jmp	.L1087
+	.p2align 4,,10
+	.p2align 3
+.L1148:
+	movq	-72(%rbp), %rsi
+	movq	-104(%rbp), %rcx
+	movb	%r10b, -128(%rbp)
+	xorl	%r13d, %r13d
+	movq	-144(%rbp), %rax
+	movq	-96(%rbp), %rdx
+	movq	%r8, -136(%rbp)
+	movl	%r11d, -120(%rbp)
+	movl	(%rax,%r12,4), %eax
+	movl	%eax, -112(%rbp)
+	movl	%eax, (%rsi,%r12,4)
+	movq	24(%r15), %rax
+	movq	-8(%rax,%rcx), %rdi
+	movq	-168(%rbp), %rcx
+	call	rangeCollect@PLT
+	movl	-52(%rbp), %edx
+	movl	-120(%rbp), %r11d
+	movzbl	-128(%rbp), %r10d
+	movq	-136(%rbp), %r8
+	movq	%rax, %r14
+	testl	%edx, %edx
+	jle	.L1149
+	movl	%r11d, -120(%rbp)
+	movq	%r15, %rax
+	movq	%r14, %r15
+	movb	%r10b, -136(%rbp)
+	movq	%rax, %r14
+	movq	%r8, -176(%rbp)
+	movq	%r12, -128(%rbp)
+	movq	%r13, %r12
+	movq	-104(%rbp), %r13
+	.p2align 4,,10
+	.p2align 3
+.L1089:
+	movq	24(%r14), %rcx
+	movq	(%r15,%r12,8), %rdx
+	movq	%r14, %rdi
+	movq	-80(%rbp), %r8
+	movq	(%rcx,%r13), %rsi
+	movl	%ebx, %ecx
+	call	succCandidate
+	movq	(%r15,%r12,8), %rdi
+	addq	$1, %r12
+	call	free@PLT
+	cmpl	%r12d, -52(%rbp)
+	jg	.L1089
+	movq	%r14, %rax
+	movl	-120(%rbp), %r11d
+	movq	-128(%rbp), %r12
+	movq	%r15, %r14
+	movzbl	-136(%rbp), %r10d
+	movq	-176(%rbp), %r8
+	movq	%rax, %r15
+.L1090:
+	movq	%r14, %rdi
+	movq	%r8, -136(%rbp)
+	movb	%r10b, -128(%rbp)
+	movl	%r11d, -120(%rbp)
+	call	free@PLT
+	movl	-120(%rbp), %r11d
+	movzbl	-128(%rbp), %r10d
+	movq	-136(%rbp), %r8
+.L1091:
+	movq	-72(%rbp), %rax
+	movl	-112(%rbp), %ecx
+	movl	$-1, (%rax,%r12,4)
+	movq	-96(%rbp), %rax
+	movl	%ecx, (%rax,%r12,4)
+	jmp	.L1088
+	.p2align 4,,10
+	.p2align 3
+.L1146:
+	movq	-72(%rbp), %rsi
+	movq	-104(%rbp), %rcx
+	movq	%r8, -128(%rbp)
+	xorl	%r14d, %r14d
+	movq	-144(%rbp), %rax
+	movq	-96(%rbp), %rdx
+	movb	%r10b, -120(%rbp)
+	movl	%r11d, -112(%rbp)
+	movl	(%rax,%r12,4), %eax
+	movl	%eax, -88(%rbp)
+	movl	%eax, (%rsi,%r12,4)
+	movq	24(%rbx), %rax
+	movq	-8(%rax,%rcx), %rdi
+	movq	-168(%rbp), %rcx
+	call	rangeCollect@PLT
+	movl	-112(%rbp), %r11d
+	movzbl	-120(%rbp), %r10d
+	movq	%rax, %r15
+	movl	-52(%rbp), %eax
+	movq	-128(%rbp), %r8
+	testl	%eax, %eax
+	jle	.L1150
+	movl	%r11d, -112(%rbp)
+	movb	%r10b, -120(%rbp)
+	movq	%r8, -136(%rbp)
+	movq	%r12, -128(%rbp)
+	movq	%rbx, %r12
+	movq	%r14, %rbx
+	movq	-104(%rbp), %r14
+	.p2align 4,,10
+	.p2align 3
+.L1097:
+	movq	24(%r12), %rcx
+	movq	(%r15,%rbx,8), %rdx
+	movq	%r12, %rdi
+	movq	-80(%rbp), %r8
+	movq	(%rcx,%r14), %rsi
+	movl	%r13d, %ecx
+	call	succCandidate
+	movq	(%r15,%rbx,8), %rdi
+	addq	$1, %rbx
+	call	free@PLT
+	cmpl	%ebx, -52(%rbp)
+	jg	.L1097
+	movq	%r12, %rbx
+	movl	-112(%rbp), %r11d
+	movzbl	-120(%rbp), %r10d
+	movq	-128(%rbp), %r12
+	movq	-136(%rbp), %r8
+.L1098:
+	movq	%r15, %rdi
+	movq	%r8, -128(%rbp)
+	movb	%r10b, -120(%rbp)
+	movl	%r11d, -112(%rbp)
+	call	free@PLT
+	movq	-128(%rbp), %r8
+	movzbl	-120(%rbp), %r10d
+	movl	-112(%rbp), %r11d
+.L1099:
+	movq	-72(%rbp), %rax
+	movl	-88(%rbp), %ecx
+	movl	$-1, (%rax,%r12,4)
+	movq	-96(%rbp), %rax
+	movl	%ecx, (%rax,%r12,4)
+	jmp	.L1096
+.L1147:
+	movq	24(%rbx), %rax
+	movq	-104(%rbp), %rcx
+	movq	%r8, -112(%rbp)
+	movl	%r11d, -88(%rbp)
+	movq	(%rax,%rcx), %rdi
+	call	weightORT@PLT
+	movl	-88(%rbp), %r11d
+	movq	-112(%rbp), %r8
+	testl	%eax, %eax
+	movl	16(%rbx), %eax
+	jle	.L1102
+	addl	$1, %eax
+	movl	%eax, 16(%rbx)
+	cmpl	%eax, %r14d
+	jle	.L1151
+.L1139:
+	movq	-96(%rbp), %r13
+.L1078:
+	movq	%r13, %rdi
+	call	free@PLT
+	movq	-72(%rbp), %rdi
+	call	free@PLT
+	movq	-80(%rbp), %rdi
+	call	free@PLT
+	movq	%rbx, %rdi
+	call	trimFronts
+	movq	-184(%rbp), %rsp
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L1149:
+	.cfi_restore_state
+	testq	%rax, %rax
+	je	.L1091
+	jmp	.L1090
+.L1150:
+	testq	%r15, %r15
+	je	.L1099
+	jmp	.L1098
+.L1145:
+	movl	-96(%rbp), %r11d
+	movq	-104(%rbp), %r8
+	movl	%r12d, -160(%rbp)
+	jmp	.L1073
+.L1064:
+	movq	-152(%rbp), %r14
+	movl	%r11d, -88(%rbp)
+	movq	%rsi, -96(%rbp)
+	movq	%r14, %rdi
+	call	malloc@PLT
+	movq	%r14, %rdi
+	movq	%rax, -80(%rbp)
+	call	malloc@PLT
+	movq	%r14, %rdi
+	movq	%rax, -72(%rbp)
+	call	malloc@PLT
+	movl	-88(%rbp), %r11d
+	movq	-96(%rbp), %r8
+	movq	%rax, %r13
+	jmp	.L1106
+	.cfi_endproc
+.LFE56:
+	.size	appendColumn, .-appendColumn
+	.p2align 4
+	.type	flushMLCS.part.0, @function
+flushMLCS.part.0:
+.LFB106:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	call	finishRepair
+	movl	(%rbx), %esi
+	testl	%esi, %esi
+	jle	.L1153
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L1154:
+	movq	40(%rbx), %rax
+	movl	(%rax,%rbp,4), %r12d
+	movq	48(%rbx), %rax
+	movq	(%rax,%rbp,8), %rdi
+	sall	$5, %r12d
+	call	stringSize@PLT
+	addl	%eax, %r12d
+	movq	8(%rbx), %rax
+	addl	%r12d, %r13d
+	movq	(%rax,%rbp,8), %rdi
+	call	stringSize@PLT
+	movq	40(%rbx), %rdx
+	subl	(%rdx,%rbp,4), %eax
+	movl	%eax, %r12d
+	movq	48(%rbx), %rax
+	movq	(%rax,%rbp,8), %rdi
+	addq	$1, %rbp
+	call	stringSize@PLT
+	addl	%eax, %r12d
+	movl	(%rbx), %eax
+	addl	%r12d, %r14d
+	cmpl	%ebp, %eax
+	jg	.L1154
+	imull	%eax, %r13d
+	movl	$0, 36(%rbx)
+	leal	0(%r13,%r13,2), %edx
+	cmpl	%edx, %r14d
+	jle	.L1156
+	testl	%eax, %eax
+	jle	.L1158
+	movq	40(%rbx), %rdx
+	xorl	%r13d, %r13d
+	jmp	.L1171
+	.p2align 4,,10
+	.p2align 3
+.L1159:
+	movl	36(%rbx), %eax
+	testl	%eax, %eax
+	jne	.L1181
+	movl	%ebp, %edx
+	movl	%r13d, %esi
+	movq	%rbx, %rdi
+	call	popMany.part.0
+	movq	40(%rbx), %rdx
+	leaq	(%rdx,%r12), %rax
+.L1160:
+	movl	$0, (%rax)
+	movl	(%rbx), %eax
+	addq	$1, %r13
+	cmpl	%r13d, %eax
+	jle	.L1182
+.L1171:
+	leaq	0(,%r13,4), %r12
+	movl	%r13d, %r14d
+	leaq	(%rdx,%r12), %rax
+	movl	(%rax), %ebp
+	cmpl	$15, %ebp
+	jg	.L1159
+	testl	%ebp, %ebp
+	jle	.L1160
+	leaq	0(,%r13,8), %r15
+	xorl	%ebp, %ebp
+	jmp	.L1167
+	.p2align 4,,10
+	.p2align 3
+.L1165:
+	movl	$1, %edx
+	movl	%r14d, %esi
+	movq	%rbx, %rdi
+	call	popMany.part.0
+.L1164:
+	movq	40(%rbx), %rdx
+	addl	$1, %ebp
+	leaq	(%rdx,%r12), %rax
+	cmpl	(%rax), %ebp
+	jge	.L1160
+.L1167:
+	movl	36(%rbx), %ecx
+	testl	%ecx, %ecx
+	jne	.L1183
+	movl	56(%rbx), %eax
+	cmpl	%eax, 16(%rbx)
+	je	.L1165
+	movl	60(%rbx), %edx
+	testl	%edx, %edx
+	jg	.L1165
+	movl	%r14d, %esi
+	movq	%rbx, %rdi
+	call	pop.part.0
+	jmp	.L1164
+	.p2align 4,,10
+	.p2align 3
+.L1183:
+	movq	8(%rbx), %rax
+	movq	(%rax,%r15), %rdi
+	call	stringSize@PLT
+	movq	40(%rbx), %rcx
+	movl	%eax, %r8d
+	addq	%r12, %rcx
+	movl	(%rcx), %edx
+	subl	%edx, %r8d
+	testl	%r8d, %r8d
+	jle	.L1162
+	addl	$1, %edx
+	movl	%edx, (%rcx)
+.L1163:
+	movq	120(%rbx), %rsi
+	movq	%rbx, %rdi
+	call	paceMLCS
+	jmp	.L1164
+	.p2align 4,,10
+	.p2align 3
+.L1162:
+	movq	48(%rbx), %rdx
+	movl	%eax, (%rcx)
+	movl	%r8d, 12(%rsp)
+	addq	%r15, %rdx
+	movq	(%rdx), %rdi
+	movq	%rdx, (%rsp)
+	call	stringOwn@PLT
+	movq	(%rsp), %rdx
+	movl	12(%rsp), %r8d
+	movl	$1, %esi
+	movq	%rax, (%rdx)
+	movq	48(%rbx), %rax
+	subl	%r8d, %esi
+	movq	(%rax,%r15), %rdi
+	call	stringPopMany@PLT
+	jmp	.L1163
+	.p2align 4,,10
+	.p2align 3
+.L1181:
+	movq	8(%rbx), %rax
+	leaq	0(,%r13,8), %r14
+	movq	(%rax,%r13,8), %rdi
+	call	stringSize@PLT
+	movq	40(%rbx), %rcx
+	movl	%eax, %r15d
+	addq	%r12, %rcx
+	movl	(%rcx), %edx
+	subl	%edx, %r15d
+	cmpl	%r15d, %ebp
+	jg	.L1169
+	addl	%ebp, %edx
+	movl	%edx, (%rcx)
+.L1170:
+	movq	120(%rbx), %rsi
+	movq	%rbx, %rdi
+	call	paceMLCS
+	movq	40(%rbx), %rdx
+	leaq	(%rdx,%r12), %rax
+	jmp	.L1160
+	.p2align 4,,10
+	.p2align 3
+.L1182:
+	testl	%eax, %eax
+	jle	.L1158
+	xorl	%ebp, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L1175:
+	movq	48(%rbx), %rax
+	leaq	0(,%rbp,8), %r13
+	movq	(%rax,%rbp,8), %rdi
+	call	stringSize@PLT
+	movl	%eax, %r12d
+	testl	%eax, %eax
+	jg	.L1184
+	addq	$1, %rbp
+	cmpl	%ebp, (%rbx)
+	jg	.L1175
+.L1158:
+	movl	$1, 36(%rbx)
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1184:
+	.cfi_restore_state
+	movq	48(%rbx), %rax
+	movq	(%rax,%rbp,8), %rdi
+	call	stringGet@PLT
+	movl	%ebp, %esi
+	movl	%r12d, %ecx
+	movq	%rbx, %rdi
+	movq	%rax, %r14
+	movq	%rax, %rdx
+	call	appendRun
+	movq	%r14, %rdi
+	call	free@PLT
+	addq	48(%rbx), %r13
+	movq	0(%r13), %rdi
+	call	stringOwn@PLT
+	movl	%r12d, %esi
+	movq	%rax, 0(%r13)
+	movq	48(%rbx), %rax
+	movq	(%rax,%rbp,8), %rdi
+	addq	$1, %rbp
+	call	stringPopMany@PLT
+	cmpl	%ebp, (%rbx)
+	jg	.L1175
+	jmp	.L1158
+	.p2align 4,,10
+	.p2align 3
+.L1169:
+	addq	48(%rbx), %r14
+	movl	%eax, (%rcx)
+	movq	(%r14), %rdi
+	call	stringOwn@PLT
+	movl	%ebp, %esi
+	movq	%rax, (%r14)
+	movq	48(%rbx), %rax
+	subl	%r15d, %esi
+	movq	(%rax,%r13,8), %rdi
+	call	stringPopMany@PLT
+	jmp	.L1170
+.L1153:
+	movl	$0, 36(%rbx)
+.L1156:
+	movq	%rbx, %rdi
+	call	rebuildMLCS
+	jmp	.L1158
+	.cfi_endproc
+.LFE106:
+	.size	flushMLCS.part.0, .-flushMLCS.part.0
+	.p2align 4
+	.globl	lazyMLCS
+	.type	lazyMLCS, @function
+lazyMLCS:
+.LFB72:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%esi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movl	36(%rdi), %eax
+	testl	%eax, %eax
+	jne	.L1188
+.L1186:
+	movl	%ebp, 36(%rbx)
+	movq	$0, 120(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1188:
+	.cfi_restore_state
+	call	flushMLCS.part.0
+	jmp	.L1186
+	.cfi_endproc
+.LFE72:
+	.size	lazyMLCS, .-lazyMLCS
+	.p2align 4
+	.globl	budgetMLCS
+	.type	budgetMLCS, @function
+budgetMLCS:
+.LFB73:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movl	36(%rdi), %eax
+	testl	%eax, %eax
+	jne	.L1192
+.L1190:
+	xorl	%eax, %eax
+	testq	%rbp, %rbp
+	movq	%rbp, 120(%rbx)
+	setg	%al
+	movl	%eax, 36(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1192:
+	.cfi_restore_state
+	call	flushMLCS.part.0
+	jmp	.L1190
+	.cfi_endproc
+.LFE73:
+	.size	budgetMLCS, .-budgetMLCS
+	.p2align 4
+	.globl	pullString
+	.type	pullString, @function
+pullString:
+.LFB74:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movslq	%esi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movl	36(%rdi), %eax
+	testl	%eax, %eax
+	jne	.L1196
+	movq	8(%rbp), %rax
+	movq	(%rax,%rbx,8), %rax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1196:
+	.cfi_restore_state
+	call	flushMLCS.part.0
+	movq	8(%rbp), %rax
+	movq	(%rax,%rbx,8), %rax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE74:
+	.size	pullString, .-pullString
+	.p2align 4
+	.type	editMLCS, @function
+editMLCS:
+.LFB83:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	movq	%rdi, %r14
+	pushq	%r13
+	pushq	%r12
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	movl	%edx, %r12d
+	pushq	%rbx
+	.cfi_offset 3, -56
+	movslq	%esi, %rbx
+	leaq	0(,%rbx,8), %rax
+	subq	$152, %rsp
+	movq	%rax, -144(%rbp)
+	movq	8(%rdi), %rax
+	movl	%ecx, -80(%rbp)
+	movq	(%rax,%rbx,8), %rdi
+	movl	%r8d, -88(%rbp)
+	movq	%rbx, -96(%rbp)
+	call	stringSize@PLT
+	movq	40(%r14), %rdx
+	leaq	0(,%rbx,4), %rsi
+	movq	%rsi, -112(%rbp)
+	subl	(%rdx,%rbx,4), %eax
+	movl	%eax, %r15d
+	movl	36(%r14), %eax
+	testl	%eax, %eax
+	movl	%eax, -116(%rbp)
+	setne	%r13b
+	cmpl	%r12d, %r15d
+	setle	%al
+	andb	%al, %r13b
+	movb	%r13b, -72(%rbp)
+	jne	.L1299
+	movl	-116(%rbp), %r11d
+	testl	%r11d, %r11d
+	jne	.L1300
+.L1200:
+	movq	8(%r14), %rax
+	movq	-96(%rbp), %rcx
+	movl	$0, 36(%r14)
+	movq	(%rax,%rcx,8), %rbx
+.L1199:
+	movq	%rbx, %rdi
+	xorl	%r13d, %r13d
+	call	stringSize@PLT
+	subl	%r12d, %eax
+	leal	1(%rax), %edi
+	movl	%eax, %r15d
+	movslq	%edi, %rdi
+	call	malloc@PLT
+	movl	-88(%rbp), %edx
+	movq	%rax, -104(%rbp)
+	testb	%dl, %dl
+	je	.L1201
+	movb	%dl, (%rax)
+	movl	$1, %r13d
+.L1201:
+	movq	%rbx, %rdi
+	call	stringBegin@PLT
+	addl	%eax, %r12d
+	movl	-80(%rbp), %eax
+	movl	%r15d, -80(%rbp)
+	movq	-104(%rbp), %r15
+	addl	%eax, %r12d
+	jmp	.L1202
+	.p2align 4,,10
+	.p2align 3
+.L1203:
+	movl	%r12d, %esi
+	movq	%rbx, %rdi
+	addl	$1, %r12d
+	call	stringLetter@PLT
+	movb	%al, (%r15,%r13)
+	addq	$1, %r13
+.L1202:
+	movq	%rbx, %rdi
+	call	stringEnd@PLT
+	cmpl	%r12d, %eax
+	jg	.L1203
+	cmpb	$0, -72(%rbp)
+	movl	-80(%rbp), %r15d
+	movl	%r13d, -128(%rbp)
+	je	.L1204
+	xorl	%r12d, %r12d
+	testl	%r15d, %r15d
+	jle	.L1208
+	.p2align 4,,10
+	.p2align 3
+.L1205:
+	movq	%rbx, %rdi
+	addl	$1, %r12d
+	call	stringPopBack@PLT
+	cmpl	%r12d, %r15d
+	jne	.L1205
+.L1208:
+	movslq	-128(%rbp), %r12
+	movq	-104(%rbp), %rdx
+	movq	%r12, %rax
+	movq	%rdx, %r13
+	addq	%rdx, %r12
+	testl	%eax, %eax
+	je	.L1209
+	.p2align 4,,10
+	.p2align 3
+.L1210:
+	movsbl	0(%r13), %esi
+	movq	%rbx, %rdi
+	addq	$1, %r13
+	call	stringAppend@PLT
+	cmpq	%r12, %r13
+	jne	.L1210
+.L1209:
+	movq	-104(%rbp), %rdi
+	call	free@PLT
+	movl	-116(%rbp), %eax
+	movl	%eax, 36(%r14)
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L1300:
+	.cfi_restore_state
+	movq	%r14, %rdi
+	call	flushMLCS.part.0
+	jmp	.L1200
+.L1299:
+	movq	-144(%rbp), %r13
+	addq	48(%r14), %r13
+	subl	%r15d, %r12d
+	movq	0(%r13), %rdi
+	call	stringOwn@PLT
+	movq	%rax, 0(%r13)
+	movq	%rax, %rbx
+	jmp	.L1199
+.L1204:
+	movq	-144(%rbp), %rbx
+	addq	8(%r14), %rbx
+	movq	%rsp, -136(%rbp)
+	movq	(%rbx), %rdi
+	call	stringOwn@PLT
+	movq	%rax, (%rbx)
+	movq	%rax, %r13
+	testl	%r15d, %r15d
+	jg	.L1301
+.L1212:
+	movslq	(%r14), %r12
+	xorl	%ebx, %ebx
+	movq	%r12, %rdx
+	salq	$2, %r12
+	leaq	15(%r12), %rax
+	shrq	$4, %rax
+	salq	$4, %rax
+	subq	%rax, %rsp
+	movq	%rsp, -72(%rbp)
+	subq	%rax, %rsp
+	movq	%rsp, -80(%rbp)
+	testl	%edx, %edx
+	jle	.L1217
+	movl	%r15d, -88(%rbp)
+	movq	%r14, %r15
+	movq	%rbx, %r14
+	movq	-72(%rbp), %rbx
+	movq	%r13, -152(%rbp)
+	movq	-80(%rbp), %r13
+	.p2align 4,,10
+	.p2align 3
+.L1214:
+	movq	8(%r15), %rax
+	movl	$-1, (%rbx,%r14)
+	movq	(%rax,%r14,2), %rdi
+	call	stringEnd@PLT
+	movl	%eax, 0(%r13,%r14)
+	addq	$4, %r14
+	cmpq	%r14, %r12
+	jne	.L1214
+	movq	%r15, %r14
+	movq	-152(%rbp), %r13
+	movl	-88(%rbp), %r15d
+.L1217:
+	movq	%r13, %rdi
+	call	stringEnd@PLT
+	movq	-72(%rbp), %rdx
+	movq	-96(%rbp), %rcx
+	subl	%r15d, %eax
+	movl	%eax, (%rdx,%rcx,4)
+	testl	%r15d, %r15d
+	jle	.L1302
+	movl	16(%r14), %r8d
+	leaq	-52(%rbp), %rax
+	movl	$8, %r12d
+	movl	$1, %ebx
+	movq	%rax, -88(%rbp)
+	testl	%r8d, %r8d
+	jle	.L1227
+	movl	%r15d, -152(%rbp)
+	movq	%r13, -160(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L1223:
+	movq	24(%r14), %rax
+	movq	-88(%rbp), %rcx
+	xorl	%r15d, %r15d
+	movq	-80(%rbp), %rdx
+	movq	-72(%rbp), %rsi
+	movq	(%rax,%r12), %rdi
+	call	rangeCollect@PLT
+	movl	-52(%rbp), %r10d
+	movq	%rax, %r13
+	testl	%r10d, %r10d
+	jle	.L1303
+	.p2align 4,,10
+	.p2align 3
+.L1218:
+	movq	0(%r13,%r15,8), %rdx
+	movl	%ebx, %esi
+	movq	%r14, %rdi
+	call	frontDelete
+	movq	0(%r13,%r15,8), %rdi
+	addq	$1, %r15
+	call	free@PLT
+	cmpl	%r15d, -52(%rbp)
+	jg	.L1218
+.L1219:
+	movq	%r13, %rdi
+	call	free@PLT
+.L1280:
+	movl	16(%r14), %eax
+	addl	$1, %ebx
+	addq	$8, %r12
+	cmpl	%eax, %ebx
+	jle	.L1223
+	movl	-152(%rbp), %r15d
+	movq	-160(%rbp), %r13
+	testl	%eax, %eax
+	jg	.L1229
+	jmp	.L1227
+	.p2align 4,,10
+	.p2align 3
+.L1231:
+	movl	16(%r14), %eax
+	subl	$1, %eax
+	movl	%eax, 16(%r14)
+	testl	%eax, %eax
+	jle	.L1230
+.L1229:
+	movq	24(%r14), %rdx
+	cltq
+	movq	(%rdx,%rax,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	je	.L1231
+.L1230:
+	testl	%r15d, %r15d
+	jle	.L1228
+.L1227:
+	xorl	%ebx, %ebx
+	.p2align 4,,10
+	.p2align 3
+.L1232:
+	movq	%r13, %rdi
+	addl	$1, %ebx
+	call	stringPopBack@PLT
+	cmpl	%ebx, %r15d
+	jne	.L1232
+.L1228:
+	movq	8(%r14), %rax
+	movq	-96(%rbp), %rdx
+	movl	-128(%rbp), %r9d
+	movq	-136(%rbp), %rsp
+	movq	(%rax,%rdx,8), %r12
+	testl	%r9d, %r9d
+	jne	.L1304
+.L1233:
+	movq	%r14, %rdi
+	call	trimFronts
+	jmp	.L1209
+.L1303:
+	testq	%rax, %rax
+	je	.L1280
+	jmp	.L1219
+.L1301:
+	movq	%rax, %rdi
+	call	stringSize@PLT
+	cmpl	%eax, %r15d
+	jne	.L1212
+	addl	$1, 4(%r14)
+	jmp	.L1212
+.L1304:
+	movq	%r12, %rdi
+	call	stringSize@PLT
+	testl	%eax, %eax
+	jne	.L1234
+	subl	$1, 4(%r14)
+.L1234:
+	movq	-104(%rbp), %rax
+	movslq	-128(%rbp), %rbx
+	movq	%rax, %r13
+	addq	%rax, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L1235:
+	movsbl	0(%r13), %esi
+	movq	%r12, %rdi
+	addq	$1, %r13
+	call	stringAppend@PLT
+	cmpq	%rbx, %r13
+	jne	.L1235
+	movl	4(%r14), %edi
+	testl	%edi, %edi
+	jne	.L1233
+	movq	%r12, %rdi
+	call	stringEnd@PLT
+	movl	-128(%rbp), %ecx
+	movslq	(%r14), %rbx
+	movq	%rsp, -184(%rbp)
+	subl	%ecx, %eax
+	movq	-96(%rbp), %rcx
+	movl	%ebx, -72(%rbp)
+	salq	$2, %rbx
+	movl	%eax, -136(%rbp)
+	movq	8(%r14), %rax
+	movq	(%rax,%rcx,8), %rdi
+	call	stringSigma@PLT
+	movq	%rbx, %rdi
+	addq	$15, %rbx
+	shrq	$4, %rbx
+	movl	%eax, -96(%rbp)
+	call	malloc@PLT
+	movl	16(%r14), %esi
+	movq	$8, -152(%rbp)
+	movq	%rax, -128(%rbp)
+	movq	%rbx, %rax
+	movl	$1, %ebx
+	salq	$4, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %r15
+	subq	%rax, %rsp
+	movq	-112(%rbp), %rax
+	movq	%rsp, %r12
+	addq	%r15, %rax
+	movq	%rax, -176(%rbp)
+	testl	%esi, %esi
+	js	.L1248
+	.p2align 4,,10
+	.p2align 3
+.L1236:
+	cmpl	56(%r14), %ebx
+	jg	.L1248
+	movq	%r14, %rdi
+	call	growPF
+	movq	112(%r14), %rdi
+	call	clearSK@PLT
+	movl	-96(%rbp), %ecx
+	xorl	%r8d, %r8d
+	testl	%ecx, %ecx
+	jle	.L1238
+	movl	%ebx, -160(%rbp)
+	movq	%r14, %rbx
+.L1237:
+	movl	-72(%rbp), %eax
+	leal	65(%r8), %ecx
+	testl	%eax, %eax
+	jg	.L1305
+	movq	-112(%rbp), %rax
+	movl	-136(%rbp), %edx
+	cmpl	(%r12,%rax), %edx
+	jle	.L1306
+.L1242:
+	addl	$1, %r8d
+	cmpl	%r8d, -96(%rbp)
+	jne	.L1237
+.L1294:
+	movq	%rbx, %r14
+	movl	-160(%rbp), %ebx
+.L1238:
+	movl	%ebx, %esi
+	movq	%r14, %rdi
+	call	insertMinima.constprop.0
+	movl	16(%r14), %eax
+	leal	1(%rax), %edx
+	cmpl	%edx, %ebx
+	je	.L1307
+.L1246:
+	addq	$8, -152(%rbp)
+	leal	1(%rbx), %edx
+	cmpl	%eax, %ebx
+	jg	.L1248
+	movl	%edx, %ebx
+	jmp	.L1236
+	.p2align 4,,10
+	.p2align 3
+.L1305:
+	movb	%cl, -80(%rbp)
+	movl	%r8d, %ecx
+.L1241:
+	movl	%ecx, -88(%rbp)
+	xorl	%r13d, %r13d
+	movq	%rbx, %rax
+	movsbl	-80(%rbp), %r14d
+	movq	%r13, %rbx
+	movq	%rax, %r13
+	.p2align 4,,10
+	.p2align 3
+.L1239:
+	movq	8(%r13), %rax
+	movl	$-1, (%r15,%rbx,4)
+	movl	%r14d, %esi
+	movq	(%rax,%rbx,8), %rdi
+	call	stringLast@PLT
+	leal	1(%rbx), %ecx
+	cmpl	%ecx, -72(%rbp)
+	setg	%sil
+	cmpl	$-2, %eax
+	movl	%eax, (%r12,%rbx,4)
+	setne	%cl
+	addq	$1, %rbx
+	testb	%cl, %sil
+	jne	.L1239
+	movl	-88(%rbp), %ecx
+	movq	%r13, %rbx
+	cmpl	$-2, %eax
+	jne	.L1291
+	addl	$1, %ecx
+	cmpl	%ecx, -96(%rbp)
+	je	.L1294
+	leal	65(%rcx), %eax
+	movb	%al, -80(%rbp)
+	jmp	.L1241
+	.p2align 4,,10
+	.p2align 3
+.L1291:
+	movq	-112(%rbp), %rax
+	movl	%ecx, %r8d
+	movl	-136(%rbp), %edx
+	movzbl	-80(%rbp), %ecx
+	cmpl	(%r12,%rax), %edx
+	jg	.L1242
+.L1306:
+	movsbl	%cl, %esi
+	movq	8(%rbx), %rax
+	leal	-1(%rdx), %edx
+	movl	%r8d, -80(%rbp)
+	movq	-144(%rbp), %rcx
+	movl	%esi, -88(%rbp)
+	xorl	%r13d, %r13d
+	movq	(%rax,%rcx), %rdi
+	call	stringFloor@PLT
+	movq	-176(%rbp), %rdx
+	movq	-152(%rbp), %rsi
+	leaq	-52(%rbp), %rcx
+	movl	%eax, (%rdx)
+	movq	24(%rbx), %rax
+	movq	%r12, %rdx
+	movq	-8(%rax,%rsi), %rdi
+	movq	%r15, %rsi
+	call	rangeCollect@PLT
+	movl	-52(%rbp), %edx
+	movl	-80(%rbp), %r8d
+	movq	%rax, %r14
+	testl	%edx, %edx
+	jle	.L1308
+	movl	%r8d, -80(%rbp)
+	movq	%r15, -168(%rbp)
+	movq	%r13, %r15
+	movl	-88(%rbp), %r13d
+	movq	%r12, -88(%rbp)
+	movq	%rbx, %r12
+	movq	-152(%rbp), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L1243:
+	movq	24(%r12), %rcx
+	movq	(%r14,%r15,8), %rdx
+	movq	%r12, %rdi
+	movq	-128(%rbp), %r8
+	movq	(%rcx,%rbx), %rsi
+	movl	%r13d, %ecx
+	call	succCandidate
+	movq	(%r14,%r15,8), %rdi
+	addq	$1, %r15
+	call	free@PLT
+	cmpl	%r15d, -52(%rbp)
+	jg	.L1243
+	movq	%r12, %rbx
+	movl	-80(%rbp), %r8d
+	movq	-168(%rbp), %r15
+	movq	-88(%rbp), %r12
+.L1244:
+	movq	%r14, %rdi
+	movl	%r8d, -80(%rbp)
+	call	free@PLT
+	movl	-80(%rbp), %r8d
+	jmp	.L1242
+.L1307:
+	movq	24(%r14), %rax
+	movq	-152(%rbp), %rcx
+	movq	(%rax,%rcx), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	movl	16(%r14), %eax
+	jle	.L1246
+	addl	$1, %eax
+	movl	%eax, 16(%r14)
+	jmp	.L1246
+.L1248:
+	movq	-128(%rbp), %rdi
+	call	free@PLT
+	movq	-184(%rbp), %rsp
+	jmp	.L1233
+.L1308:
+	testq	%rax, %rax
+	je	.L1242
+	jmp	.L1244
+.L1302:
+	movl	16(%r14), %eax
+	testl	%eax, %eax
+	jg	.L1229
+	jmp	.L1228
+	.cfi_endproc
+.LFE83:
+	.size	editMLCS, .-editMLCS
+	.p2align 4
+	.globl	popMany
+	.type	popMany, @function
+popMany:
+.LFB78:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movl	36(%rdi), %eax
+	movq	%rdi, %rbx
+	testl	%eax, %eax
+	jne	.L1314
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	popMany.part.0
+	.p2align 4,,10
+	.p2align 3
+.L1314:
+	.cfi_restore_state
+	movq	8(%rdi), %rax
+	movslq	%esi, %rbp
+	leaq	0(,%rbp,8), %r13
+	movq	(%rax,%rbp,8), %rdi
+	call	stringSize@PLT
+	movq	40(%rbx), %rdx
+	movl	%eax, %r14d
+	leaq	(%rdx,%rbp,4), %rcx
+	movl	(%rcx), %edx
+	subl	%edx, %r14d
+	cmpl	%r14d, %r12d
+	jg	.L1311
+	addl	%r12d, %edx
+	movl	%edx, (%rcx)
+.L1312:
+	movq	120(%rbx), %rsi
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	paceMLCS
+	.p2align 4,,10
+	.p2align 3
+.L1311:
+	.cfi_restore_state
+	addq	48(%rbx), %r13
+	movl	%eax, (%rcx)
+	movq	0(%r13), %rdi
+	call	stringOwn@PLT
+	movl	%r12d, %esi
+	movq	%rax, 0(%r13)
+	movq	48(%rbx), %rax
+	subl	%r14d, %esi
+	movq	(%rax,%rbp,8), %rdi
+	call	stringPopMany@PLT
+	jmp	.L1312
+	.cfi_endproc
+.LFE78:
+	.size	popMany, .-popMany
+	.p2align 4
+	.globl	shift
+	.type	shift, @function
+shift:
+.LFB77:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movsbl	%dl, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movslq	%esi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movl	36(%rdi), %ecx
+	testl	%ecx, %ecx
+	jne	.L1330
+	movl	56(%rdi), %eax
+	cmpl	%eax, 16(%rdi)
+	je	.L1319
+	movl	60(%rdi), %edx
+	testl	%edx, %edx
+	jle	.L1320
+.L1319:
+	movl	%ebp, %esi
+	movq	%rbx, %rdi
+	movl	$1, %edx
+	call	popMany
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%r12d, %edx
+	movl	%ebp, %esi
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	append
+	.p2align 4,,10
+	.p2align 3
+.L1320:
+	.cfi_restore_state
+	movq	8(%rdi), %rax
+	movslq	%ebp, %r14
+	leaq	(%rax,%r14,8), %r15
+	movq	(%r15), %rdi
+	call	stringOwn@PLT
+	movq	%rax, (%r15)
+	movq	%rax, %r13
+	movl	4(%rbx), %eax
+	testl	%eax, %eax
+	je	.L1321
+.L1329:
+	movl	%r12d, %esi
+	movq	%r13, %rdi
+	call	stringShift@PLT
+.L1322:
+	addl	$1, 76(%rbx)
+.L1326:
+	movq	8(%rbx), %rax
+	movq	(%rax,%r14,8), %rdi
+	call	stringBegin@PLT
+	cmpl	$1073741823, %eax
+	jg	.L1331
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1330:
+	.cfi_restore_state
+	movq	8(%rdi), %rax
+	leaq	0(,%rbp,8), %r13
+	movq	(%rax,%rbp,8), %rdi
+	call	stringSize@PLT
+	movq	40(%rbx), %rdx
+	movl	%eax, %r14d
+	leaq	(%rdx,%rbp,4), %rcx
+	movl	(%rcx), %edx
+	subl	%edx, %r14d
+	testl	%r14d, %r14d
+	jle	.L1317
+	addl	$1, %edx
+	movl	%edx, (%rcx)
+.L1318:
+	addq	48(%rbx), %r13
+	movq	0(%r13), %rdi
+	call	stringOwn@PLT
+	movl	%r12d, %esi
+	movq	%rax, 0(%r13)
+	movq	48(%rbx), %rax
+	movq	(%rax,%rbp,8), %rdi
+	call	stringAppend@PLT
+	movq	120(%rbx), %rsi
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	paceMLCS
+	.p2align 4,,10
+	.p2align 3
+.L1321:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	call	growPF
+	movq	%rbx, %rdi
+	call	rebuildWork
+	movl	%ebp, %esi
+	movl	%r12d, %edx
+	movq	%rbx, %rdi
+	movq	%rax, %rcx
+	call	repairStart
+	movq	%rbx, %rdi
+	movabsq	$9223372036854775807, %rdx
+	movq	%rax, %rbp
+	movq	%rax, %rsi
+	call	repairRun
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	repairEnd
+	testl	%eax, %eax
+	jne	.L1332
+	movq	%r13, %rdi
+	movl	%r12d, %esi
+	call	stringShift@PLT
+	addl	$1, 80(%rbx)
+	movq	%rbx, %rdi
+	call	rebuildMLCS
+	jmp	.L1326
+	.p2align 4,,10
+	.p2align 3
+.L1317:
+	movq	48(%rbx), %r15
+	movl	%eax, (%rcx)
+	addq	%r13, %r15
+	movq	(%r15), %rdi
+	call	stringOwn@PLT
+	movl	$1, %esi
+	movq	%rax, (%r15)
+	movq	48(%rbx), %rax
+	subl	%r14d, %esi
+	movq	(%rax,%rbp,8), %rdi
+	call	stringPopMany@PLT
+	jmp	.L1318
+	.p2align 4,,10
+	.p2align 3
+.L1331:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	rebaseMLCS
+	.p2align 4,,10
+	.p2align 3
+.L1332:
+	.cfi_restore_state
+	movslq	16(%rbx), %rdx
+	movq	24(%rbx), %rax
+	movq	8(%rax,%rdx,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	jle	.L1324
+	addl	$1, 16(%rbx)
+	movl	%r12d, %esi
+	movq	%r13, %rdi
+	call	stringShift@PLT
+	jmp	.L1322
+.L1324:
+	movslq	16(%rbx), %rdx
+	movq	24(%rbx), %rax
+	movq	(%rax,%rdx,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	jne	.L1329
+	subl	$1, 16(%rbx)
+	jmp	.L1329
+	.cfi_endproc
+.LFE77:
+	.size	shift, .-shift
+	.p2align 4
+	.globl	prepend
+	.type	prepend, @function
+prepend:
+.LFB79:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movslq	%esi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rbp, %r12
+	movl	%edx, %ebx
+	leaq	0(,%rbp,8), %r13
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	movl	36(%rdi), %eax
+	movl	%eax, 36(%rsp)
+	testl	%eax, %eax
+	jne	.L1383
+.L1334:
+	movl	$0, 36(%rsp)
+.L1340:
+	movq	8(%r14), %rax
+	movl	$0, 36(%r14)
+	movsbl	%bl, %ebx
+	movq	(%rax,%rbp,8), %rdi
+	call	stringSize@PLT
+	testl	%eax, %eax
+	je	.L1384
+	movq	8(%r14), %rax
+	movq	(%rax,%rbp,8), %rdi
+	call	stringBegin@PLT
+	testl	%eax, %eax
+	je	.L1385
+.L1343:
+	addq	8(%r14), %r13
+	movq	0(%r13), %rdi
+	call	stringOwn@PLT
+	movl	%ebx, %esi
+	movq	%rax, 0(%r13)
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	stringPrepend@PLT
+	movl	4(%r14), %eax
+	testl	%eax, %eax
+	je	.L1386
+.L1342:
+	movl	36(%rsp), %eax
+	movq	%r14, %rdi
+	movl	%eax, 36(%r14)
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	trimFronts
+.L1384:
+	.cfi_restore_state
+	movl	%ebx, %edx
+	movl	%r12d, %esi
+	movq	%r14, %rdi
+	call	append
+	jmp	.L1342
+.L1383:
+	movq	40(%rdi), %rax
+	leaq	0(,%rbp,4), %r15
+	movl	(%rax,%rbp,4), %eax
+	testl	%eax, %eax
+	jle	.L1335
+	movq	128(%rdi), %rdx
+	testq	%rdx, %rdx
+	je	.L1336
+	cmpl	%ebp, (%rdx)
+	jne	.L1336
+	cmpl	$1, %eax
+	je	.L1335
+.L1336:
+	movq	8(%r14), %rax
+	movq	(%rax,%rbp,8), %rdi
+	call	stringBegin@PLT
+	movq	40(%r14), %rdx
+	addl	(%rdx,%rbp,4), %eax
+	movl	%eax, %esi
+	movq	8(%r14), %rax
+	subl	$1, %esi
+	movq	(%rax,%rbp,8), %rdi
+	call	stringLetter@PLT
+	cmpb	%bl, %al
+	je	.L1387
+	movl	36(%r14), %eax
+	movl	%eax, 36(%rsp)
+	testl	%eax, %eax
+	je	.L1334
+.L1335:
+	movq	%r14, %rdi
+	call	flushMLCS.part.0
+	jmp	.L1340
+.L1386:
+	movq	%rbp, %rdi
+	movl	(%r14), %r12d
+	call	stringSigma@PLT
+	movl	%eax, %ebp
+	movslq	%r12d, %rax
+	leaq	0(,%rax,4), %r13
+	movq	%r13, %rdi
+	call	malloc@PLT
+	movq	%r13, %rdi
+	movq	%rax, 8(%rsp)
+	call	malloc@PLT
+	movq	%rax, 40(%rsp)
+	testl	%r12d, %r12d
+	jle	.L1346
+	movl	%r12d, %edx
+	movq	%rax, %rdi
+	movl	$255, %esi
+	salq	$2, %rdx
+	call	memset@PLT
+.L1346:
+	call	allocPQ@PLT
+	movq	%r14, %rdi
+	movl	$16, %r12d
+	movq	%rax, 16(%rsp)
+	call	growPF
+	movq	112(%r14), %rdi
+	call	clearSK@PLT
+	movq	24(%r14), %rax
+	movq	8(%rsp), %r8
+	movl	%ebx, %ecx
+	movq	40(%rsp), %rdx
+	movq	%r14, %rdi
+	movl	$1, %ebx
+	movq	8(%rax), %rsi
+	call	succCandidate
+	movq	112(%r14), %rdi
+	call	sizeSK@PLT
+	testl	%eax, %eax
+	jle	.L1388
+	.p2align 4,,10
+	.p2align 3
+.L1361:
+	movq	112(%r14), %rdi
+	movslq	(%r14), %r15
+	call	minimaSK@PLT
+	movl	%eax, 32(%rsp)
+	testl	%eax, %eax
+	jle	.L1354
+	cmpq	$0, 16(%rsp)
+	je	.L1389
+	leaq	0(,%r15,4), %rax
+	xorl	%r15d, %r15d
+	movq	%rax, 24(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1353:
+	movq	112(%r14), %rdi
+	movl	%r15d, %esi
+	call	pointSK@PLT
+	movl	%ebx, %esi
+	movq	%r14, %rdi
+	movq	%rax, %rdx
+	call	frontInsert
+	movq	24(%rsp), %rdi
+	call	malloc@PLT
+	movq	112(%r14), %rdi
+	movl	%r15d, %esi
+	addl	$1, %r15d
+	movq	%rax, %r13
+	call	pointSK@PLT
+	movq	24(%rsp), %rdx
+	movq	%r13, %rdi
+	movq	%rax, %rsi
+	call	memcpy@PLT
+	movq	16(%rsp), %rdi
+	movq	%r13, %rsi
+	call	pushPQ@PLT
+	cmpl	%r15d, 32(%rsp)
+	jne	.L1353
+.L1354:
+	movl	16(%r14), %eax
+	addl	$1, %eax
+	cmpl	%ebx, %eax
+	jne	.L1349
+	movl	%ebx, 16(%r14)
+.L1349:
+	movq	%r14, %rdi
+	call	growPF
+	movq	112(%r14), %rdi
+	call	clearSK@PLT
+	.p2align 4,,10
+	.p2align 3
+.L1355:
+	movq	16(%rsp), %rdi
+	call	isEmptyPQ@PLT
+	movl	%eax, %r13d
+	testl	%eax, %eax
+	jne	.L1390
+	movq	16(%rsp), %rdi
+	call	topPQ@PLT
+	movl	%ebx, %esi
+	movq	%r14, %rdi
+	movq	%rax, %rdx
+	movq	%rax, %r15
+	call	removeCovered
+	cmpl	56(%r14), %ebx
+	jge	.L1359
+	testl	%ebp, %ebp
+	jg	.L1356
+	jmp	.L1359
+	.p2align 4,,10
+	.p2align 3
+.L1391:
+	cmpl	%r13d, %ebp
+	jle	.L1359
+.L1356:
+	movq	24(%r14), %rax
+	leal	65(%r13), %ecx
+	movq	8(%rsp), %r8
+	movq	%r15, %rdx
+	movsbl	%cl, %ecx
+	movq	%r14, %rdi
+	addl	$1, %r13d
+	movq	(%rax,%r12), %rsi
+	call	succCandidate
+	cmpl	%ebx, 56(%r14)
+	jg	.L1391
+.L1359:
+	movq	%r15, %rdi
+	call	free@PLT
+	movq	16(%rsp), %rdi
+	call	popPQ@PLT
+	jmp	.L1355
+	.p2align 4,,10
+	.p2align 3
+.L1390:
+	movq	112(%r14), %rdi
+	addl	$1, %ebx
+	addq	$8, %r12
+	call	sizeSK@PLT
+	testl	%eax, %eax
+	jg	.L1361
+.L1388:
+	movq	16(%rsp), %rdi
+	call	freePQ@PLT
+	movq	40(%rsp), %rdi
+	call	free@PLT
+	movq	8(%rsp), %rdi
+	call	free@PLT
+	jmp	.L1342
+.L1389:
+	xorl	%r15d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L1351:
+	movq	112(%r14), %rdi
+	movl	%r15d, %esi
+	addl	$1, %r15d
+	call	pointSK@PLT
+	movl	%ebx, %esi
+	movq	%r14, %rdi
+	movq	%rax, %rdx
+	call	frontInsert
+	cmpl	%r15d, 32(%rsp)
+	jne	.L1351
+	jmp	.L1354
+.L1385:
+	movq	%r14, %rdi
+	call	rebuildMLCS
+	jmp	.L1343
+.L1387:
+	addq	40(%r14), %r15
+	subl	$1, (%r15)
+	addq	$56, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE79:
+	.size	prepend, .-prepend
+	.p2align 4
+	.globl	popBack
+	.type	popBack, @function
+popBack:
+.LFB81:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	movq	%rdi, %r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movslq	%esi, %rbx
+	leaq	0(,%rbx,8), %r12
+	subq	$104, %rsp
+	movl	36(%rdi), %r15d
+	testl	%r15d, %r15d
+	jne	.L1441
+.L1393:
+	addq	8(%r13), %r12
+	movl	$0, 36(%r13)
+	movq	(%r12), %rdi
+	movq	%rsp, -136(%rbp)
+	call	stringOwn@PLT
+	movq	%rax, (%r12)
+	movq	%rax, %rdi
+	movq	%rax, -128(%rbp)
+	call	stringSize@PLT
+	cmpl	$1, %eax
+	jne	.L1398
+	addl	$1, 4(%r13)
+.L1398:
+	movslq	0(%r13), %r14
+	xorl	%r12d, %r12d
+	movq	%r14, %rdx
+	salq	$2, %r14
+	leaq	15(%r14), %rax
+	shrq	$4, %rax
+	salq	$4, %rax
+	subq	%rax, %rsp
+	movq	%rsp, -104(%rbp)
+	subq	%rax, %rsp
+	movq	%rsp, -112(%rbp)
+	testl	%edx, %edx
+	jle	.L1402
+	movl	%r15d, -72(%rbp)
+	movq	%r13, %r15
+	movq	%r12, %r13
+	movq	-104(%rbp), %r12
+	movq	%rbx, -80(%rbp)
+	movq	-112(%rbp), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L1399:
+	movq	8(%r15), %rax
+	movl	$-1, (%r12,%r13)
+	movq	(%rax,%r13,2), %rdi
+	call	stringEnd@PLT
+	movl	%eax, (%rbx,%r13)
+	addq	$4, %r13
+	cmpq	%r13, %r14
+	jne	.L1399
+	movq	%r15, %r13
+	movq	-80(%rbp), %rbx
+	movl	-72(%rbp), %r15d
+.L1402:
+	movq	-128(%rbp), %rdi
+	movl	$8, %r12d
+	call	stringEnd@PLT
+	movq	-104(%rbp), %rsi
+	movl	16(%r13), %edx
+	movl	$-1, -92(%rbp)
+	subl	$1, %eax
+	movl	%eax, (%rsi,%rbx,4)
+	leaq	-52(%rbp), %rax
+	movq	%rax, -120(%rbp)
+	testl	%edx, %edx
+	jle	.L1401
+	movl	%r15d, -140(%rbp)
+	movl	-92(%rbp), %eax
+	movq	%r13, %r14
+	movq	%r12, -80(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L1400:
+	negl	%eax
+	movq	-80(%rbp), %rbx
+	movq	-120(%rbp), %rcx
+	xorl	%r13d, %r13d
+	movq	-112(%rbp), %rdx
+	movq	-104(%rbp), %rsi
+	movl	%eax, -96(%rbp)
+	movq	24(%r14), %rax
+	movq	(%rax,%rbx), %rdi
+	call	rangeCollect@PLT
+	movq	%rax, %rbx
+	movl	-52(%rbp), %eax
+	testl	%eax, %eax
+	jle	.L1442
+	movq	%r14, %rax
+	movq	%r13, %r14
+	movq	%rax, %r13
+	jmp	.L1403
+	.p2align 4,,10
+	.p2align 3
+.L1444:
+	movl	0(%r13), %eax
+	movq	%rsp, -88(%rbp)
+	movq	%r12, %rsi
+	leal	1(%rax), %r15d
+	movslq	%r15d, %r15
+	salq	$2, %r15
+	leaq	15(%r15), %rax
+	leaq	-4(%r15), %rdx
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %rdi
+	call	memcpy@PLT
+	movq	%rax, %rdi
+	movl	-92(%rbp), %eax
+	movq	%rdi, %rsi
+	movl	%eax, -4(%rdi,%r15)
+	movq	-72(%rbp), %rdi
+	call	delete@PLT
+	movq	24(%r13), %rax
+	movq	-80(%rbp), %rdx
+	movq	-88(%rbp), %rsp
+	movq	(%rax,%rdx), %rdi
+.L1439:
+	movq	%r12, %rsi
+	call	delete@PLT
+	movq	(%rbx,%r14,8), %rdi
+	addq	$1, %r14
+	call	free@PLT
+	cmpl	%r14d, -52(%rbp)
+	jle	.L1443
+.L1403:
+	movq	88(%r13), %rax
+	movq	(%rbx,%r14,8), %r12
+	testq	%rax, %rax
+	je	.L1406
+	movl	0(%r13), %ecx
+	movl	-96(%rbp), %esi
+	movl	$-1, %r8d
+	movq	%r12, %rdx
+	movq	96(%r13), %rdi
+	call	*%rax
+.L1406:
+	movq	104(%r13), %rcx
+	testq	%rcx, %rcx
+	movq	%rcx, -72(%rbp)
+	jne	.L1444
+	movq	24(%r13), %rax
+	movq	-80(%rbp), %rsi
+	movq	(%rax,%rsi), %rdi
+	jmp	.L1439
+	.p2align 4,,10
+	.p2align 3
+.L1443:
+	movq	%r13, %r14
+.L1404:
+	movq	%rbx, %rdi
+	call	free@PLT
+.L1427:
+	movl	-92(%rbp), %ebx
+	movl	$1, %ecx
+	movl	16(%r14), %eax
+	addq	$8, -80(%rbp)
+	subl	%ebx, %ecx
+	leal	-1(%rbx), %edx
+	cmpl	%ecx, %eax
+	jl	.L1431
+	movl	%edx, -92(%rbp)
+	movl	%edx, %eax
+	jmp	.L1400
+	.p2align 4,,10
+	.p2align 3
+.L1442:
+	testq	%rbx, %rbx
+	je	.L1427
+	jmp	.L1404
+.L1431:
+	movl	-140(%rbp), %r15d
+	movq	%r14, %r13
+	jmp	.L1436
+	.p2align 4,,10
+	.p2align 3
+.L1412:
+	movl	16(%r13), %eax
+	subl	$1, %eax
+	movl	%eax, 16(%r13)
+.L1436:
+	testl	%eax, %eax
+	jle	.L1401
+	movq	24(%r13), %rdx
+	cltq
+	movq	(%rdx,%rax,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	je	.L1412
+.L1401:
+	movq	-128(%rbp), %rdi
+	call	stringPopBack@PLT
+	movl	%r15d, 36(%r13)
+	movq	-136(%rbp), %rsp
+.L1392:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L1441:
+	.cfi_restore_state
+	movq	48(%rdi), %rax
+	movq	(%rax,%rbx,8), %rdi
+	call	stringSize@PLT
+	testl	%eax, %eax
+	jg	.L1445
+	movl	36(%r13), %r15d
+	testl	%r15d, %r15d
+	je	.L1393
+	movq	%r13, %rdi
+	call	flushMLCS.part.0
+	jmp	.L1393
+.L1445:
+	addq	48(%r13), %r12
+	movq	(%r12), %rdi
+	call	stringOwn@PLT
+	movq	%rax, (%r12)
+	movq	48(%r13), %rax
+	movq	(%rax,%rbx,8), %rdi
+	call	stringPopBack@PLT
+	jmp	.L1392
+	.cfi_endproc
+.LFE81:
+	.size	popBack, .-popBack
+	.p2align 4
+	.globl	editInsert
+	.type	editInsert, @function
+editInsert:
+.LFB84:
+	.cfi_startproc
+	movsbl	%cl, %r8d
+	xorl	%ecx, %ecx
+	jmp	editMLCS
+	.cfi_endproc
+.LFE84:
+	.size	editInsert, .-editInsert
+	.p2align 4
+	.globl	editDelete
+	.type	editDelete, @function
+editDelete:
+.LFB85:
+	.cfi_startproc
+	xorl	%r8d, %r8d
+	movl	$1, %ecx
+	jmp	editMLCS
+	.cfi_endproc
+.LFE85:
+	.size	editDelete, .-editDelete
+	.p2align 4
+	.globl	editSubstitute
+	.type	editSubstitute, @function
+editSubstitute:
+.LFB86:
+	.cfi_startproc
+	movsbl	%cl, %r8d
+	movl	$1, %ecx
+	jmp	editMLCS
+	.cfi_endproc
+.LFE86:
+	.size	editSubstitute, .-editSubstitute
+	.p2align 4
+	.globl	addString
+	.type	addString, @function
+addString:
+.LFB88:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movl	(%rdi), %eax
+	leal	1(%rax), %r13d
+	movq	8(%rdi), %rax
+	movq	(%rax), %rdi
+	call	stringSigma@PLT
+	movq	128(%rbx), %rsi
+	movl	%eax, %r15d
+	testq	%rsi, %rsi
+	je	.L1450
+	movabsq	$9223372036854775807, %rdx
+	movq	%rbx, %rdi
+	call	repairRun
+	movq	128(%rbx), %rsi
+	movq	%rbx, %rdi
+	movslq	(%rsi), %r12
+	movq	$0, 128(%rbx)
+	call	repairEnd
+	movslq	16(%rbx), %rdx
+	movq	24(%rbx), %rax
+	movq	(%rax,%rdx,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	je	.L1462
+.L1451:
+	movq	8(%rbx), %rax
+	movq	(%rax,%r12,8), %rdi
+	call	stringPop@PLT
+	movq	40(%rbx), %rax
+	subl	$1, (%rax,%r12,4)
+	addl	$1, 76(%rbx)
+.L1450:
+	movslq	%r13d, %r14
+	movq	8(%rbx), %rdi
+	leaq	0(,%r14,8), %r12
+	salq	$2, %r14
+	movq	%r12, %rsi
+	call	realloc@PLT
+	movq	48(%rbx), %rdi
+	movq	%r12, %rsi
+	subq	$8, %r12
+	movq	%rax, 8(%rbx)
+	call	realloc@PLT
+	movq	40(%rbx), %rdi
+	movq	%r14, %rsi
+	movq	%rax, 48(%rbx)
+	call	realloc@PLT
+	movq	8(%rbx), %rdx
+	movl	%r15d, %edi
+	movq	%rax, 40(%rbx)
+	addq	%r12, %rdx
+	movq	%rdx, 8(%rsp)
+	call	stringAlloc@PLT
+	movq	8(%rsp), %rdx
+	movl	%r15d, %edi
+	movq	%rax, (%rdx)
+	movq	48(%rbx), %rdx
+	addq	%r12, %rdx
+	movq	%rdx, 8(%rsp)
+	call	stringAlloc@PLT
+	movq	8(%rsp), %rdx
+	movq	%rax, (%rdx)
+	movq	40(%rbx), %rax
+	movl	$0, -4(%rax,%r14)
+	movsbl	0(%rbp), %esi
+	testb	%sil, %sil
+	je	.L1452
+	addq	$1, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L1453:
+	movq	48(%rbx), %rax
+	addq	$1, %rbp
+	movq	(%rax,%r12), %rdi
+	call	stringAppend@PLT
+	movsbl	-1(%rbp), %esi
+	testb	%sil, %sil
+	jne	.L1453
+.L1452:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%r13d, %esi
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	resizeMLCS
+	.p2align 4,,10
+	.p2align 3
+.L1462:
+	.cfi_restore_state
+	subl	$1, 16(%rbx)
+	jmp	.L1451
+	.cfi_endproc
+.LFE88:
+	.size	addString, .-addString
+	.p2align 4
+	.globl	removeString
+	.type	removeString, @function
+removeString:
+.LFB89:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movl	%esi, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	movl	(%rdi), %r15d
+	movq	128(%rdi), %rsi
+	leal	-1(%r15), %r13d
+	testq	%rsi, %rsi
+	je	.L1464
+	movabsq	$9223372036854775807, %rdx
+	call	repairRun
+	movq	128(%rbx), %rsi
+	movq	%rbx, %rdi
+	movslq	(%rsi), %rbp
+	movq	$0, 128(%rbx)
+	call	repairEnd
+	movslq	16(%rbx), %rdx
+	movq	24(%rbx), %rax
+	movq	(%rax,%rdx,8), %rdi
+	call	weightORT@PLT
+	testl	%eax, %eax
+	je	.L1481
+.L1465:
+	movq	8(%rbx), %rax
+	movq	(%rax,%rbp,8), %rdi
+	call	stringPop@PLT
+	movq	40(%rbx), %rax
+	subl	$1, (%rax,%rbp,4)
+	addl	$1, 76(%rbx)
+.L1464:
+	movq	8(%rbx), %rax
+	movslq	%r14d, %rbp
+	leaq	0(,%rbp,8), %rsi
+	movq	(%rax,%rbp,8), %rdi
+	movq	%rsi, 8(%rsp)
+	call	stringFree@PLT
+	movq	48(%rbx), %rax
+	movq	(%rax,%rbp,8), %rdi
+	call	stringFree@PLT
+	cmpl	%r14d, %r13d
+	jle	.L1466
+	subl	%r14d, %r15d
+	movq	8(%rbx), %rcx
+	movq	40(%rbx), %r8
+	leaq	0(,%rbp,4), %rsi
+	leal	-2(%r15), %eax
+	movq	%rsi, 24(%rsp)
+	movq	48(%rbx), %r12
+	leaq	2(%rax,%rbp), %rdx
+	addq	%r8, %rsi
+	salq	$3, %rdx
+	movq	%rsi, (%rsp)
+	movq	8(%rsp), %rsi
+	leaq	(%rcx,%rdx), %rdi
+	addq	%r12, %rdx
+	movq	%rdi, 16(%rsp)
+	leaq	1(%rbp), %rdi
+	leaq	8(%rsi), %r15
+	leaq	(%rdi,%rax), %r11
+	leaq	(%rcx,%rsi), %r9
+	movq	%rdi, 40(%rsp)
+	leaq	(%r8,%r11,4), %r10
+	leaq	(%rcx,%r15), %rdi
+	salq	$3, %r11
+	movq	%r15, 32(%rsp)
+	cmpq	%r10, %r9
+	movq	%rdi, 8(%rsp)
+	movq	16(%rsp), %rdi
+	leaq	(%r12,%rsi), %r14
+	setnb	%r15b
+	cmpq	%rdi, (%rsp)
+	setnb	%sil
+	orl	%esi, %r15d
+	cmpq	%rdx, (%rsp)
+	setnb	%sil
+	cmpq	%r10, %r14
+	setnb	%r10b
+	orl	%r10d, %esi
+	leaq	(%rcx,%r11), %r10
+	andl	%r15d, %esi
+	cmpq	%r10, %r14
+	setnb	%r10b
+	cmpq	%rdx, %r9
+	setnb	%dl
+	orl	%edx, %r10d
+	testb	%r10b, %sil
+	je	.L1478
+	movq	8(%rsp), %r10
+	leaq	(%r12,%r11), %rdx
+	cmpq	%rdx, %r10
+	setnb	%dl
+	cmpq	%rdi, %r14
+	setnb	%sil
+	orb	%dl, %sil
+	je	.L1478
+	leaq	1(%rax), %rbp
+	movq	%r10, %rsi
+	movq	%r9, %rdi
+	movq	%r8, 8(%rsp)
+	leaq	0(,%rbp,8), %r15
+	movq	%r15, %rdx
+	call	memmove@PLT
+	movq	24(%rsp), %rax
+	movq	8(%rsp), %r8
+	leaq	0(,%rbp,4), %rdx
+	movq	(%rsp), %rdi
+	leaq	4(%r8,%rax), %rsi
+	call	memmove@PLT
+	movq	32(%rsp), %rsi
+	movq	%r15, %rdx
+	movq	%r14, %rdi
+	addq	%r12, %rsi
+	call	memmove@PLT
+.L1466:
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%r13d, %esi
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	resizeMLCS
+	.p2align 4,,10
+	.p2align 3
+.L1481:
+	.cfi_restore_state
+	subl	$1, 16(%rbx)
+	jmp	.L1465
+.L1478:
+	movq	40(%rsp), %rdi
+	jmp	.L1473
+	.p2align 4,,10
+	.p2align 3
+.L1482:
+	addq	$1, %rdi
+.L1473:
+	movq	8(%rcx,%rbp,8), %rax
+	movq	%rax, (%rcx,%rbp,8)
+	movq	8(%r12,%rbp,8), %rax
+	movq	%rax, (%r12,%rbp,8)
+	movl	4(%r8,%rbp,4), %eax
+	movl	%eax, (%r8,%rbp,4)
+	movq	%rdi, %rbp
+	cmpl	%edi, %r13d
+	jg	.L1482
+	jmp	.L1466
+	.cfi_endproc
+.LFE89:
+	.size	removeString, .-removeString
+	.p2align 4
+	.globl	mlcsSize
+	.type	mlcsSize, @function
+mlcsSize:
+.LFB90:
+	.cfi_startproc
+	movl	36(%rdi), %eax
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	testl	%eax, %eax
+	jne	.L1486
+	movl	16(%rbx), %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1486:
+	.cfi_restore_state
+	call	flushMLCS.part.0
+	movl	16(%rbx), %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE90:
+	.size	mlcsSize, .-mlcsSize
+	.p2align 4
+	.globl	reachesThreshold
+	.type	reachesThreshold, @function
+reachesThreshold:
+.LFB91:
+	.cfi_startproc
+	movl	36(%rdi), %eax
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	testl	%eax, %eax
+	jne	.L1490
+	movl	56(%rbx), %eax
+	cmpl	%eax, 16(%rbx)
+	sete	%al
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	movzbl	%al, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1490:
+	.cfi_restore_state
+	call	flushMLCS.part.0
+	movl	56(%rbx), %eax
+	cmpl	%eax, 16(%rbx)
+	sete	%al
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	movzbl	%al, %eax
+	ret
+	.cfi_endproc
+.LFE91:
+	.size	reachesThreshold, .-reachesThreshold
+	.p2align 4
+	.globl	mlcsPrefix
+	.type	mlcsPrefix, @function
+mlcsPrefix:
+.LFB92:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_offset 13, -40
+	movq	%rsi, %r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$24, %rsp
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movslq	(%rdi), %rdx
+	movq	%rdx, %rax
+	leaq	15(,%rdx,4), %rdx
+	andq	$-16, %rdx
+	subq	%rdx, %rsp
+	movl	36(%rdi), %edx
+	movq	%rsp, %r12
+	testl	%edx, %edx
+	jne	.L1503
+.L1492:
+	testl	%eax, %eax
+	jle	.L1493
+	xorl	%ebx, %ebx
+	.p2align 4,,10
+	.p2align 3
+.L1494:
+	movq	8(%r14), %rax
+	movq	(%rax,%rbx,8), %rdi
+	call	stringBegin@PLT
+	addl	0(%r13,%rbx,4), %eax
+	addl	$1, %eax
+	movl	%eax, (%r12,%rbx,4)
+	movslq	(%r14), %rax
+	addq	$1, %rbx
+	cmpl	%ebx, %eax
+	jg	.L1494
+.L1493:
+	movl	16(%r14), %ecx
+	leaq	15(,%rax,4), %rax
+	xorl	%r15d, %r15d
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	leal	1(%rcx), %r13d
+	movq	%rsp, -56(%rbp)
+	cmpl	$1, %r13d
+	jle	.L1491
+	.p2align 4,,10
+	.p2align 3
+.L1498:
+	leal	(%r15,%r13), %ebx
+	movq	24(%r14), %rax
+	movq	%r12, %rsi
+	sarl	%ebx
+	movslq	%ebx, %rdx
+	movq	(%rax,%rdx,8), %rdi
+	movq	-56(%rbp), %rdx
+	call	dominatedFind@PLT
+	testl	%eax, %eax
+	je	.L1496
+	leal	1(%rbx), %eax
+	movl	%ebx, %r15d
+	cmpl	%eax, %r13d
+	jg	.L1498
+.L1491:
+	leaq	-40(%rbp), %rsp
+	movl	%r15d, %eax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1496:
+	.cfi_restore_state
+	leal	1(%r15), %eax
+	cmpl	%eax, %ebx
+	jle	.L1491
+	movl	%ebx, %r13d
+	jmp	.L1498
+	.p2align 4,,10
+	.p2align 3
+.L1503:
+	call	flushMLCS.part.0
+	movslq	(%r14), %rax
+	jmp	.L1492
+	.cfi_endproc
+.LFE92:
+	.size	mlcsPrefix, .-mlcsPrefix
+	.p2align 4
+	.globl	mlcsPrefixBatch
+	.type	mlcsPrefixBatch, @function
+mlcsPrefixBatch:
+.LFB93:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdx, %r8
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.cfi_offset 15, -24
+	movq	%rdi, %r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movl	%esi, %ebx
+	subq	$88, %rsp
+	movslq	(%rdi), %rax
+	movl	36(%rdi), %edx
+	movq	%rcx, -96(%rbp)
+	leaq	0(,%rax,4), %rsi
+	movq	%rax, %r9
+	leaq	15(%rsi), %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %r12
+	testl	%edx, %edx
+	jne	.L1541
+.L1505:
+	testl	%ebx, %ebx
+	jle	.L1504
+	movslq	%ebx, %rax
+	movq	%r8, -80(%rbp)
+	movq	%rax, -104(%rbp)
+	movl	$0, -88(%rbp)
+	movq	$0, -64(%rbp)
+	movq	%rsi, -112(%rbp)
+	movl	%r9d, -84(%rbp)
+	movq	%r8, -120(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L1519:
+	movl	16(%r15), %eax
+	xorl	%r13d, %r13d
+	cmpq	$0, -64(%rbp)
+	movl	$1, %edx
+	leal	1(%rax), %ebx
+	jne	.L1542
+.L1506:
+	movslq	(%r15), %rax
+	testl	%eax, %eax
+	jle	.L1513
+	xorl	%r14d, %r14d
+	movl	%ebx, -72(%rbp)
+	movq	%r14, %rbx
+	movq	-80(%rbp), %r14
+	movl	%r13d, -56(%rbp)
+	movq	%r15, %r13
+	movl	%edx, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L1514:
+	movq	8(%r13), %rax
+	movq	(%rax,%rbx,8), %rdi
+	call	stringBegin@PLT
+	addl	(%r14,%rbx,4), %eax
+	addl	$1, %eax
+	movl	%eax, (%r12,%rbx,4)
+	movslq	0(%r13), %rax
+	addq	$1, %rbx
+	cmpl	%ebx, %eax
+	jg	.L1514
+	movl	%r15d, %edx
+	movl	-72(%rbp), %ebx
+	movq	%r13, %r15
+	movl	-56(%rbp), %r13d
+.L1513:
+	leaq	15(,%rax,4), %rax
+	movq	%rsp, -72(%rbp)
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, -56(%rbp)
+	cmpl	%edx, %ebx
+	jle	.L1515
+	.p2align 4,,10
+	.p2align 3
+.L1518:
+	leal	0(%r13,%rbx), %eax
+	movq	%r12, %rsi
+	movl	%eax, %r14d
+	shrl	$31, %r14d
+	addl	%eax, %r14d
+	movq	24(%r15), %rax
+	sarl	%r14d
+	movslq	%r14d, %rdx
+	movq	(%rax,%rdx,8), %rdi
+	movq	-56(%rbp), %rdx
+	call	dominatedFind@PLT
+	testl	%eax, %eax
+	je	.L1516
+	leal	1(%r14), %eax
+	movl	%r14d, %r13d
+	cmpl	%eax, %ebx
+	jg	.L1518
+.L1515:
+	movq	-64(%rbp), %rax
+	movq	-96(%rbp), %rcx
+	movl	-84(%rbp), %esi
+	movq	-72(%rbp), %rsp
+	movl	%r13d, (%rcx,%rax,4)
+	movq	-104(%rbp), %rcx
+	addq	$1, %rax
+	addl	%esi, -88(%rbp)
+	movq	-112(%rbp), %rsi
+	movq	%rax, -64(%rbp)
+	addq	%rsi, -80(%rbp)
+	cmpq	%rcx, %rax
+	jne	.L1519
+.L1504:
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1516:
+	.cfi_restore_state
+	leal	1(%r13), %eax
+	cmpl	%eax, %r14d
+	jle	.L1515
+	movl	%r14d, %ebx
+	jmp	.L1518
+	.p2align 4,,10
+	.p2align 3
+.L1542:
+	movl	-84(%rbp), %eax
+	testl	%eax, %eax
+	jle	.L1543
+	movl	-88(%rbp), %ecx
+	movl	-84(%rbp), %esi
+	movl	$1, %edi
+	movl	$1, %r13d
+	movl	%ecx, %edx
+	movl	%ecx, %eax
+	subl	%esi, %edx
+	addl	%ecx, %esi
+	movq	-120(%rbp), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L1511:
+	testl	%r13d, %r13d
+	je	.L1509
+	movslq	%edx, %r8
+	movslq	%eax, %r9
+	xorl	%r13d, %r13d
+	movl	(%rcx,%r9,4), %r10d
+	cmpl	%r10d, (%rcx,%r8,4)
+	setle	%r13b
+.L1509:
+	testl	%edi, %edi
+	je	.L1510
+	movslq	%eax, %rdi
+	movslq	%edx, %r8
+	movl	(%rcx,%r8,4), %r11d
+	cmpl	%r11d, (%rcx,%rdi,4)
+	setle	%dil
+	movzbl	%dil, %edi
+.L1510:
+	addl	$1, %eax
+	addl	$1, %edx
+	cmpl	%esi, %eax
+	jne	.L1511
+	movl	$1, %edx
+	testl	%r13d, %r13d
+	je	.L1512
+	movq	-96(%rbp), %rax
+	movq	-64(%rbp), %rsi
+	movl	-4(%rax,%rsi,4), %r13d
+	leal	1(%r13), %edx
+.L1512:
+	testl	%edi, %edi
+	je	.L1506
+	movq	-96(%rbp), %rax
+	movq	-64(%rbp), %rsi
+	movl	-4(%rax,%rsi,4), %ebx
+.L1508:
+	addl	$1, %ebx
+	jmp	.L1506
+.L1543:
+	movq	-96(%rbp), %rax
+	movq	-64(%rbp), %rcx
+	movl	-4(%rax,%rcx,4), %ebx
+	movl	%ebx, %r13d
+	leal	1(%rbx), %edx
+	jmp	.L1508
+.L1541:
+	movq	%r8, -72(%rbp)
+	movl	%r9d, -64(%rbp)
+	movq	%rsi, -56(%rbp)
+	call	flushMLCS.part.0
+	movq	-56(%rbp), %rsi
+	movl	-64(%rbp), %r9d
+	movq	-72(%rbp), %r8
+	jmp	.L1505
+	.cfi_endproc
+.LFE93:
+	.size	mlcsPrefixBatch, .-mlcsPrefixBatch
+	.p2align 4
+	.globl	mlcsWindowBatch
+	.type	mlcsWindowBatch, @function
+mlcsWindowBatch:
+.LFB95:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movslq	%edi, %rax
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	movl	%edi, %r12d
+	pushq	%rbx
+	.cfi_offset 3, -56
+	movl	%ecx, %ebx
+	subq	$168, %rsp
+	movq	%rax, -200(%rbp)
+	salq	$2, %rax
+	movq	%rax, -72(%rbp)
+	addq	$15, %rax
+	shrq	$4, %rax
+	movl	%edi, -100(%rbp)
+	salq	$4, %rax
+	movq	%r8, -120(%rbp)
+	subq	%rax, %rsp
+	movl	%esi, -180(%rbp)
+	movq	%rsp, -112(%rbp)
+	subq	%rax, %rsp
+	leal	(%rcx,%rcx,2), %eax
+	cltq
+	movq	%rdx, -64(%rbp)
+	salq	$3, %rax
+	movq	%r9, -152(%rbp)
+	movq	%rax, %rdi
+	movq	%rsp, -88(%rbp)
+	movq	%rax, -96(%rbp)
+	call	malloc@PLT
+	movslq	%ebx, %r8
+	movq	%rax, %r14
+	testl	%ebx, %ebx
+	jle	.L1545
+	leal	-1(%r12), %r15d
+	movl	%r12d, %r11d
+	movq	%rax, -80(%rbp)
+	movl	%r12d, %r13d
+	movl	%r15d, -56(%rbp)
+	shrl	$2, %r11d
+	movq	-120(%rbp), %r10
+	andl	$-4, %r13d
+	movq	-152(%rbp), %r14
+	salq	$4, %r11
+	movq	%rax, %rcx
+	xorl	%ebx, %ebx
+	xorl	%r9d, %r9d
+	pxor	%xmm6, %xmm6
+	pxor	%xmm5, %xmm5
+	.p2align 4,,10
+	.p2align 3
+.L1550:
+	movq	%r9, 16(%rcx)
+	movups	%xmm6, (%rcx)
+	testl	%r12d, %r12d
+	jle	.L1546
+	cmpl	$2, -56(%rbp)
+	movq	(%rcx), %rdi
+	movq	8(%rcx), %rsi
+	jbe	.L1585
+	movslq	%ebx, %rdx
+	pxor	%xmm2, %xmm2
+	xorl	%eax, %eax
+	salq	$2, %rdx
+	movdqa	%xmm2, %xmm0
+	leaq	(%r10,%rdx), %r15
+	addq	%r14, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1548:
+	movdqu	(%r15,%rax), %xmm3
+	movdqa	%xmm5, %xmm4
+	pcmpgtd	%xmm3, %xmm4
+	movdqa	%xmm3, %xmm1
+	punpckldq	%xmm4, %xmm1
+	punpckhdq	%xmm4, %xmm3
+	movdqa	%xmm5, %xmm4
+	paddq	%xmm1, %xmm0
+	paddq	%xmm3, %xmm0
+	movdqu	(%rdx,%rax), %xmm3
+	addq	$16, %rax
+	pcmpgtd	%xmm3, %xmm4
+	movdqa	%xmm3, %xmm1
+	punpckldq	%xmm4, %xmm1
+	punpckhdq	%xmm4, %xmm3
+	paddq	%xmm1, %xmm2
+	paddq	%xmm3, %xmm2
+	cmpq	%r11, %rax
+	jne	.L1548
+	movdqa	%xmm2, %xmm1
+	psrldq	$8, %xmm1
+	paddq	%xmm1, %xmm2
+	movdqa	%xmm0, %xmm1
+	psrldq	$8, %xmm1
+	movq	%xmm2, %rax
+	paddq	%xmm1, %xmm0
+	addq	%rax, %rsi
+	movq	%xmm0, %rax
+	addq	%rax, %rdi
+	movl	%r13d, %eax
+	cmpl	%r13d, %r12d
+	je	.L1549
+.L1547:
+	leal	(%rbx,%rax), %edx
+	movslq	%edx, %rdx
+	movslq	(%r10,%rdx,4), %r15
+	movslq	(%r14,%rdx,4), %rdx
+	addq	%rdx, %rsi
+	leal	1(%rax), %edx
+	addq	%r15, %rdi
+	cmpl	%edx, %r12d
+	jle	.L1549
+	addl	%ebx, %edx
+	addl	$2, %eax
+	movslq	%edx, %rdx
+	movslq	(%r10,%rdx,4), %r15
+	movslq	(%r14,%rdx,4), %rdx
+	addq	%r15, %rdi
+	addq	%rdx, %rsi
+	cmpl	%eax, %r12d
+	jle	.L1549
+	addl	%ebx, %eax
+	cltq
+	movslq	(%r10,%rax,4), %rdx
+	movslq	(%r14,%rax,4), %rax
+	addq	%rdx, %rdi
+	addq	%rax, %rsi
+.L1549:
+	movq	%rdi, (%rcx)
+	movq	%rsi, 8(%rcx)
+.L1546:
+	addq	$1, %r9
+	addq	$24, %rcx
+	addl	%r12d, %ebx
+	cmpq	%r8, %r9
+	jne	.L1550
+	movq	-80(%rbp), %r14
+	movl	$24, %edx
+	movq	%r9, %rsi
+	movl	-56(%rbp), %r15d
+	leaq	windowCmp(%rip), %rcx
+	movq	%r10, -56(%rbp)
+	movq	%r14, %rdi
+	call	qsort@PLT
+	movq	-200(%rbp), %rax
+	movl	-100(%rbp), %r8d
+	leaq	16(%r14), %rcx
+	movq	%rcx, -80(%rbp)
+	movq	-96(%rbp), %rcx
+	salq	$3, %rax
+	testl	%r8d, %r8d
+	movq	-56(%rbp), %r10
+	movq	%r14, -208(%rbp)
+	setg	-101(%rbp)
+	leaq	16(%r14,%rcx), %rcx
+	xorl	%ebx, %ebx
+	movq	%rax, -136(%rbp)
+	addq	$15, %rax
+	shrq	$4, %rax
+	movq	%rcx, -160(%rbp)
+	leaq	4(,%r15,4), %rcx
+	movq	-112(%rbp), %r15
+	salq	$4, %rax
+	movq	%rcx, -176(%rbp)
+	movq	%rax, -192(%rbp)
+	movq	%r10, -168(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L1582:
+	movq	-80(%rbp), %rax
+	movl	-100(%rbp), %r12d
+	movq	(%rax), %rax
+	movl	%r12d, %r13d
+	imull	%eax, %r13d
+	movq	%rax, -96(%rbp)
+	movq	-168(%rbp), %rax
+	movslq	%r13d, %r13
+	salq	$2, %r13
+	leaq	(%rax,%r13), %rcx
+	movq	-152(%rbp), %rax
+	addq	%rax, %r13
+	testq	%rbx, %rbx
+	je	.L1583
+	cmpb	$0, -101(%rbp)
+	je	.L1553
+	movq	-88(%rbp), %r9
+	movl	$1, %eax
+	xorl	%r11d, %r11d
+	pxor	%xmm1, %xmm1
+	.p2align 4,,10
+	.p2align 3
+.L1555:
+	movl	-4(%rcx,%rax,4), %edx
+	movl	-4(%r15,%rax,4), %r8d
+	pxor	%xmm0, %xmm0
+	pxor	%xmm2, %xmm2
+	movl	-4(%r13,%rax,4), %edi
+	movl	-4(%r9,%rax,4), %r10d
+	movl	%edx, %esi
+	subl	%r8d, %esi
+	cvtsi2sdl	%edi, %xmm2
+	cvtsi2sdl	%esi, %xmm0
+	mulsd	.LC10(%rip), %xmm0
+	movl	%edi, %esi
+	subl	%edx, %esi
+	movslq	%esi, %rsi
+	addq	%rsi, %r11
+	addsd	%xmm2, %xmm0
+	pxor	%xmm2, %xmm2
+	cvtsi2sdl	%r10d, %xmm2
+	subsd	%xmm2, %xmm0
+	addsd	%xmm0, %xmm1
+	cmpl	%edx, %r8d
+	jle	.L1615
+.L1554:
+	movq	-192(%rbp), %rax
+	movq	%rsp, -144(%rbp)
+	subq	%rax, %rsp
+	movq	%rsp, -56(%rbp)
+.L1558:
+	movq	%rbx, -112(%rbp)
+	xorl	%r12d, %r12d
+	movq	%rcx, %r14
+	movq	%r15, -120(%rbp)
+	movq	%r13, %r15
+	movq	%r12, %r13
+	.p2align 4,,10
+	.p2align 3
+.L1560:
+	movl	(%r14,%r13), %r12d
+	movl	(%r15,%r13), %ebx
+	subl	%r12d, %ebx
+	leal	1(%rbx), %edi
+	movslq	%ebx, %rbx
+	movslq	%edi, %rdi
+	call	malloc@PLT
+	movslq	%r12d, %rsi
+	movq	%rbx, %rdx
+	movq	%rax, %rdi
+	movq	-56(%rbp), %rax
+	movq	%rdi, (%rax,%r13,2)
+	movq	-64(%rbp), %rax
+	addq	(%rax,%r13,2), %rsi
+	addq	$4, %r13
+	call	memcpy@PLT
+	movb	$0, (%rax,%rbx)
+	cmpq	%r13, -72(%rbp)
+	jne	.L1560
+	movq	-112(%rbp), %rbx
+	movq	%r15, %r13
+	movq	%r14, %rcx
+	movq	-120(%rbp), %r15
+	testq	%rbx, %rbx
+	je	.L1562
+	movq	%rbx, %rdi
+	movq	%rcx, -112(%rbp)
+	call	freeMLCS
+	movq	-112(%rbp), %rcx
+.L1562:
+	movl	-100(%rbp), %r14d
+	movl	-180(%rbp), %esi
+	movq	%rcx, -112(%rbp)
+	movl	%r14d, %edi
+	call	allocMLCS
+	movq	%rax, %rbx
+	testl	%r14d, %r14d
+	jle	.L1563
+	xorl	%r14d, %r14d
+	movq	%r15, -128(%rbp)
+	movq	-136(%rbp), %r12
+	movq	%r13, -120(%rbp)
+	movq	%r14, %r13
+	movq	-56(%rbp), %r14
+	.p2align 4,,10
+	.p2align 3
+.L1566:
+	movq	(%r14,%r13), %rdx
+	movzbl	(%rdx), %eax
+	testb	%al, %al
+	je	.L1569
+	subl	$1, 4(%rbx)
+	leaq	1(%rdx), %r15
+	.p2align 4,,10
+	.p2align 3
+.L1568:
+	movsbl	%al, %esi
+	movq	8(%rbx), %rax
+	addq	$1, %r15
+	movq	(%rax,%r13), %rdi
+	call	stringAppend@PLT
+	movzbl	-1(%r15), %eax
+	testb	%al, %al
+	jne	.L1568
+.L1569:
+	addq	$8, %r13
+	cmpq	%r13, %r12
+	jne	.L1566
+	movq	%rbx, %rdi
+	movq	-120(%rbp), %r13
+	movq	-128(%rbp), %r15
+	call	buildFronts
+	movq	-56(%rbp), %r12
+	movq	-136(%rbp), %rax
+	movq	%rbx, -56(%rbp)
+	leaq	(%r12,%rax), %r14
+	movq	%r12, %rbx
+	movq	-112(%rbp), %r12
+	.p2align 4,,10
+	.p2align 3
+.L1570:
+	movq	(%rbx), %rdi
+	addq	$8, %rbx
+	call	free@PLT
+	cmpq	%r14, %rbx
+	jne	.L1570
+	movq	-56(%rbp), %rbx
+	movq	-144(%rbp), %rsp
+	movq	%r12, %rcx
+.L1571:
+	movq	-176(%rbp), %r14
+	movq	%rcx, %rsi
+	movq	%r15, %rdi
+	movq	%r14, %rdx
+	call	memcpy@PLT
+	movq	-88(%rbp), %rdi
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+.L1557:
+	movslq	-96(%rbp), %rax
+	movq	16(%rbp), %rcx
+	leaq	(%rcx,%rax,4), %r12
+	movl	36(%rbx), %eax
+	testl	%eax, %eax
+	jne	.L1616
+	movl	16(%rbx), %eax
+	addq	$24, -80(%rbp)
+	movq	-160(%rbp), %rcx
+	movl	%eax, (%r12)
+	movq	-80(%rbp), %rax
+	cmpq	%rcx, %rax
+	jne	.L1582
+.L1614:
+	movq	%rbx, %rdi
+	movq	-208(%rbp), %r14
+	call	freeMLCS
+.L1552:
+	movq	%r14, %rdi
+	call	free@PLT
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1615:
+	.cfi_restore_state
+	cmpl	%eax, %r12d
+	setg	%sil
+	cmpl	%edi, %r10d
+	setle	%dl
+	addq	$1, %rax
+	testb	%dl, %sil
+	jne	.L1555
+	cmpl	%edi, %r10d
+	jg	.L1554
+	pxor	%xmm0, %xmm0
+	xorl	%r8d, %r8d
+	cvtsi2sdq	%r11, %xmm0
+	comisd	%xmm0, %xmm1
+	ja	.L1554
+.L1609:
+	movq	%r15, -112(%rbp)
+	movq	%r13, %r14
+	movq	-88(%rbp), %r15
+	movq	%r8, %r13
+	movq	%rcx, -56(%rbp)
+	movq	-200(%rbp), %r12
+	jmp	.L1573
+	.p2align 4,,10
+	.p2align 3
+.L1572:
+	leaq	1(%r13), %rax
+	cmpq	%rax, %r12
+	je	.L1617
+.L1587:
+	movq	%rax, %r13
+.L1573:
+	movl	(%r15,%r13,4), %eax
+	movl	(%r14,%r13,4), %ecx
+	cmpl	%ecx, %eax
+	jge	.L1572
+	subl	%eax, %ecx
+	movslq	%eax, %rdx
+	movq	-64(%rbp), %rax
+	movl	%r13d, %esi
+	movq	%rbx, %rdi
+	addq	(%rax,%r13,8), %rdx
+	call	appendRun
+	leaq	1(%r13), %rax
+	cmpq	%rax, %r12
+	jne	.L1587
+.L1617:
+	movq	-56(%rbp), %rcx
+	movq	-112(%rbp), %r15
+	movq	%r13, %r8
+	movq	%r14, -56(%rbp)
+	xorl	%r12d, %r12d
+	movq	%r15, %r14
+	movq	%rcx, %r13
+	movq	%r8, %r15
+	jmp	.L1578
+	.p2align 4,,10
+	.p2align 3
+.L1574:
+	leaq	1(%r12), %rax
+	cmpq	%r15, %r12
+	je	.L1618
+.L1588:
+	movq	%rax, %r12
+.L1578:
+	movl	(%r14,%r12,4), %eax
+	movl	0(%r13,%r12,4), %edx
+	cmpl	%edx, %eax
+	jge	.L1574
+	movl	%edx, %ecx
+	movl	36(%rbx), %edx
+	subl	%eax, %ecx
+	testl	%edx, %edx
+	jne	.L1619
+	movl	%ecx, %edx
+	movl	%r12d, %esi
+	movq	%rbx, %rdi
+	call	popMany.part.0
+	leaq	1(%r12), %rax
+	cmpq	%r15, %r12
+	jne	.L1588
+.L1618:
+	movq	%r13, %rcx
+	movq	%r14, %r15
+	movq	-56(%rbp), %r13
+	jmp	.L1571
+.L1616:
+	movq	%rbx, %rdi
+	call	flushMLCS.part.0
+	movl	16(%rbx), %eax
+	addq	$24, -80(%rbp)
+	movl	%eax, (%r12)
+	movq	-80(%rbp), %rax
+	cmpq	%rax, -160(%rbp)
+	jne	.L1582
+	jmp	.L1614
+.L1619:
+	leaq	0(,%r12,8), %rax
+	movl	%ecx, -112(%rbp)
+	movq	%rax, -120(%rbp)
+	movq	8(%rbx), %rax
+	movq	(%rax,%r12,8), %rdi
+	call	stringSize@PLT
+	movq	40(%rbx), %rdx
+	movl	-112(%rbp), %ecx
+	movl	%eax, %r10d
+	leaq	(%rdx,%r12,4), %rsi
+	movl	(%rsi), %edx
+	subl	%edx, %r10d
+	cmpl	%r10d, %ecx
+	jg	.L1576
+	addl	%ecx, %edx
+	movl	%edx, (%rsi)
+.L1577:
+	movq	120(%rbx), %rsi
+	movq	%rbx, %rdi
+	call	paceMLCS
+	jmp	.L1574
+.L1576:
+	movq	-120(%rbp), %rdx
+	addq	48(%rbx), %rdx
+	movl	%eax, (%rsi)
+	movq	(%rdx), %rdi
+	movl	%r10d, -144(%rbp)
+	movl	%ecx, -128(%rbp)
+	movq	%rdx, -112(%rbp)
+	call	stringOwn@PLT
+	movq	-112(%rbp), %rdx
+	movl	-128(%rbp), %ecx
+	movl	-144(%rbp), %r10d
+	movq	%rax, (%rdx)
+	movq	48(%rbx), %rax
+	subl	%r10d, %ecx
+	movq	(%rax,%r12,8), %rdi
+	movl	%ecx, %esi
+	call	stringPopMany@PLT
+	jmp	.L1577
+.L1585:
+	xorl	%eax, %eax
+	jmp	.L1547
+.L1583:
+	movq	-136(%rbp), %rax
+	movl	-100(%rbp), %esi
+	movq	%rsp, -144(%rbp)
+	addq	$15, %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, -56(%rbp)
+	testl	%esi, %esi
+	jg	.L1558
+	movl	-180(%rbp), %esi
+	movl	-100(%rbp), %edi
+	call	allocMLCS
+	movq	%rax, %rbx
+.L1563:
+	movq	%rbx, %rdi
+	call	buildFronts
+	movq	-144(%rbp), %rsp
+	jmp	.L1557
+.L1553:
+	testq	%rbx, %rbx
+	je	.L1583
+	movl	-100(%rbp), %edi
+	xorl	%r8d, %r8d
+	testl	%edi, %edi
+	jg	.L1609
+	jmp	.L1557
+.L1545:
+	leaq	windowCmp(%rip), %rcx
+	movl	$24, %edx
+	movq	%r8, %rsi
+	movq	%rax, %rdi
+	call	qsort@PLT
+	jmp	.L1552
+	.cfi_endproc
+.LFE95:
+	.size	mlcsWindowBatch, .-mlcsWindowBatch
+	.p2align 4
+	.globl	mlcsMaxWindow
+	.type	mlcsMaxWindow, @function
+mlcsMaxWindow:
+.LFB98:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	movl	%esi, %r14d
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$440, %rsp
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movl	%edi, -432(%rbp)
+	movq	%rdx, -384(%rbp)
+	movl	%ecx, -428(%rbp)
+	movq	%r8, -456(%rbp)
+	testl	%edi, %edi
+	jle	.L1684
+	movslq	%edi, %rax
+	movq	%rdx, %r12
+	movl	$2147483647, %ebx
+	movq	%rax, -336(%rbp)
+	leaq	(%rdx,%rax,8), %r13
+.L1622:
+	movq	(%r12), %rdi
+	call	strlen@PLT
+	cmpl	%eax, %ebx
+	cmovg	%eax, %ebx
+	addq	$8, %r12
+	cmpq	%r13, %r12
+	jne	.L1622
+.L1621:
+	movl	-432(%rbp), %r15d
+	movl	-428(%rbp), %eax
+	imull	%r14d, %r15d
+	subl	%eax, %ebx
+	leal	1(%rbx), %ecx
+	movl	%ebx, -368(%rbp)
+	leal	(%rcx,%rcx), %edi
+	movl	%ecx, -436(%rbp)
+	movslq	%r15d, %rax
+	movslq	%edi, %rdi
+	leaq	15(,%rax,4), %rax
+	salq	$3, %rdi
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	call	malloc@PLT
+	movq	%rsp, %rbx
+	movq	%rax, -448(%rbp)
+	testl	%r15d, %r15d
+	jle	.L1627
+	movl	%r15d, %edx
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	salq	$2, %rdx
+	call	memset@PLT
+.L1627:
+	movl	-432(%rbp), %ecx
+	movslq	-436(%rbp), %r9
+	movl	%ecx, %eax
+	sall	$5, %eax
+	cltq
+	salq	$2, %rax
+	movq	%rax, -344(%rbp)
+	movq	-336(%rbp), %rax
+	salq	$3, %rax
+	movq	%rax, -464(%rbp)
+	testl	%ecx, %ecx
+	jle	.L1624
+	movl	-428(%rbp), %edx
+	testl	%edx, %edx
+	jle	.L1625
+	movq	-384(%rbp), %rcx
+	movslq	%edx, %r11
+	movq	%rcx, %rdi
+	leaq	(%rax,%rcx), %r8
+	xorl	%ecx, %ecx
+.L1626:
+	movq	(%rdi), %rdx
+	leaq	(%r11,%rdx), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1628:
+	movsbl	(%rdx), %eax
+	addq	$1, %rdx
+	leal	-65(%rcx,%rax), %eax
+	cltq
+	addl	$1, (%rbx,%rax,4)
+	cmpq	%rsi, %rdx
+	jne	.L1628
+	addq	$8, %rdi
+	addl	%r14d, %ecx
+	cmpq	%r8, %rdi
+	jne	.L1626
+.L1625:
+	movl	-436(%rbp), %r12d
+	testl	%r12d, %r12d
+	jle	.L1629
+.L1682:
+	cmpl	$1, %r14d
+	jne	.L1740
+	leal	-1(%r15), %eax
+	movq	%r9, -352(%rbp)
+	movq	-448(%rbp), %rcx
+	leal	-2(%r15), %r12d
+	movl	%eax, %edx
+	movl	%eax, %esi
+	movl	%r14d, -356(%rbp)
+	andl	$3, %eax
+	shrl	$2, %edx
+	andl	$-4, %esi
+	movl	-368(%rbp), %r10d
+	xorl	%r8d, %r8d
+	leal	1(%rsi), %edi
+	salq	$4, %rdx
+	movq	-384(%rbp), %r11
+	movl	%eax, %r13d
+	movl	%edi, -328(%rbp)
+	addq	%rbx, %rdx
+	movq	$-1, %rdi
+.L1648:
+	testq	%r8, %r8
+	jne	.L1741
+.L1641:
+	movq	$0, (%rcx)
+	movl	(%rbx), %eax
+	movq	%r8, 8(%rcx)
+	cmpl	$1, %r15d
+	jle	.L1644
+	cmpl	$2, %r12d
+	jbe	.L1686
+	movd	%eax, %xmm4
+	movq	%rbx, %rax
+	pshufd	$0, %xmm4, %xmm0
+	.p2align 4,,10
+	.p2align 3
+.L1646:
+	movdqu	4(%rax), %xmm1
+	movdqu	4(%rax), %xmm3
+	addq	$16, %rax
+	pcmpgtd	%xmm0, %xmm1
+	pand	%xmm1, %xmm0
+	pandn	%xmm3, %xmm1
+	por	%xmm1, %xmm0
+	cmpq	%rdx, %rax
+	jne	.L1646
+	movdqa	%xmm0, %xmm2
+	psrldq	$8, %xmm2
+	movdqa	%xmm2, %xmm1
+	pcmpgtd	%xmm0, %xmm1
+	pand	%xmm1, %xmm0
+	pandn	%xmm2, %xmm1
+	por	%xmm1, %xmm0
+	movdqa	%xmm0, %xmm2
+	psrldq	$4, %xmm2
+	movdqa	%xmm2, %xmm1
+	pcmpgtd	%xmm0, %xmm1
+	pand	%xmm1, %xmm0
+	pandn	%xmm2, %xmm1
+	por	%xmm0, %xmm1
+	movd	%xmm1, %eax
+	testl	%r13d, %r13d
+	je	.L1644
+	movl	-328(%rbp), %esi
+.L1645:
+	movslq	%esi, %r9
+	leaq	(%rbx,%r9,4), %r9
+	movl	(%r9), %r14d
+	cmpl	%r14d, %eax
+	cmovg	%r14d, %eax
+	leal	1(%rsi), %r14d
+	cmpl	%r14d, %r15d
+	jle	.L1644
+	movl	4(%r9), %r14d
+	cmpl	%r14d, %eax
+	cmovg	%r14d, %eax
+	addl	$2, %esi
+	cmpl	%esi, %r15d
+	jle	.L1644
+	movl	8(%r9), %esi
+	cmpl	%esi, %eax
+	cmovg	%esi, %eax
+.L1644:
+	cltq
+	addq	$1, %rdi
+	addq	$1, %r8
+	movq	%rax, (%rcx)
+	addq	$16, %rcx
+	cmpl	%edi, %r10d
+	jg	.L1648
+	movq	-352(%rbp), %r9
+	movl	-356(%rbp), %r14d
+.L1649:
+	movq	-448(%rbp), %rdi
+	leaq	boundCmp(%rip), %rcx
+	movl	$16, %edx
+	movq	%r9, %rsi
+	call	qsort@PLT
+	movq	-344(%rbp), %rax
+	movl	-432(%rbp), %r11d
+	subq	%rax, %rsp
+	movq	%rsp, -416(%rbp)
+	subq	%rax, %rsp
+	movq	-464(%rbp), %rax
+	movq	%rsp, -424(%rbp)
+	addq	$15, %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %rbx
+	testl	%r11d, %r11d
+	jle	.L1742
+.L1639:
+	movl	-428(%rbp), %eax
+	movq	%rbx, %r13
+	addl	$1, %eax
+	movslq	%eax, %r12
+	movq	-464(%rbp), %rax
+	leaq	(%rbx,%rax), %r15
+.L1650:
+	movq	%r12, %rdi
+	addq	$8, %r13
+	call	malloc@PLT
+	movq	%rax, -8(%r13)
+	cmpq	%r13, %r15
+	jne	.L1650
+	movq	-456(%rbp), %rax
+	movl	-436(%rbp), %r9d
+	movl	$0, (%rax)
+	testl	%r9d, %r9d
+	jle	.L1687
+.L1652:
+	movq	-464(%rbp), %rcx
+	movq	-384(%rbp), %rax
+	xorl	%r10d, %r10d
+	movl	-432(%rbp), %edi
+	addq	%rcx, %rax
+	movslq	-428(%rbp), %rcx
+	movq	%rax, -400(%rbp)
+	leal	-1(%rdi), %eax
+	movl	%eax, -476(%rbp)
+	movl	%edi, %eax
+	shrl	$2, %eax
+	movq	%rcx, -408(%rbp)
+	salq	$4, %rax
+	movq	%rax, -472(%rbp)
+	movl	%edi, %eax
+	andl	$-4, %eax
+	movl	%eax, -440(%rbp)
+	movl	$-1, %eax
+.L1655:
+	movq	-448(%rbp), %rcx
+	leal	(%r10,%r10), %edx
+	movslq	%edx, %rdx
+	leaq	(%rcx,%rdx,8), %rdx
+	movslq	%eax, %rcx
+	cmpq	(%rdx), %rcx
+	jge	.L1677
+	cmpl	%r10d, -436(%rbp)
+	jle	.L1678
+	movl	$0, -360(%rbp)
+	movl	%r10d, -364(%rbp)
+	movl	%eax, -356(%rbp)
+	cmpq	(%rdx), %rcx
+	jge	.L1743
+	.p2align 4,,10
+	.p2align 3
+.L1673:
+	movq	8(%rdx), %rax
+	testl	%edi, %edi
+	jle	.L1656
+	movq	-384(%rbp), %r15
+	movslq	%eax, %r12
+	movq	%rdx, -336(%rbp)
+	movl	%edi, -344(%rbp)
+	movq	%r12, %r13
+	movq	-400(%rbp), %r12
+	movq	%rax, -376(%rbp)
+	movq	%rbx, -328(%rbp)
+	movl	%r14d, -352(%rbp)
+	movq	%r15, %r14
+	movq	%rbx, %r15
+	movq	-408(%rbp), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L1657:
+	movq	(%r14), %rsi
+	movq	(%r15), %rdi
+	movq	%rbx, %rdx
+	addq	$8, %r14
+	addq	$8, %r15
+	addq	%r13, %rsi
+	call	memcpy@PLT
+	movb	$0, (%rax,%rbx)
+	cmpq	%r12, %r14
+	jne	.L1657
+	movl	-344(%rbp), %edi
+	movq	-328(%rbp), %rbx
+	movq	-336(%rbp), %rdx
+	movl	-352(%rbp), %r14d
+	movq	-376(%rbp), %rax
+	cmpl	$1, %edi
+	je	.L1658
+	movl	%edi, %ecx
+	movq	%rdx, -376(%rbp)
+	movl	$2147483647, %r15d
+	leaq	-320(%rbp), %r13
+	movq	%rcx, -352(%rbp)
+	movl	%r15d, %r12d
+	movl	$1, %esi
+	movq	%r13, %r15
+	movl	%edi, -336(%rbp)
+	movq	%rax, -392(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L1660:
+	movq	-8(%rbx,%rsi,8), %rax
+	movq	%rsi, -344(%rbp)
+	movq	%rsi, %r13
+	movq	%rax, -328(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L1659:
+	movq	-328(%rbp), %xmm0
+	movl	%r14d, %edx
+	movq	%r15, %rsi
+	movl	$2, %edi
+	movhps	(%rbx,%r13,8), %xmm0
+	movaps	%xmm0, -320(%rbp)
+	call	naiveMLCS@PLT
+	cmpl	%eax, %r12d
+	cmovg	%eax, %r12d
+	addq	$1, %r13
+	cmpl	%r13d, -336(%rbp)
+	jg	.L1659
+	movq	-344(%rbp), %rsi
+	movq	-352(%rbp), %rax
+	addq	$1, %rsi
+	cmpq	%rax, %rsi
+	jne	.L1660
+	movl	-356(%rbp), %ecx
+	movq	-376(%rbp), %rdx
+	movl	-336(%rbp), %edi
+	movq	-392(%rbp), %rax
+	cmpl	%ecx, %r12d
+	jle	.L1664
+	cmpl	$2, %edi
+	jne	.L1663
+	movq	-456(%rbp), %rcx
+	movl	%r12d, -356(%rbp)
+	movl	%eax, (%rcx)
+.L1664:
+	movl	-364(%rbp), %eax
+	addq	$16, %rdx
+	cmpl	$31, -360(%rbp)
+	leal	1(%rax), %ecx
+	jg	.L1689
+	cmpl	%eax, -368(%rbp)
+	jle	.L1689
+	movl	%ecx, -364(%rbp)
+	movslq	-356(%rbp), %rcx
+	cmpq	(%rdx), %rcx
+	jl	.L1673
+.L1743:
+	movl	-364(%rbp), %r10d
+	movl	-356(%rbp), %eax
+.L1672:
+	subq	$8, %rsp
+	movl	%eax, -344(%rbp)
+	leaq	-304(%rbp), %r13
+	movl	-360(%rbp), %r15d
+	movl	%r10d, -336(%rbp)
+	movq	-416(%rbp), %r8
+	movl	%r14d, %esi
+	pushq	%r13
+	movq	-424(%rbp), %r9
+	movl	%r15d, %ecx
+	movq	-384(%rbp), %rdx
+	movl	%edi, -328(%rbp)
+	call	mlcsWindowBatch
+	testl	%r15d, %r15d
+	popq	%rdi
+	movl	-336(%rbp), %r10d
+	movl	-328(%rbp), %edi
+	movl	-344(%rbp), %eax
+	popq	%r8
+	je	.L1674
+	movslq	%r15d, %rsi
+	movq	-456(%rbp), %r8
+	xorl	%edx, %edx
+	salq	$2, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L1676:
+	movl	0(%r13,%rdx), %ecx
+	cmpl	%eax, %ecx
+	jle	.L1675
+	movl	-176(%rbp,%rdx), %eax
+	movl	%eax, (%r8)
+	movl	%ecx, %eax
+.L1675:
+	addq	$4, %rdx
+	cmpq	%rsi, %rdx
+	jne	.L1676
+.L1674:
+	cmpl	%r10d, -436(%rbp)
+	jg	.L1655
+.L1677:
+	movl	-432(%rbp), %esi
+	testl	%esi, %esi
+	jle	.L1680
+	movq	-464(%rbp), %rcx
+	leaq	(%rbx,%rcx), %r15
+.L1654:
+	movl	%eax, %r12d
+.L1681:
+	movq	(%rbx), %rdi
+	addq	$8, %rbx
+	call	free@PLT
+	cmpq	%r15, %rbx
+	jne	.L1681
+	movl	%r12d, %eax
+.L1680:
+	movq	-448(%rbp), %rdi
+	movl	%eax, -328(%rbp)
+	call	free@PLT
+	movl	-328(%rbp), %eax
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L1658:
+	.cfi_restore_state
+	cmpl	$2147483647, -356(%rbp)
+	je	.L1662
+.L1663:
+	movl	-360(%rbp), %r8d
+	movl	-428(%rbp), %ecx
+	imull	%edi, %r8d
+	cmpl	$2, -476(%rbp)
+	leal	(%rcx,%rax), %r9d
+	jbe	.L1744
+	movq	-416(%rbp), %rcx
+	movslq	%r8d, %rsi
+	movd	%eax, %xmm5
+	movd	%r9d, %xmm6
+	salq	$2, %rsi
+	pshufd	$0, %xmm5, %xmm1
+	pshufd	$0, %xmm6, %xmm0
+	movq	-472(%rbp), %r11
+	leaq	(%rcx,%rsi), %r10
+	movq	-424(%rbp), %rcx
+	addq	%rcx, %rsi
+	xorl	%ecx, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L1668:
+	movups	%xmm1, (%r10,%rcx)
+	movups	%xmm0, (%rsi,%rcx)
+	addq	$16, %rcx
+	cmpq	%r11, %rcx
+	jne	.L1668
+	movl	-440(%rbp), %ecx
+	movl	%ecx, %esi
+	cmpl	%ecx, %edi
+	je	.L1670
+.L1666:
+	movq	-416(%rbp), %r11
+	movq	-424(%rbp), %r10
+	leal	(%r8,%rsi), %ecx
+	movslq	%ecx, %rcx
+	movl	%eax, (%r11,%rcx,4)
+	movl	%r9d, (%r10,%rcx,4)
+	leal	1(%rsi), %ecx
+	cmpl	%ecx, %edi
+	jle	.L1670
+	addl	%r8d, %ecx
+	addl	$2, %esi
+	movslq	%ecx, %rcx
+	movl	%eax, (%r11,%rcx,4)
+	movl	%r9d, (%r10,%rcx,4)
+	cmpl	%esi, %edi
+	jle	.L1670
+	leal	(%r8,%rsi), %ecx
+	movslq	%ecx, %rcx
+	movl	%eax, (%r11,%rcx,4)
+	movl	%r9d, (%r10,%rcx,4)
+.L1670:
+	movslq	-360(%rbp), %rcx
+	movl	%eax, -176(%rbp,%rcx,4)
+	leal	1(%rcx), %eax
+	movl	%eax, -360(%rbp)
+	jmp	.L1664
+.L1656:
+	cmpl	$2147483647, -356(%rbp)
+	jne	.L1670
+.L1662:
+	movl	$2147483647, -356(%rbp)
+	jmp	.L1664
+.L1686:
+	movl	$1, %esi
+	jmp	.L1645
+.L1689:
+	movl	-356(%rbp), %eax
+	movl	%ecx, %r10d
+	jmp	.L1672
+.L1744:
+	xorl	%esi, %esi
+	jmp	.L1666
+.L1741:
+	testl	%r15d, %r15d
+	jle	.L1642
+	movl	-428(%rbp), %eax
+	leal	(%rax,%r8), %r14d
+	xorl	%eax, %eax
+	movslq	%r14d, %r14
+	subq	$1, %r14
+.L1643:
+	movq	(%r11,%rax,8), %r9
+	movsbl	(%r9,%rdi), %esi
+	leal	-65(%rsi,%rax), %esi
+	movslq	%esi, %rsi
+	subl	$1, (%rbx,%rsi,4)
+	movsbl	(%r9,%r14), %esi
+	leal	-65(%rsi,%rax), %esi
+	addq	$1, %rax
+	movslq	%esi, %rsi
+	addl	$1, (%rbx,%rsi,4)
+	movq	-336(%rbp), %rsi
+	cmpq	%rsi, %rax
+	jne	.L1643
+	jmp	.L1641
+.L1678:
+	subq	$8, %rsp
+	leaq	-304(%rbp), %rdx
+	xorl	%ecx, %ecx
+	movl	%r14d, %esi
+	movl	%eax, -328(%rbp)
+	movq	-424(%rbp), %r9
+	movq	-416(%rbp), %r8
+	movl	-432(%rbp), %edi
+	pushq	%rdx
+	movq	-384(%rbp), %rdx
+	call	mlcsWindowBatch
+	popq	%rdx
+	movl	-328(%rbp), %eax
+	popq	%rcx
+	jmp	.L1677
+.L1642:
+	movq	$0, (%rcx)
+	movl	(%rbx), %eax
+	movq	%r8, 8(%rcx)
+	jmp	.L1644
+.L1742:
+	movq	-456(%rbp), %rax
+	movl	-436(%rbp), %r10d
+	movl	$0, (%rax)
+	testl	%r10d, %r10d
+	jg	.L1652
+.L1653:
+	orl	$-1, %eax
+	jmp	.L1680
+	.p2align 4,,10
+	.p2align 3
+.L1624:
+	movl	-436(%rbp), %eax
+	testl	%eax, %eax
+	jg	.L1682
+	movq	-448(%rbp), %rdi
+	leaq	boundCmp(%rip), %rcx
+	movl	$16, %edx
+	movq	%r9, %rsi
+	call	qsort@PLT
+	movq	-456(%rbp), %rax
+	movl	$0, (%rax)
+	jmp	.L1653
+.L1629:
+	movq	-448(%rbp), %rdi
+	leaq	boundCmp(%rip), %rcx
+	movl	$16, %edx
+	movq	%r9, %rsi
+	call	qsort@PLT
+	movq	-344(%rbp), %rax
+	subq	%rax, %rsp
+	movq	%rsp, -416(%rbp)
+	subq	%rax, %rsp
+	movq	-464(%rbp), %rax
+	movq	%rsp, -424(%rbp)
+	addq	$15, %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %rbx
+	jmp	.L1639
+.L1684:
+	movslq	-432(%rbp), %rax
+	movl	$2147483647, %ebx
+	movq	%rax, -336(%rbp)
+	jmp	.L1621
+.L1740:
+	movq	-464(%rbp), %rax
+	movq	-384(%rbp), %rcx
+	movslq	%r14d, %r15
+	xorl	%r13d, %r13d
+	movq	%r9, -328(%rbp)
+	movq	-448(%rbp), %r11
+	leaq	0(,%r15,4), %rdi
+	movq	$-1, %r10
+	leaq	(%rax,%rcx), %r12
+	movl	-428(%rbp), %eax
+	movl	-432(%rbp), %r8d
+	movq	%r12, %rdx
+	leal	1(%rax), %esi
+.L1638:
+	testq	%r13, %r13
+	jne	.L1631
+.L1634:
+	movq	$0, (%r11)
+	xorl	%r9d, %r9d
+	xorl	%r12d, %r12d
+	movq	%r13, 8(%r11)
+	testl	%r14d, %r14d
+	jle	.L1633
+	movq	%rdx, -336(%rbp)
+	movq	%r13, -352(%rbp)
+.L1632:
+	movslq	(%rbx,%r9,4), %rax
+	cmpl	$1, %r8d
+	jle	.L1636
+	leal	(%r14,%r9), %edx
+	movslq	%edx, %rdx
+	leaq	(%rbx,%rdx,4), %rcx
+	movl	$1, %edx
+	.p2align 4,,10
+	.p2align 3
+.L1637:
+	movslq	(%rcx), %r13
+	cmpl	%r13d, %eax
+	cmovg	%r13, %rax
+	addl	$1, %edx
+	addq	%rdi, %rcx
+	cmpl	%edx, %r8d
+	jne	.L1637
+.L1636:
+	addq	$1, %r9
+	addq	%rax, %r12
+	cmpq	%r15, %r9
+	jne	.L1632
+	movq	%r12, (%r11)
+	movq	-336(%rbp), %rdx
+	movq	-352(%rbp), %r13
+.L1633:
+	addq	$1, %r13
+	addq	$16, %r11
+	addq	$1, %r10
+	cmpl	%r10d, -368(%rbp)
+	jg	.L1638
+	movq	-328(%rbp), %r9
+	jmp	.L1649
+.L1631:
+	testl	%r8d, %r8d
+	jle	.L1634
+	leal	(%rsi,%r10), %eax
+	movq	-384(%rbp), %rcx
+	cltq
+	leaq	-1(%rax), %r12
+	xorl	%eax, %eax
+.L1635:
+	movq	(%rcx), %r9
+	addq	$8, %rcx
+	movsbl	(%r9,%r10), %r9d
+	leal	-65(%rax,%r9), %r9d
+	movslq	%r9d, %r9
+	subl	$1, (%rbx,%r9,4)
+	movq	-8(%rcx), %r9
+	movsbl	(%r9,%r12), %r9d
+	leal	-65(%rax,%r9), %r9d
+	addl	%r14d, %eax
+	movslq	%r9d, %r9
+	addl	$1, (%rbx,%r9,4)
+	cmpq	%rdx, %rcx
+	jne	.L1635
+	jmp	.L1634
+.L1687:
+	movl	$-1, %eax
+	jmp	.L1654
+	.cfi_endproc
+.LFE98:
+	.size	mlcsMaxWindow, .-mlcsMaxWindow
+	.p2align 4
+	.globl	mlcsWitness
+	.type	mlcsWitness, @function
+mlcsWitness:
+.LFB99:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.cfi_offset 15, -24
+	movq	%rdi, %r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$56, %rsp
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movslq	(%rdi), %rbx
+	movl	36(%rdi), %ecx
+	movq	%rsi, -88(%rbp)
+	movq	%rdx, -80(%rbp)
+	leaq	0(,%rbx,4), %rax
+	movl	%ebx, -68(%rbp)
+	movq	%rax, -64(%rbp)
+	addq	$15, %rax
+	andq	$-16, %rax
+	subq	%rax, %rsp
+	movq	%rsp, %r12
+	testl	%ecx, %ecx
+	jne	.L1765
+.L1746:
+	movl	-68(%rbp), %edx
+	xorl	%r13d, %r13d
+	testl	%edx, %edx
+	jle	.L1750
+	.p2align 4,,10
+	.p2align 3
+.L1747:
+	movq	8(%r15), %rax
+	movq	(%rax,%r13,8), %rdi
+	call	stringEnd@PLT
+	movl	%eax, (%r12,%r13,4)
+	addq	$1, %r13
+	cmpq	%r13, %rbx
+	jne	.L1747
+.L1750:
+	movslq	16(%r15), %rax
+	testl	%eax, %eax
+	jle	.L1749
+	movl	-68(%rbp), %ecx
+	movslq	%eax, %r13
+	subl	$1, %eax
+	imull	%ecx, %eax
+	movl	%eax, -72(%rbp)
+	jmp	.L1752
+	.p2align 4,,10
+	.p2align 3
+.L1754:
+	subq	$1, %r13
+	movl	-68(%rbp), %edx
+	subl	%edx, -72(%rbp)
+	testl	%r13d, %r13d
+	jle	.L1764
+.L1752:
+	movq	24(%r15), %rax
+	movq	%r12, %rdx
+	movq	%r12, %rsi
+	movq	(%rax,%r13,8), %rdi
+	call	dominatedFind@PLT
+	testl	%eax, %eax
+	je	.L1764
+	movq	8(%r15), %rax
+	movl	(%r12), %esi
+	movq	(%rax), %rdi
+	call	stringLetter@PLT
+	movq	-88(%rbp), %rcx
+	cmpq	$0, -80(%rbp)
+	movb	%al, -1(%rcx,%r13)
+	je	.L1754
+	movl	-68(%rbp), %eax
+	testl	%eax, %eax
+	jle	.L1754
+	movslq	-72(%rbp), %rax
+	movq	-80(%rbp), %rcx
+	xorl	%r14d, %r14d
+	leaq	(%rcx,%rax,4), %rax
+	movq	%rax, -56(%rbp)
+	.p2align 4,,10
+	.p2align 3
+.L1755:
+	movq	8(%r15), %rax
+	movl	(%r12,%r14), %ebx
+	movq	(%rax,%r14,2), %rdi
+	call	stringBegin@PLT
+	subl	%eax, %ebx
+	movq	-56(%rbp), %rax
+	movl	%ebx, (%rax,%r14)
+	addq	$4, %r14
+	cmpq	%r14, -64(%rbp)
+	jne	.L1755
+	subq	$1, %r13
+	movl	-68(%rbp), %edx
+	subl	%edx, -72(%rbp)
+	testl	%r13d, %r13d
+	jg	.L1752
+.L1764:
+	movslq	16(%r15), %rax
+.L1749:
+	movq	-88(%rbp), %rcx
+	movb	$0, (%rcx,%rax)
+	movl	16(%r15), %eax
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L1765:
+	.cfi_restore_state
+	call	flushMLCS.part.0
+	jmp	.L1746
+	.cfi_endproc
+.LFE99:
+	.size	mlcsWitness, .-mlcsWitness
+	.local	sortDim
+	.comm	sortDim,4,4
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC1:
+	.long	1
+	.long	0
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC2:
+	.long	-2
+	.long	-2
+	.long	-2
+	.long	-2
+	.section	.rodata.cst8
+	.align 8
+.LC6:
+	.long	2147483647
+	.long	0
+	.section	.rodata.cst16
+	.align 16
+.LC9:
+	.long	-3
+	.long	-3
+	.long	-3
+	.long	-3
+	.section	.rodata.cst8
+	.align 8
+.LC10:
+	.long	0
+	.long	1080295424
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
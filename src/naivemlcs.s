@@ -0,0 +1,313 @@
+	.file	"naivemlcs.c"
+	.text
+	.p2align 4
+	.globl	naiveMLCS
+	.type	naiveMLCS, @function
+naiveMLCS:
+.LFB13:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movslq	%edi, %rdi
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	leaq	0(,%rdi,4), %r13
+	pushq	%r12
+	leaq	15(%r13), %rax
+	pushq	%rbx
+	shrq	$4, %rax
+	salq	$4, %rax
+	subq	$56, %rsp
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	subq	%rax, %rsp
+	movq	%rsp, %rbx
+	subq	%rax, %rsp
+	movq	%rsp, %r12
+	subq	%rax, %rsp
+	movq	%rsp, -64(%rbp)
+	testl	%edi, %edi
+	jle	.L2
+	leaq	(%rsi,%rdi,8), %rax
+	movl	$1, %r14d
+	movq	%r13, -56(%rbp)
+	movq	%rbx, %r13
+	movq	%rax, %r15
+	movq	%r12, %rax
+	movq	%rbx, -88(%rbp)
+	movl	%r14d, %r12d
+	movl	%edi, -72(%rbp)
+	movq	%rsi, %rbx
+	movq	%rax, %r14
+	movq	%rsi, -80(%rbp)
+	jmp	.L4
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	addq	$8, %rbx
+	imull	%eax, %r12d
+	addq	$4, %r13
+	cmpq	%rbx, %r15
+	je	.L51
+.L4:
+	movq	(%rbx), %rdi
+	call	strlen@PLT
+	addl	$1, %eax
+	movl	%eax, 0(%r13)
+	cmpl	$1, %eax
+	jne	.L52
+	xorl	%ebx, %ebx
+.L1:
+	leaq	-40(%rbp), %rsp
+	movl	%ebx, %eax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	.cfi_restore_state
+	movslq	%r12d, %r15
+	movl	-72(%rbp), %r8d
+	movq	%r14, %rax
+	movq	-80(%rbp), %r9
+	movq	%r15, %r14
+	salq	$2, %r15
+	movq	-56(%rbp), %r13
+	movq	-88(%rbp), %rbx
+	movq	%r15, %rdi
+	movq	%r9, -72(%rbp)
+	movq	%rax, %r12
+	subq	$4, %r15
+	movl	%r8d, -56(%rbp)
+	call	malloc@PLT
+	movq	%rax, %r10
+	leaq	(%rax,%r15), %rcx
+	testl	%r14d, %r14d
+	jle	.L23
+	movq	-72(%rbp), %r9
+	movl	-56(%rbp), %r8d
+.L6:
+	leal	-2(%r8), %eax
+	movl	%r14d, -56(%rbp)
+	leal	-1(%r8), %edi
+	movl	%eax, -80(%rbp)
+	cltq
+	leaq	(%r12,%r13), %r11
+	leaq	-4(%r12,%r13), %r15
+	movq	%rax, -72(%rbp)
+	movq	%rcx, -96(%rbp)
+	movq	-64(%rbp), %rcx
+	movl	%edi, -88(%rbp)
+	xorl	%edi, %edi
+.L8:
+	testl	%r8d, %r8d
+	jle	.L29
+	movq	%rcx, -64(%rbp)
+	movl	%edi, %eax
+.L28:
+	xorl	%ecx, %ecx
+	xorl	%esi, %esi
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	cltd
+	idivl	(%rbx,%rcx)
+	testl	%edx, %edx
+	movl	%edx, (%r12,%rcx)
+	sete	%dl
+	addq	$4, %rcx
+	orl	%esi, %edx
+	movzbl	%dl, %esi
+	cmpq	%rcx, %r13
+	jne	.L9
+	movl	$0, (%r10,%rdi,4)
+	testb	%dl, %dl
+	je	.L53
+	addq	$1, %rdi
+	cmpl	%edi, -56(%rbp)
+	jle	.L46
+.L55:
+	movl	%edi, %eax
+	jmp	.L28
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	cmpl	$1, %r8d
+	je	.L13
+	movslq	(%r12), %rax
+	movq	(%r9), %rdx
+	movzbl	-1(%rdx,%rax), %r14d
+	movl	$2, %eax
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	movq	-8(%r9,%rax,8), %rcx
+	movslq	-4(%r12,%rax,4), %rdx
+	movzbl	-1(%rcx,%rdx), %edx
+	cmpb	%r14b, %dl
+	sete	%sil
+	cmpl	%eax, %r8d
+	setg	%cl
+	addq	$1, %rax
+	testb	%cl, %sil
+	jne	.L14
+	cmpb	%r14b, %dl
+	je	.L54
+	movq	-72(%rbp), %r14
+	movq	%r12, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	movl	(%rcx), %esi
+	leal	-1(%rsi), %eax
+	movl	%eax, (%rcx)
+	movl	(%r15), %edx
+	movq	%r14, %rax
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	imull	(%rbx,%rax,4), %edx
+	addl	(%r12,%rax,4), %edx
+	subq	$1, %rax
+	cmpl	$-1, %eax
+	jne	.L24
+	movslq	%edx, %rdx
+	movl	%esi, (%rcx)
+	movl	(%r10,%rdx,4), %eax
+	cmpl	%eax, (%r10,%rdi,4)
+	jge	.L25
+	movl	%eax, (%r10,%rdi,4)
+.L25:
+	addq	$4, %rcx
+	cmpq	%r11, %rcx
+	jne	.L26
+	addq	$1, %rdi
+	cmpl	%edi, -56(%rbp)
+	jg	.L55
+.L46:
+	movq	-96(%rbp), %rcx
+.L23:
+	movq	%r10, %rdi
+	movl	(%rcx), %ebx
+	call	free@PLT
+	jmp	.L1
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	movl	$0, (%r10,%rdi,4)
+	movl	-4(%rcx,%r13), %edx
+.L11:
+	movslq	%edx, %rdx
+	movl	(%r10,%rdx,4), %eax
+	addl	$1, %eax
+	movl	%eax, (%r10,%rdi,4)
+	addq	$1, %rdi
+	cmpl	%edi, -56(%rbp)
+	jg	.L8
+	movq	-96(%rbp), %rcx
+	jmp	.L23
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	cmpl	$2, -88(%rbp)
+	movq	-64(%rbp), %rcx
+	jbe	.L56
+.L32:
+	movl	%r8d, %edx
+	xorl	%eax, %eax
+	pcmpeqd	%xmm1, %xmm1
+	shrl	$2, %edx
+	salq	$4, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	movdqu	(%r12,%rax), %xmm0
+	paddd	%xmm1, %xmm0
+	movups	%xmm0, (%rcx,%rax)
+	addq	$16, %rax
+	cmpq	%rdx, %rax
+	jne	.L17
+	movl	%r8d, %edx
+	andl	$-4, %edx
+	testb	$3, %r8b
+	je	.L19
+	movslq	%edx, %rax
+	salq	$2, %rax
+	leaq	(%r12,%rax), %rsi
+	addq	%rcx, %rax
+	movl	(%rsi), %r14d
+	subl	$1, %r14d
+	movl	%r14d, (%rax)
+	leal	1(%rdx), %r14d
+	cmpl	%r14d, %r8d
+	jle	.L19
+.L30:
+	movl	4(%rsi), %r14d
+	addl	$2, %edx
+	subl	$1, %r14d
+	movl	%r14d, 4(%rax)
+	cmpl	%edx, %r8d
+	jle	.L19
+	movl	8(%rsi), %edx
+	subl	$1, %edx
+	movl	%edx, 8(%rax)
+.L19:
+	movl	-80(%rbp), %eax
+	movl	-4(%rcx,%r13), %edx
+	testl	%eax, %eax
+	js	.L11
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	imull	(%rbx,%rax,4), %edx
+	addl	(%rcx,%rax,4), %edx
+	subq	$1, %rax
+	testl	%eax, %eax
+	jns	.L22
+	jmp	.L11
+.L2:
+	movl	%edi, -56(%rbp)
+	movl	$4, %edi
+	movl	$1, %r14d
+	movq	%rsi, -72(%rbp)
+	call	malloc@PLT
+	movl	-56(%rbp), %r8d
+	movq	-72(%rbp), %r9
+	movq	%rax, %r10
+	movq	%rax, %rcx
+	jmp	.L6
+.L56:
+	movl	(%r12), %eax
+	movq	%r12, %rsi
+	xorl	%edx, %edx
+	subl	$1, %eax
+	movl	%eax, (%rcx)
+	movq	%rcx, %rax
+	jmp	.L30
+.L13:
+	cmpl	$2, -88(%rbp)
+	movq	-64(%rbp), %rcx
+	ja	.L32
+	movl	(%r12), %eax
+	subl	$1, %eax
+	movl	%eax, (%rcx)
+	jmp	.L19
+	.cfi_endproc
+.LFE13:
+	.size	naiveMLCS, .-naiveMLCS
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
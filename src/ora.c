@@ -33,6 +33,7 @@
 struct ora{
   int w; /* Weight, means number of elements stored,
 	  Counting multiplicities. */
+  int rc; /* Number of other trees that share it */
   int d; /* Number of dimensions */
   int o; /* Number of occupied positions */
   int a; /* Number of alloced points */
@@ -184,6 +185,32 @@ buildORA(point *C, /* Array with point pointers */
   return R;
 }
 
+/* A private copy of R, for copy on write. */
+ora
+copyORA(ora R
+	)
+{
+  ora C = malloc(sizeof(struct ora));
+
+  memcpy(C, R, sizeof(struct ora));
+  C->rc = 0;
+  C->A = malloc(C->a*(C->d+1)*sizeof(int));
+  memcpy(C->A, R->A, C->o*(C->d+1)*sizeof(int));
+
+  return C;
+}
+
+/* Subtracts off[i] from coordinate i of every point */
+void
+rebaseORA(ora R,
+	  int *off /* The offsets */
+	  )
+{
+  for(int i = 0; i < R->o; i++)
+    for(int j = 0; j < R->d; j++)
+      R->A[i*(R->d+1)+1+j] -= off[j];
+}
+
 static int GLOBAL_dim;
 static int *GLOBAL_Array;
 
@@ -234,7 +261,12 @@ teleportORA(ora R, /* Tree node to traverse */
       }
     }
   }
-  freeORA(R);
+
+  if(0 < R->rc){ /* Other trees keep it */
+    R->rc--;
+    R->w *= -1; /* Signal it is an ora struct, again */
+  } else
+    freeORA(R);
 }
 
 /* Returns an array with the points that dominate
@@ -295,6 +327,30 @@ dominatedCollectORA(ora R, /* The orthogonal range array */
   }
 }
 
+int
+dominatedFindORA(ora R, /* The orthogonal range array */
+		 int *coords, /* Point coordinates, in LSD order. */
+		 point hp /* Temporary coords */
+		 )
+{
+  point p = NULL; /* Current pointer */
+
+  for(int i=0; NULL == p && i < R->o; i++){
+    p = &R->A[i*(R->d+1)];
+    if(0 >= p[0])
+      p = NULL;
+    for(int j=0; NULL != p && j < R->d; j++){
+      if(p[1+j] >= coords[j])
+	p = NULL;
+    }
+  }
+
+  if(NULL != p)
+    memcpy(hp, &p[1], R->d*sizeof(int));
+
+  return NULL != p;
+}
+
 void
 rangeCollectORA(ora R, /* The orthogonal range array */
 		int *C,   /* Array for storing points. */
@@ -326,6 +382,40 @@ rangeCollectORA(ora R, /* The orthogonal range array */
   }
 }
 
+void
+cornerCollectORA(ora R, /* The orthogonal range array */
+		 int *C,   /* Array for storing points. */
+		 int *minCoords, /* Point coordinates, in LSD order. */
+		 int *maxCoords, /* Point coordinates, in LSD order. */
+		 int *corner, /* Point coordinates, in LSD order. */
+		 int below, /* A higher coordinate is below corner */
+		 int maxdim,
+		 point hp, /* Temporary coords */
+		 int *n
+		 )
+{
+  point p; /* Current pointer */
+
+  for(int i=0; i < R->o; i++){
+    p = &R->A[i*(R->d+1)];
+    int in = below;
+    for(int j=0; NULL != p && j < R->d; j++){
+      if(p[1+j] >= maxCoords[j] || p[1+j] < minCoords[j])
+	p = NULL;
+      else
+	in = in || p[1+j] < corner[j];
+    }
+    if(NULL != p && in){
+      for(int k = 0; k < p[0]; k++){
+	assert(1 == p[0] && "Missed point rep.");
+	memcpy(&(C[(*n)*maxdim]), &p[1], R->d*sizeof(int));
+	memcpy(&(C[(*n)*maxdim+R->d]), &hp[R->d], (maxdim-R->d)*sizeof(int));
+	(*n)++;
+      }
+    }
+  }
+}
+
 
 void
 insertORA(ora R, /* The orthogonal range tree */
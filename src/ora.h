@@ -73,6 +73,19 @@ buildORA(point *C, /* Array with point pointers */
 	 int dim /* Current dimension */
 	 );
 
+/* A private copy of R, for copy on write. */
+ora
+copyORA(ora R
+	);
+
+/* Subtracts off[i] from coordinate i of every point */
+void
+rebaseORA(ora R,
+	  int *off /* The offsets */
+	  );
+
+/* Copies the points, if cp, and frees R. A shared R only loses one
+   owner. */
 void
 teleportORA(ora R, /* Tree node to traverse */
             int *C, /* Array for storing points and multipls */
@@ -105,6 +118,20 @@ rangeCollectORA(ora R, /* The orthogonal range array */
 		int *n
 		);
 
+/* As rangeCollectORA, but only the points below corner in some
+   coordinate, unless below is already true. */
+void
+cornerCollectORA(ora R, /* The orthogonal range array */
+		 int *C,   /* Array for storing points. */
+		 int *minCoords, /* Point coordinates, in LSD order. */
+		 int *maxCoords, /* Point coordinates, in LSD order. */
+		 int *corner, /* Point coordinates, in LSD order. */
+		 int below, /* A higher coordinate is below corner */
+		 int maxdim,
+		 point hp, /* Temporary coords */
+		 int *n
+		 );
+
 /* Copy to array the points dominated by
    the coordinates. */
 void
@@ -116,6 +143,14 @@ dominatedCollectORA(ora R, /* The orthogonal range array */
 	   int *n
            );
 
+/* Copy to hp one point dominated by the coordinates.
+   Returns 0 if there is none. */
+int
+dominatedFindORA(ora R, /* The orthogonal range array */
+		 int *coords, /* Point coordinates, in LSD order. */
+		 point hp /* Temporary coords */
+		 );
+
 void
 insertORA(ora R, /* The orthogonal range tree */
           point p,
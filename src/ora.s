@@ -0,0 +1,1661 @@
+	.file	"ora.c"
+	.text
+	.p2align 4
+	.type	lastCCompare, @function
+lastCCompare:
+.LFB33:
+	.cfi_startproc
+	movl	GLOBAL_dim(%rip), %eax
+	movq	%rsi, %rdx
+	movq	GLOBAL_Array(%rip), %rsi
+	movl	(%rdx), %edx
+	leal	1(%rax), %ecx
+	movl	(%rdi), %eax
+	addl	$1, %edx
+	addl	$1, %eax
+	imull	%ecx, %edx
+	imull	%ecx, %eax
+	movslq	%edx, %rdx
+	cltq
+	movl	-4(%rsi,%rax,4), %eax
+	subl	-4(%rsi,%rdx,4), %eax
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	lastCCompare, .-lastCCompare
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"m%x [label=%c0x%x | w: %d| d: %d| o: %d| a: %d| A: "
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"%d, "
+.LC2:
+	.string	") "
+.LC3:
+	.string	"%c]"
+	.text
+	.p2align 4
+	.globl	dsRnORA
+	.type	dsRnORA, @function
+dsRnORA:
+.LFB22:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	%edi, %edx
+	movl	%edi, %r8d
+	movl	$34, %ecx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	leaq	.LC0(%rip), %rsi
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 72
+	movl	16(%rdi), %eax
+	pushq	%rax
+	.cfi_def_cfa_offset 80
+	movl	12(%rdi), %eax
+	pushq	%rax
+	.cfi_def_cfa_offset 88
+	movl	8(%rdi), %eax
+	pushq	%rax
+	.cfi_def_cfa_offset 96
+	movl	(%rdi), %r9d
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	call	fprintf@PLT
+	movl	12(%r14), %eax
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	testl	%eax, %eax
+	jle	.L4
+	xorl	%ebx, %ebx
+	leaq	.LC2(%rip), %r13
+	leaq	.LC1(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	movq	%rbp, %rsi
+	movl	$40, %edi
+	call	fputc@PLT
+	movl	8(%r14), %eax
+	testl	%eax, %eax
+	js	.L5
+	xorl	%r15d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	addl	$1, %eax
+	movq	24(%r14), %rdx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	imull	%ebx, %eax
+	addl	%r15d, %eax
+	addl	$1, %r15d
+	cltq
+	movl	(%rdx,%rax,4), %edx
+	xorl	%eax, %eax
+	call	fprintf@PLT
+	movl	8(%r14), %eax
+	cmpl	%r15d, %eax
+	jge	.L6
+.L5:
+	movq	%rbp, %rcx
+	movl	$2, %edx
+	movl	$1, %esi
+	movq	%r13, %rdi
+	call	fwrite@PLT
+	addl	$1, %ebx
+	cmpl	%ebx, 12(%r14)
+	jg	.L7
+.L4:
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 56
+	movq	%rbp, %rdi
+	movl	$34, %edx
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	leaq	.LC3(%rip), %rsi
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	fprintf@PLT
+	.cfi_endproc
+.LFE22:
+	.size	dsRnORA, .-dsRnORA
+	.p2align 4
+	.globl	allocORA
+	.type	allocORA, @function
+allocORA:
+.LFB23:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$32, %esi
+	movl	%edi, %ebp
+	movl	$1, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	call	calloc@PLT
+	leal	2(%rbp,%rbp), %edi
+	movl	%ebp, 8(%rax)
+	movslq	%edi, %rdi
+	movq	%rax, %rbx
+	movl	$2, 16(%rax)
+	salq	$2, %rdi
+	call	malloc@PLT
+	movq	%rax, 24(%rbx)
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	allocORA, .-allocORA
+	.p2align 4
+	.globl	freeORA
+	.type	freeORA, @function
+freeORA:
+.LFB24:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	movq	24(%rdi), %rdi
+	call	free@PLT
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT
+	.cfi_endproc
+.LFE24:
+	.size	freeORA, .-freeORA
+	.p2align 4
+	.globl	checkORA
+	.type	checkORA, @function
+checkORA:
+.LFB25:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	checkORA, .-checkORA
+	.p2align 4
+	.globl	weightORA
+	.type	weightORA, @function
+weightORA:
+.LFB26:
+	.cfi_startproc
+	movl	(%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	weightORA, .-weightORA
+	.p2align 4
+	.globl	countQORA
+	.type	countQORA, @function
+countQORA:
+.LFB28:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movl	12(%rdi), %r11d
+	testl	%r11d, %r11d
+	jle	.L23
+	movl	8(%rdi), %r8d
+	movq	24(%rdi), %rdx
+	leal	1(%r8), %r10d
+	testl	%r8d, %r8d
+	movslq	%r10d, %r10
+	setg	%bl
+	xorl	%edi, %edi
+	xorl	%ebp, %ebp
+	salq	$2, %r10
+	jmp	.L22
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	addl	$1, %edi
+	addq	%r10, %rdx
+	cmpl	%r11d, %edi
+	je	.L17
+.L22:
+	movl	(%rdx), %r9d
+	testl	%r9d, %r9d
+	jle	.L19
+	testb	%bl, %bl
+	je	.L19
+	movl	$1, %eax
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	movl	-4(%rsi,%rax,4), %ecx
+	cmpl	%ecx, (%rdx,%rax,4)
+	jge	.L20
+	movl	%eax, %ecx
+	addq	$1, %rax
+	cmpl	%ecx, %r8d
+	jg	.L21
+.L19:
+	addl	$1, %edi
+	addl	%r9d, %ebp
+	addq	%r10, %rdx
+	cmpl	%r11d, %edi
+	jne	.L22
+.L17:
+	movl	%ebp, %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L23:
+	.cfi_restore_state
+	xorl	%ebp, %ebp
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	movl	%ebp, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	countQORA, .-countQORA
+	.p2align 4
+	.globl	containsQORA
+	.type	containsQORA, @function
+containsQORA:
+.LFB29:
+	.cfi_startproc
+	movl	12(%rdi), %r9d
+	xorl	%r8d, %r8d
+	jmp	.L34
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	addl	$1, %r8d
+.L34:
+	cmpl	%r8d, %r9d
+	jle	.L44
+	movslq	8(%rdi), %rdx
+	movq	24(%rdi), %rcx
+	leal	1(%rdx), %eax
+	imull	%r8d, %eax
+	cltq
+	leaq	(%rcx,%rax,4), %rcx
+	testq	%rcx, %rcx
+	je	.L35
+	testl	%edx, %edx
+	jle	.L39
+	salq	$2, %rdx
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	movl	(%rsi,%rax), %r10d
+	cmpl	%r10d, 4(%rcx,%rax)
+	jne	.L35
+	addq	$4, %rax
+	cmpq	%rax, %rdx
+	jne	.L37
+.L39:
+	movl	$1, %eax
+	ret
+.L44:
+	xorl	%eax, %eax
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	containsQORA, .-containsQORA
+	.p2align 4
+	.globl	buildORA
+	.type	buildORA, @function
+buildORA:
+.LFB30:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	movl	$1, %edi
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movslq	%esi, %r13
+	movl	$32, %esi
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%r12d, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subl	%r13d, %ebp
+	movl	%ecx, %ebx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	call	calloc@PLT
+	movl	%ebx, 8(%rax)
+	movq	%rax, %r15
+	leal	1(%rbp), %eax
+	testl	%eax, %eax
+	movl	%eax, 12(%r15)
+	leal	(%rax,%rax), %edi
+	movl	$2, %eax
+	cmove	%eax, %edi
+	addl	$1, %ebx
+	movl	%edi, 16(%r15)
+	imull	%ebx, %edi
+	movslq	%edi, %rdi
+	salq	$2, %rdi
+	call	malloc@PLT
+	movq	%rax, 24(%r15)
+	cmpl	%r13d, %r12d
+	jl	.L45
+	movslq	%ebx, %r12
+	leaq	(%r14,%r13,8), %r14
+	xorl	%r13d, %r13d
+	salq	$2, %r12
+	jmp	.L48
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	movl	8(%r15), %ebx
+	movq	24(%r15), %rax
+	movq	%rdx, %r13
+	addl	$1, %ebx
+.L48:
+	imull	%r13d, %ebx
+	movq	(%r14,%r13,8), %rsi
+	movq	%r12, %rdx
+	movslq	%ebx, %rbx
+	leaq	(%rax,%rbx,4), %rdi
+	call	memcpy@PLT
+	movq	(%r14,%r13,8), %rax
+	leaq	1(%r13), %rdx
+	movl	(%rax), %eax
+	addl	%eax, (%r15)
+	cmpq	%r13, %rbp
+	jne	.L51
+.L45:
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 56
+	movq	%r15, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	buildORA, .-buildORA
+	.p2align 4
+	.globl	copyORA
+	.type	copyORA, @function
+copyORA:
+.LFB31:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	movl	$32, %edi
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	call	malloc@PLT
+	movdqu	(%r12), %xmm0
+	movl	16(%r12), %edi
+	movdqu	16(%r12), %xmm1
+	movq	%rax, %rbp
+	movups	%xmm0, (%rax)
+	movups	%xmm1, 16(%rax)
+	movl	$0, 4(%rax)
+	movl	8(%rax), %eax
+	leal	1(%rax), %ebx
+	imull	%ebx, %edi
+	movslq	%edi, %rdi
+	salq	$2, %rdi
+	call	malloc@PLT
+	imull	12(%rbp), %ebx
+	movq	24(%r12), %rsi
+	movq	%rax, 24(%rbp)
+	movq	%rax, %rdi
+	movslq	%ebx, %rdx
+	salq	$2, %rdx
+	call	memcpy@PLT
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	copyORA, .-copyORA
+	.p2align 4
+	.globl	rebaseORA
+	.type	rebaseORA, @function
+rebaseORA:
+.LFB32:
+	.cfi_startproc
+	movl	12(%rdi), %eax
+	testl	%eax, %eax
+	jle	.L54
+	movl	8(%rdi), %eax
+	xorl	%r9d, %r9d
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	testl	%eax, %eax
+	jle	.L54
+	movq	24(%rdi), %rcx
+	xorl	%edx, %edx
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	addl	$1, %eax
+	movl	(%rsi,%rdx,4), %r8d
+	imull	%r9d, %eax
+	leal	1(%rax,%rdx), %eax
+	addq	$1, %rdx
+	cltq
+	subl	%r8d, (%rcx,%rax,4)
+	movl	8(%rdi), %eax
+	cmpl	%edx, %eax
+	jg	.L57
+	addl	$1, %r9d
+	cmpl	12(%rdi), %r9d
+	jl	.L56
+.L54:
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	rebaseORA, .-rebaseORA
+	.p2align 4
+	.globl	teleportORA
+	.type	teleportORA, @function
+teleportORA:
+.LFB34:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	%rsi, (%rsp)
+	movl	96(%rsp), %esi
+	testl	%esi, %esi
+	je	.L62
+	leal	1(%rcx), %eax
+	movl	12(%rdi), %r12d
+	movq	%rdx, %rbp
+	movl	%ecx, %r15d
+	movl	%r8d, %ebx
+	cmpl	%r8d, %eax
+	je	.L63
+	testl	%r12d, %r12d
+	jle	.L62
+	movl	%r8d, %r13d
+	leal	2(%rcx), %eax
+	addl	$1, %ebx
+	xorl	%r15d, %r15d
+	subl	%ecx, %r13d
+	movslq	%eax, %r12
+	movl	%eax, 8(%rsp)
+	subl	$1, %r13d
+	salq	$2, %r12
+	movslq	%r13d, %r13
+	leaq	0(,%r13,4), %rax
+	xorl	%r13d, %r13d
+	movq	%rax, 16(%rsp)
+	leaq	-4(%r9,%r12), %rax
+	movq	%rax, 24(%rsp)
+	movl	(%rdx), %eax
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	imull	%ebx, %eax
+	movq	(%rsp), %rcx
+	movq	24(%r14), %rsi
+	movq	%r12, %rdx
+	addl	$1, %r13d
+	addq	%r15, %rsi
+	addq	%r12, %r15
+	cltq
+	leaq	(%rcx,%rax,4), %rdi
+	call	memcpy@PLT
+	movl	0(%rbp), %eax
+	movl	8(%rsp), %edx
+	movq	(%rsp), %rcx
+	movq	24(%rsp), %rsi
+	imull	%ebx, %eax
+	addl	%edx, %eax
+	movq	16(%rsp), %rdx
+	cltq
+	leaq	(%rcx,%rax,4), %rdi
+	call	memcpy@PLT
+	movl	0(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, 0(%rbp)
+	cmpl	%r13d, 12(%r14)
+	jg	.L75
+.L62:
+	movl	4(%r14), %eax
+	testl	%eax, %eax
+	jle	.L76
+	subl	$1, %eax
+	negl	(%r14)
+	movl	%eax, 4(%r14)
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L76:
+	.cfi_restore_state
+	movq	24(%r14), %rdi
+	call	free@PLT
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r14, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT
+	.p2align 4,,10
+	.p2align 3
+.L63:
+	.cfi_restore_state
+	movslq	%r12d, %rsi
+	leaq	0(,%rsi,4), %rdi
+	movq	%rsi, 8(%rsp)
+	call	malloc@PLT
+	testl	%r12d, %r12d
+	movq	8(%rsp), %rsi
+	movq	%rax, %r13
+	jle	.L72
+	leal	-1(%r12), %eax
+	cmpl	$2, %eax
+	jbe	.L78
+	movl	%r12d, %edx
+	movdqa	.LC4(%rip), %xmm0
+	movdqa	.LC5(%rip), %xmm2
+	movq	%r13, %rax
+	shrl	$2, %edx
+	salq	$4, %rdx
+	addq	%r13, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	movdqa	%xmm0, %xmm1
+	addq	$16, %rax
+	paddd	%xmm2, %xmm0
+	movups	%xmm1, -16(%rax)
+	cmpq	%rax, %rdx
+	jne	.L70
+	movl	%r12d, %eax
+	andl	$-4, %eax
+	testb	$3, %r12b
+	je	.L72
+.L69:
+	movslq	%eax, %rdx
+	movl	%eax, 0(%r13,%rdx,4)
+	leaq	0(,%rdx,4), %rcx
+	leal	1(%rax), %edx
+	cmpl	%r12d, %edx
+	jge	.L72
+	addl	$2, %eax
+	movl	%edx, 4(%r13,%rcx)
+	cmpl	%r12d, %eax
+	jge	.L72
+	movl	%eax, 8(%r13,%rcx)
+.L72:
+	movq	24(%r14), %rax
+	leaq	lastCCompare(%rip), %rcx
+	movl	$4, %edx
+	movq	%r13, %rdi
+	movl	%ebx, GLOBAL_dim(%rip)
+	movq	%rax, GLOBAL_Array(%rip)
+	call	qsort@PLT
+	movl	12(%r14), %eax
+	testl	%eax, %eax
+	jle	.L68
+	leal	2(%r15), %r12d
+	addl	$1, %ebx
+	xorl	%r15d, %r15d
+	movslq	%r12d, %rax
+	salq	$2, %rax
+	movq	%rax, 8(%rsp)
+	movl	0(%rbp), %eax
+	.p2align 4,,10
+	.p2align 3
+.L74:
+	imull	%ebx, %eax
+	movq	(%rsp), %rcx
+	movq	24(%r14), %rdx
+	cltq
+	leaq	(%rcx,%rax,4), %rdi
+	movl	0(%r13,%r15,4), %eax
+	addq	$1, %r15
+	imull	%r12d, %eax
+	cltq
+	leaq	(%rdx,%rax,4), %rsi
+	movq	8(%rsp), %rdx
+	call	memcpy@PLT
+	movl	0(%rbp), %eax
+	addl	$1, %eax
+	movl	%eax, 0(%rbp)
+	cmpl	%r15d, 12(%r14)
+	jg	.L74
+.L68:
+	movq	%r13, %rdi
+	call	free@PLT
+	jmp	.L62
+.L78:
+	xorl	%eax, %eax
+	jmp	.L69
+	.cfi_endproc
+.LFE34:
+	.size	teleportORA, .-teleportORA
+	.p2align 4
+	.globl	collectORA
+	.type	collectORA, @function
+collectORA:
+.LFB35:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movl	12(%rdi), %edi
+	movq	%r8, 24(%rsp)
+	movl	$0, 20(%rsp)
+	testl	%edi, %edi
+	jle	.L87
+	movq	%rsi, %r12
+	movq	%rdx, %r13
+	movl	%ecx, %ebx
+	movq	%r9, %r15
+	jmp	.L88
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	addl	$1, 20(%rsp)
+	movl	20(%rsp), %eax
+	cmpl	%edi, %eax
+	jge	.L87
+.L88:
+	movslq	8(%rbp), %rdx
+	movl	20(%rsp), %esi
+	movq	24(%rbp), %rcx
+	leal	1(%rdx), %eax
+	imull	%esi, %eax
+	cltq
+	leaq	(%rcx,%rax,4), %rcx
+	testq	%rcx, %rcx
+	je	.L89
+	testl	%edx, %edx
+	jle	.L90
+	movslq	%edx, %rsi
+	xorl	%eax, %eax
+	salq	$2, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	movl	0(%r13,%rax), %r10d
+	cmpl	%r10d, 4(%rcx,%rax)
+	jle	.L89
+	addq	$4, %rax
+	cmpq	%rax, %rsi
+	jne	.L91
+.L90:
+	movl	(%rcx), %eax
+	testl	%eax, %eax
+	jle	.L89
+	leaq	4(%rcx), %rax
+	xorl	%r14d, %r14d
+	movq	%rax, 8(%rsp)
+	movl	(%r15), %eax
+	jmp	.L93
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	movslq	8(%rbp), %rdx
+.L93:
+	imull	%ebx, %eax
+	movq	8(%rsp), %rsi
+	salq	$2, %rdx
+	movq	%rcx, (%rsp)
+	addl	$1, %r14d
+	cltq
+	leaq	(%r12,%rax,4), %rdi
+	call	memcpy@PLT
+	movl	(%r15), %edx
+	movslq	8(%rbp), %rax
+	movq	24(%rsp), %rcx
+	imull	%ebx, %edx
+	leaq	(%rcx,%rax,4), %rsi
+	addl	%eax, %edx
+	movslq	%edx, %rdx
+	leaq	(%r12,%rdx,4), %rdi
+	movl	%ebx, %edx
+	subl	%eax, %edx
+	movslq	%edx, %rdx
+	salq	$2, %rdx
+	call	memcpy@PLT
+	movl	(%r15), %eax
+	movq	(%rsp), %rcx
+	addl	$1, %eax
+	movl	%eax, (%r15)
+	cmpl	%r14d, (%rcx)
+	jg	.L92
+	addl	$1, 20(%rsp)
+	movl	12(%rbp), %edi
+	movl	20(%rsp), %eax
+	cmpl	%edi, %eax
+	jl	.L88
+.L87:
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE35:
+	.size	collectORA, .-collectORA
+	.p2align 4
+	.globl	dominatedCollectORA
+	.type	dominatedCollectORA, @function
+dominatedCollectORA:
+.LFB36:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movl	12(%rdi), %edi
+	movq	%r8, 24(%rsp)
+	movl	$0, 20(%rsp)
+	testl	%edi, %edi
+	jle	.L103
+	movq	%rsi, %r12
+	movq	%rdx, %r13
+	movl	%ecx, %ebx
+	movq	%r9, %r15
+	jmp	.L104
+	.p2align 4,,10
+	.p2align 3
+.L105:
+	addl	$1, 20(%rsp)
+	movl	20(%rsp), %eax
+	cmpl	%edi, %eax
+	jge	.L103
+.L104:
+	movslq	8(%rbp), %rdx
+	movl	20(%rsp), %esi
+	movq	24(%rbp), %rcx
+	leal	1(%rdx), %eax
+	imull	%esi, %eax
+	cltq
+	leaq	(%rcx,%rax,4), %rcx
+	testq	%rcx, %rcx
+	je	.L105
+	testl	%edx, %edx
+	jle	.L106
+	movslq	%edx, %rsi
+	xorl	%eax, %eax
+	salq	$2, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	movl	0(%r13,%rax), %r10d
+	cmpl	%r10d, 4(%rcx,%rax)
+	jge	.L105
+	addq	$4, %rax
+	cmpq	%rax, %rsi
+	jne	.L107
+.L106:
+	movl	(%rcx), %eax
+	testl	%eax, %eax
+	jle	.L105
+	leaq	4(%rcx), %rax
+	xorl	%r14d, %r14d
+	movq	%rax, 8(%rsp)
+	movl	(%r15), %eax
+	jmp	.L109
+	.p2align 4,,10
+	.p2align 3
+.L108:
+	movslq	8(%rbp), %rdx
+.L109:
+	imull	%ebx, %eax
+	movq	8(%rsp), %rsi
+	salq	$2, %rdx
+	movq	%rcx, (%rsp)
+	addl	$1, %r14d
+	cltq
+	leaq	(%r12,%rax,4), %rdi
+	call	memcpy@PLT
+	movl	(%r15), %edx
+	movslq	8(%rbp), %rax
+	movq	24(%rsp), %rcx
+	imull	%ebx, %edx
+	leaq	(%rcx,%rax,4), %rsi
+	addl	%eax, %edx
+	movslq	%edx, %rdx
+	leaq	(%r12,%rdx,4), %rdi
+	movl	%ebx, %edx
+	subl	%eax, %edx
+	movslq	%edx, %rdx
+	salq	$2, %rdx
+	call	memcpy@PLT
+	movl	(%r15), %eax
+	movq	(%rsp), %rcx
+	addl	$1, %eax
+	movl	%eax, (%r15)
+	cmpl	%r14d, (%rcx)
+	jg	.L108
+	addl	$1, 20(%rsp)
+	movl	12(%rbp), %edi
+	movl	20(%rsp), %eax
+	cmpl	%edi, %eax
+	jl	.L104
+.L103:
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	dominatedCollectORA, .-dominatedCollectORA
+	.p2align 4
+	.globl	dominatedFindORA
+	.type	dominatedFindORA, @function
+dominatedFindORA:
+.LFB37:
+	.cfi_startproc
+	movl	12(%rdi), %r11d
+	movq	%rdi, %r10
+	xorl	%edi, %edi
+	movq	%rdx, %r9
+	cmpl	%edi, %r11d
+	jle	.L131
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	jmp	.L124
+	.p2align 4,,10
+	.p2align 3
+.L121:
+	addl	$1, %edi
+	cmpl	%edi, %r11d
+	jle	.L132
+.L124:
+	movl	8(%r10), %r8d
+	movq	24(%r10), %rdx
+	leal	1(%r8), %eax
+	imull	%edi, %eax
+	cltq
+	leaq	(%rdx,%rax,4), %rdx
+	movl	(%rdx), %eax
+	testl	%eax, %eax
+	jle	.L121
+	testl	%r8d, %r8d
+	jle	.L122
+	movslq	%r8d, %rcx
+	xorl	%eax, %eax
+	salq	$2, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L123:
+	movl	(%rsi,%rax), %ebx
+	cmpl	%ebx, 4(%rdx,%rax)
+	jge	.L121
+	addq	$4, %rax
+	cmpq	%rax, %rcx
+	jne	.L123
+.L122:
+	movslq	%r8d, %rax
+	leaq	4(%rdx), %rsi
+	movq	%r9, %rdi
+	salq	$2, %rax
+	movq	%rax, %rdx
+	call	memcpy@PLT
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L132:
+	.cfi_restore_state
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+.L131:
+	.cfi_restore 3
+	xorl	%eax, %eax
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	dominatedFindORA, .-dominatedFindORA
+	.p2align 4
+	.globl	rangeCollectORA
+	.type	rangeCollectORA, @function
+rangeCollectORA:
+.LFB38:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	movl	12(%rdi), %r10d
+	movq	%rdx, 16(%rsp)
+	movq	112(%rsp), %r14
+	movq	%r9, 40(%rsp)
+	movl	$0, 36(%rsp)
+	testl	%r10d, %r10d
+	jle	.L133
+	movq	%rdi, %rbp
+	movq	%rsi, %r12
+	movq	%rcx, %r15
+	movl	%r8d, %ebx
+	jmp	.L134
+	.p2align 4,,10
+	.p2align 3
+.L135:
+	addl	$1, 36(%rsp)
+	movl	36(%rsp), %eax
+	cmpl	%r10d, %eax
+	jge	.L133
+.L134:
+	movslq	8(%rbp), %rdx
+	movl	36(%rsp), %ecx
+	movq	24(%rbp), %rsi
+	leal	1(%rdx), %eax
+	imull	%ecx, %eax
+	cltq
+	leaq	(%rsi,%rax,4), %r8
+	testq	%r8, %r8
+	je	.L135
+	testl	%edx, %edx
+	jle	.L136
+	movslq	%edx, %rdi
+	xorl	%eax, %eax
+	salq	$2, %rdi
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	movl	4(%r8,%rax), %esi
+	cmpl	(%r15,%rax), %esi
+	jge	.L135
+	movq	16(%rsp), %rcx
+	cmpl	(%rcx,%rax), %esi
+	jl	.L135
+	addq	$4, %rax
+	cmpq	%rax, %rdi
+	jne	.L137
+.L136:
+	movl	(%r8), %eax
+	testl	%eax, %eax
+	jle	.L135
+	leaq	4(%r8), %rax
+	xorl	%r13d, %r13d
+	movq	%rax, 24(%rsp)
+	movl	(%r14), %eax
+	jmp	.L139
+	.p2align 4,,10
+	.p2align 3
+.L138:
+	movslq	8(%rbp), %rdx
+.L139:
+	imull	%ebx, %eax
+	movq	24(%rsp), %rsi
+	salq	$2, %rdx
+	addl	$1, %r13d
+	movq	%r8, 8(%rsp)
+	cltq
+	leaq	(%r12,%rax,4), %rdi
+	call	memcpy@PLT
+	movl	(%r14), %edx
+	movslq	8(%rbp), %rax
+	movq	40(%rsp), %rcx
+	imull	%ebx, %edx
+	leaq	(%rcx,%rax,4), %rsi
+	addl	%eax, %edx
+	movslq	%edx, %rdx
+	leaq	(%r12,%rdx,4), %rdi
+	movl	%ebx, %edx
+	subl	%eax, %edx
+	movslq	%edx, %rdx
+	salq	$2, %rdx
+	call	memcpy@PLT
+	movl	(%r14), %eax
+	movq	8(%rsp), %r8
+	addl	$1, %eax
+	movl	%eax, (%r14)
+	cmpl	%r13d, (%r8)
+	jg	.L138
+	addl	$1, 36(%rsp)
+	movl	12(%rbp), %r10d
+	movl	36(%rsp), %eax
+	cmpl	%r10d, %eax
+	jl	.L134
+.L133:
+	addq	$56, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE38:
+	.size	rangeCollectORA, .-rangeCollectORA
+	.p2align 4
+	.globl	cornerCollectORA
+	.type	cornerCollectORA, @function
+cornerCollectORA:
+.LFB39:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	movl	12(%rdi), %r14d
+	movl	112(%rsp), %ebp
+	movq	128(%rsp), %r13
+	testl	%r14d, %r14d
+	jle	.L149
+	movl	%r9d, %edi
+	movq	%r8, %rax
+	movl	%r14d, 8(%rsp)
+	movq	%r15, %rbx
+	movl	%edi, %r8d
+	movq	%rsi, %r12
+	movq	%rdx, %r10
+	xorl	%r9d, %r9d
+	movq	%rcx, %r15
+	movq	%rax, %rdi
+	movq	%r13, %r14
+	jmp	.L150
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	movl	8(%rsp), %eax
+	addl	$1, %r9d
+	cmpl	%eax, %r9d
+	jge	.L149
+.L150:
+	movl	8(%rbx), %ecx
+	movq	24(%rbx), %rdx
+	leal	1(%rcx), %eax
+	imull	%r9d, %eax
+	cltq
+	leaq	(%rdx,%rax,4), %r13
+	testq	%r13, %r13
+	je	.L151
+	testl	%ecx, %ecx
+	jle	.L152
+	movslq	%ecx, %rsi
+	movl	%r8d, %r11d
+	xorl	%eax, %eax
+	salq	$2, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L154:
+	movl	4(%r13,%rax), %edx
+	cmpl	(%r15,%rax), %edx
+	jge	.L151
+	cmpl	(%r10,%rax), %edx
+	jl	.L151
+	testl	%r11d, %r11d
+	jne	.L161
+	cmpl	(%rdi,%rax), %edx
+	setl	%r11b
+	setl	%dl
+	movzbl	%r11b, %r11d
+.L153:
+	addq	$4, %rax
+	cmpq	%rax, %rsi
+	jne	.L154
+	testb	%dl, %dl
+	je	.L151
+.L156:
+	movl	0(%r13), %eax
+	testl	%eax, %eax
+	jle	.L151
+	leaq	4(%r13), %rax
+	xorl	%r11d, %r11d
+	movq	%r15, 24(%rsp)
+	movslq	%ecx, %rdx
+	movq	%rax, 8(%rsp)
+	movl	%r11d, %r15d
+	movl	(%r14), %eax
+	movl	%r9d, 40(%rsp)
+	movq	%r10, 16(%rsp)
+	movq	%rdi, 32(%rsp)
+	movl	%r8d, 44(%rsp)
+	jmp	.L158
+	.p2align 4,,10
+	.p2align 3
+.L157:
+	movslq	8(%rbx), %rdx
+.L158:
+	imull	%ebp, %eax
+	movq	8(%rsp), %rsi
+	salq	$2, %rdx
+	addl	$1, %r15d
+	cltq
+	leaq	(%r12,%rax,4), %rdi
+	call	memcpy@PLT
+	movl	(%r14), %edx
+	movslq	8(%rbx), %rax
+	movq	120(%rsp), %rcx
+	imull	%ebp, %edx
+	leaq	(%rcx,%rax,4), %rsi
+	addl	%eax, %edx
+	movslq	%edx, %rdx
+	leaq	(%r12,%rdx,4), %rdi
+	movl	%ebp, %edx
+	subl	%eax, %edx
+	movslq	%edx, %rdx
+	salq	$2, %rdx
+	call	memcpy@PLT
+	movl	(%r14), %eax
+	addl	$1, %eax
+	movl	%eax, (%r14)
+	cmpl	%r15d, 0(%r13)
+	jg	.L157
+	movl	12(%rbx), %eax
+	movl	40(%rsp), %r9d
+	movq	16(%rsp), %r10
+	movq	24(%rsp), %r15
+	movl	%eax, 8(%rsp)
+	movl	8(%rsp), %eax
+	addl	$1, %r9d
+	movq	32(%rsp), %rdi
+	movl	44(%rsp), %r8d
+	cmpl	%eax, %r9d
+	jl	.L150
+.L149:
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L161:
+	.cfi_restore_state
+	movl	$1, %edx
+	movl	$1, %r11d
+	jmp	.L153
+.L152:
+	testl	%r8d, %r8d
+	jne	.L156
+	jmp	.L151
+	.cfi_endproc
+.LFE39:
+	.size	cornerCollectORA, .-cornerCollectORA
+	.p2align 4
+	.globl	insertORA
+	.type	insertORA, @function
+insertORA:
+.LFB40:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movslq	8(%rdi), %rcx
+	movq	%rsi, %rbx
+	xorl	%esi, %esi
+	movl	12(%rdi), %r10d
+	movq	24(%rbp), %r8
+	movq	%rcx, %rdi
+	leal	1(%rcx), %r9d
+	salq	$2, %rcx
+	jmp	.L176
+	.p2align 4,,10
+	.p2align 3
+.L177:
+	addl	$1, %esi
+.L176:
+	cmpl	%esi, %r10d
+	jle	.L192
+	movl	%r9d, %eax
+	imull	%esi, %eax
+	cltq
+	leaq	(%r8,%rax,4), %rdx
+	testq	%rdx, %rdx
+	je	.L177
+	testl	%edi, %edi
+	jle	.L178
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L179:
+	movl	(%rbx,%rax), %r11d
+	cmpl	%r11d, 4(%rdx,%rax)
+	jne	.L177
+	addq	$4, %rax
+	cmpq	%rax, %rcx
+	jne	.L179
+.L178:
+	addl	%r12d, (%rdx)
+	addl	%r12d, 0(%rbp)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.L192:
+	.cfi_restore_state
+	cmpl	%r10d, 16(%rbp)
+	je	.L193
+.L184:
+	leal	1(%rdi), %eax
+	movq	%rbx, %rsi
+	imull	%r10d, %eax
+	cltq
+	movl	%r12d, (%r8,%rax,4)
+	movslq	8(%rbp), %rax
+	leal	1(%rax), %edx
+	imull	12(%rbp), %edx
+	movslq	%edx, %rdx
+	leaq	4(%r8,%rdx,4), %rdi
+	leaq	0(,%rax,4), %rdx
+	call	memcpy@PLT
+	addl	$1, 12(%rbp)
+	addl	%r12d, 0(%rbp)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.L193:
+	.cfi_restore_state
+	addl	%r10d, %r10d
+	leal	1(%rdi), %esi
+	movq	%r8, %rdi
+	imull	%r10d, %esi
+	movl	%r10d, 16(%rbp)
+	movslq	%esi, %rsi
+	salq	$2, %rsi
+	call	realloc@PLT
+	movl	12(%rbp), %r10d
+	movl	8(%rbp), %edi
+	movq	%rax, 24(%rbp)
+	movq	%rax, %r8
+	jmp	.L184
+	.cfi_endproc
+.LFE40:
+	.size	insertORA, .-insertORA
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB6:
+	.text
+.LHOTB6:
+	.p2align 4
+	.globl	deleteORA
+	.type	deleteORA, @function
+deleteORA:
+.LFB41:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	xorl	%ecx, %ecx
+	movl	12(%rdi), %r9d
+	movq	%rdi, %rbx
+	jmp	.L195
+	.p2align 4,,10
+	.p2align 3
+.L196:
+	addl	$1, %ecx
+.L195:
+	cmpl	%ecx, %r9d
+	jle	.L213
+	movslq	8(%rbx), %rdx
+	movq	24(%rbx), %r8
+	leal	1(%rdx), %eax
+	imull	%ecx, %eax
+	cltq
+	leaq	(%r8,%rax,4), %rdi
+	testq	%rdi, %rdi
+	je	.L196
+	testl	%edx, %edx
+	jle	.L197
+	salq	$2, %rdx
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L198:
+	movl	(%rsi,%rax), %r10d
+	cmpl	%r10d, 4(%rdi,%rax)
+	jne	.L196
+	addq	$4, %rax
+	cmpq	%rax, %rdx
+	jne	.L198
+.L197:
+	subl	$1, (%rbx)
+	subl	$1, (%rdi)
+	jne	.L202
+	movl	12(%rbx), %eax
+	movl	8(%rbx), %ecx
+	subl	$1, %eax
+	leal	1(%rcx), %edx
+	movl	%eax, %ecx
+	movl	%eax, 12(%rbx)
+	imull	%edx, %ecx
+	movslq	%ecx, %rcx
+	leaq	(%r8,%rcx,4), %rsi
+	cmpq	%rdi, %rsi
+	je	.L203
+	movslq	%edx, %rdx
+	salq	$2, %rdx
+	call	memcpy@PLT
+	movl	12(%rbx), %eax
+.L203:
+	testl	%eax, %eax
+	jle	.L202
+	movl	16(%rbx), %edx
+	addl	%eax, %eax
+	cmpl	%edx, %eax
+	jl	.L214
+.L202:
+	movl	(%rbx), %edx
+	xorl	%eax, %eax
+	testl	%edx, %edx
+	je	.L215
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L215:
+	.cfi_restore_state
+	movq	24(%rbx), %rdi
+	call	free@PLT
+	movq	%rbx, %rdi
+	movl	$32, %esi
+	call	bzero@PLT
+	movq	%rbx, %rdi
+	call	free@PLT
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L214:
+	.cfi_restore_state
+	movl	8(%rbx), %eax
+	sarl	%edx
+	movq	24(%rbx), %rdi
+	movl	%edx, 16(%rbx)
+	leal	1(%rax), %esi
+	imull	%edx, %esi
+	movslq	%esi, %rsi
+	salq	$2, %rsi
+	call	realloc@PLT
+	movq	%rax, 24(%rbx)
+	jmp	.L202
+.L213:
+	jmp	.L211
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.type	deleteORA.cold, @function
+deleteORA.cold:
+.LFSB41:
+.L211:
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subl	$1, (%rbx)
+	movl	0, %eax
+	ud2
+	.cfi_endproc
+.LFE41:
+	.text
+	.size	deleteORA, .-deleteORA
+	.section	.text.unlikely
+	.size	deleteORA.cold, .-deleteORA.cold
+.LCOLDE6:
+	.text
+.LHOTE6:
+	.local	GLOBAL_Array
+	.comm	GLOBAL_Array,8,8
+	.local	GLOBAL_dim
+	.comm	GLOBAL_dim,4,4
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC4:
+	.long	0
+	.long	1
+	.long	2
+	.long	3
+	.align 16
+.LC5:
+	.long	4
+	.long	4
+	.long	4
+	.long	4
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -41,6 +41,7 @@ sub-sequence algorithm. The binary search trees are weight balanced.
 #include <bsd/stdlib.h>
 #include <stdio.h>
 #include <assert.h>
+#include <limits.h>
 
 #include "point.h"
 #include "ort.h"
@@ -59,6 +60,8 @@ struct node{
      v in the last dimension owns the point. */
   /* point v;    /\* Pointer to coordinates *\/ */
   int w;      /* Weight */
+  int rc;     /* Number of other trees that share it. Same
+		 position as in the ora struct. */
   int v;      /* coordinate in the tree */
   node left;  /* Sub-tree */
   node right; /* Sub-tree */
@@ -74,13 +77,20 @@ struct ort{ /* Orthogonal range tree */
   int *cache; /* The cache for balancing and iterators */
   int n;	/* Number of points in tree. */
   int ca;	/* Cache size. */
+  ort *lv;	/* Static levels of an insert only tree, or NULL */
+  int nlv;	/* Size of the lv array */
 };
 
+#ifndef GROW_BLOCK
+#define GROW_BLOCK 256 /* Size of the dynamic tree of insert only trees */
+#endif /* GROW_BLOCK */
+
 /* Basic tree configuration */
 static int mxd; /* Maximum allowed depth */
 static double *T; /* A table containing balance constants */
 static int cutoff; /* The cut-off value. If the number of elements
                       in a sub-tree is smaller then use an array. */
+static long rebuilt; /* Points moved by the rebuilds of subtrees */
 
 #ifndef NDEBUG
 void
@@ -178,6 +188,13 @@ adjustCut(int param)
   return R;
 }
 
+long
+rebuiltORT(void
+	   )
+{
+  return rebuilt;
+}
+
 int
 weightORT(ort rt
 	  )
@@ -185,6 +202,9 @@ weightORT(ort rt
   int r = 0;
   if(NULL != rt->root)
     r = abs(rt->root->w);
+  for(int i = 0; i < rt->nlv; i++)
+    if(NULL != rt->lv[i])
+      r += weightORT(rt->lv[i]);
 
   return r;
 }
@@ -270,7 +290,12 @@ countQ(ort rt, /* The orthogonal range tree */
        int* coords /* Point coordinates, in LSD order. */
        )
 {
-  return countR(rt->root, coords, rt->d-1);
+  int r = countR(rt->root, coords, rt->d-1);
+  for(int i = 0; i < rt->nlv; i++)
+    if(NULL != rt->lv[i])
+      r += countQ(rt->lv[i], coords);
+
+  return r;
 }
 
 int
@@ -278,6 +303,10 @@ containsQ(ort rt, /* The orthogonal range tree */
 	  int* coords /* Point coordinates, in LSD order. */
 	  )
 {
+  for(int i = 0; i < rt->nlv; i++)
+    if(NULL != rt->lv[i] && containsQ(rt->lv[i], coords))
+      return 1;
+
   /* dotShow(rt->root); */
   node t = rt->root;
   int dim = rt->d-1;
@@ -408,6 +437,24 @@ checkTree(node t, int dim)
 }
 #endif /* NDEBUG */
 
+/* Appends the m points of L to the n points of R, frees L. */
+static point *
+joinPoints(point *R,
+	   int *n,
+	   point *L,
+	   int m
+	   )
+{
+  if(0 < m){
+    R = realloc(R, (*n+m)*sizeof(point));
+    memcpy(&R[*n], L, m*sizeof(point));
+    *n += m;
+  }
+  free(L);
+
+  return R;
+}
+
 /* Recursive version. */
 
 static void
@@ -459,6 +506,13 @@ collect(ort rt, /* The orthogonal range tree */
     memcpy(R[i], &(rt->cache[i*rt->d]), rt->d*sizeof(int));
   }
 
+  for(int i = 0; i < rt->nlv; i++)
+    if(NULL != rt->lv[i]){
+      int m;
+      point *L = collect(rt->lv[i], coords, &m);
+      R = joinPoints(R, n, L, m);
+    }
+
   return R;
 }
 
@@ -513,9 +567,67 @@ dominatedCollect(ort rt, /* The orthogonal range tree */
     }
   }
 
+  for(int i = 0; i < rt->nlv; i++)
+    if(NULL != rt->lv[i]){
+      int m;
+      point *L = dominatedCollect(rt->lv[i], coords, &m);
+      R = joinPoints(R, n, L, m);
+    }
+
   return R;
 }
 
+/* Stops at the first point it finds. */
+static int
+dominatedFindR(node t,     /* The orthogonal range tree. */
+	       int *coords, /* Point coordinates, in LSD order. */
+	       int dim,    /* Current dimension */
+	       point hp /* Temporary coords */
+	       )
+{
+  int r = 0;
+
+  if(NULL != t){
+    if(0 >= t->w){ /* Means ORA struct */
+      t->w *= -1;
+      r = dominatedFindORA((ora)t, coords, hp);
+      t->w *= -1;
+    } else { /* Means inside tree. */
+      if(t->v < coords[dim]){
+	hp[dim] = t->v;
+	if(0 < dim)
+	  r = dominatedFindR(t->equal, coords, dim-1, hp);
+	else
+	  r = 0 < properW(t);
+	if(!r)
+	  r = dominatedFindR(t->right, coords, dim, hp);
+      }
+      if(!r)
+	r = dominatedFindR(t->left, coords, dim, hp);
+    }
+  }
+
+  return r;
+}
+
+int
+dominatedFind(ort rt, /* The orthogonal range tree */
+	      int* coords, /* Point coordinate */
+	      point p /* Gets the point */
+	      )
+{
+  int hp[rt->d];   /* temp memory */
+  int r = dominatedFindR(rt->root, coords, rt->d-1, hp);
+
+  if(r)
+    memcpy(p, hp, rt->d*sizeof(int));
+  for(int i = 0; !r && i < rt->nlv; i++)
+    if(NULL != rt->lv[i])
+      r = dominatedFind(rt->lv[i], coords, p);
+
+  return r;
+}
+
 static void
 rangeCollectR(node t,     /* The orthogonal range tree. */
 	      int *C,   /* Array for storing points. */
@@ -577,6 +689,174 @@ rangeCollect(ort rt, /* The orthogonal range tree */
     }
   }
 
+  for(int i = 0; i < rt->nlv; i++)
+    if(NULL != rt->lv[i]){
+      int m;
+      point *L = rangeCollect(rt->lv[i], minCoords, maxCoords, &m);
+      R = joinPoints(R, n, L, m);
+    }
+
+  return R;
+}
+
+static void
+cornerCollectR(node t,     /* The orthogonal range tree. */
+	       int *C,   /* Array for storing points. */
+	       int *minCoords, /* Point coordinates, in LSD order. */
+	       int *maxCoords, /* Point coordinates, in LSD order. */
+	       int *corner, /* Point coordinates, in LSD order. */
+	       int below, /* A higher coordinate is below corner */
+	       int dim,    /* Current dimension */
+	       int maxdim,
+	       point hp, /* Temporary coords */
+	       int *n
+	       )
+{
+  if(NULL != t){
+    if(0 >= t->w){ /* Means ORA struct */
+      t->w *= -1;
+      cornerCollectORA((ora)t, C, minCoords, maxCoords, corner, below,
+		       maxdim, hp, n);
+      t->w *= -1;
+    } else { /* Means inside tree. */
+      /* In the last dimension some coordinate must be below */
+      int max = maxCoords[dim];
+      if(0 == dim && !below && corner[0] < max)
+	max = corner[0];
+      if(t->v < max){
+	cornerCollectR(t->right, C, minCoords, maxCoords, corner, below,
+		       dim, maxdim, hp, n);
+	if(minCoords[dim] <= t->v){
+	  hp[dim] = t->v;
+	  if(0 < dim)
+	    cornerCollectR(t->equal, C, minCoords, maxCoords, corner,
+			   below || t->v < corner[dim], dim-1, maxdim, hp, n);
+	  else if(0 < properW(t)){
+	    assert(1 == properW(t) && "Missed point rep.");
+	    memcpy(&C[((*n)++)*maxdim], hp, maxdim*sizeof(int));
+	  }
+	}
+      }
+      if(minCoords[dim] <= t->v)
+	cornerCollectR(t->left, C, minCoords, maxCoords, corner, below,
+		       dim, maxdim, hp, n);
+    }
+  }
+}
+
+point *
+cornerCollect(ort rt, /* The orthogonal range tree */
+	      int* minCoords, /* Point coordinate */
+	      int* maxCoords, /* Point coordinate */
+	      int* corner, /* Point coordinate */
+	      int* n /* Number of points */
+	      )
+{
+  int hp[rt->d];   /* temp memory */
+  point *R = NULL; /* The result */
+  *n = 0;
+  cornerCollectR(rt->root, rt->cache, minCoords, maxCoords, corner, 0,
+		 rt->d-1, rt->d, hp, n);
+
+  if(0 < *n){
+    R = malloc(*n*sizeof(point));
+    for(int i = 0; i<*n; i++){
+      R[i] = malloc(rt->d*sizeof(int));
+      memcpy(R[i], &(rt->cache[i*rt->d]), rt->d*sizeof(int));
+    }
+  }
+
+  for(int i = 0; i < rt->nlv; i++)
+    if(NULL != rt->lv[i]){
+      int m;
+      point *L = cornerCollect(rt->lv[i], minCoords, maxCoords, corner, &m);
+      R = joinPoints(R, n, L, m);
+    }
+
+  return R;
+}
+
+/* A point index and its score, for sorting */
+struct scored{
+  double s;
+  int i;
+};
+
+/* Moves the n highest scores of A[0..w) to its start, in no order,
+   with Hoare's selection in expected O(w) time. */
+static void
+selectScored(struct scored *A,
+	     int w,
+	     int n
+	     )
+{
+  int l = 0;
+  int r = w-1;
+
+  while(l < r){
+    double s = A[l+(r-l)/2].s; /* Pivot */
+    int i = l;
+    int j = r;
+    while(i <= j){
+      while(A[i].s > s)
+	i++;
+      while(A[j].s < s)
+	j--;
+      if(i <= j){
+	struct scored t = A[i];
+	A[i++] = A[j];
+	A[j--] = t;
+      }
+    }
+    /* A[l..j] >= s >= A[i..r], and the scores between are s */
+    if(n-1 <= j)
+      r = j;
+    else if(i <= n-1)
+      l = i;
+    else
+      break;
+  }
+}
+
+point *
+evictWorst(ort rt, /* The orthogonal range tree */
+	   int k, /* Number of points to keep */
+	   double (*score)(point p, int d), /* Higher is evicted first */
+	   int* n /* Number of points */
+	   )
+{
+  assert(NULL == rt->lv && "Evicting from an insert only tree.");
+  int d = rt->d;
+  point *R = NULL; /* The result */
+  *n = 0;
+  if(weightORT(rt) <= k)
+    return R;
+
+  int hp[d];   /* temp memory */
+  int lo[d];
+  for(int i = 0; i < d; i++)
+    lo[i] = INT_MIN;
+  int w = 0;
+  collectR(rt->root, rt->cache, lo, d-1, d, hp, &w);
+
+  struct scored *A = malloc(w*sizeof(struct scored));
+  for(int i = 0; i < w; i++){
+    A[i].s = score(&(rt->cache[i*d]), d);
+    A[i].i = i;
+  }
+  *n = w-k;
+  selectScored(A, w, *n);
+
+  /* delete uses the cache, so copy the points out first */
+  R = malloc(*n*sizeof(point));
+  for(int i = 0; i < *n; i++){
+    R[i] = malloc(d*sizeof(int));
+    memcpy(R[i], &(rt->cache[A[i].i*d]), d*sizeof(int));
+  }
+  for(int i = 0; i < *n; i++)
+    delete(rt, R[i]);
+  free(A);
+
   return R;
 }
 
@@ -801,6 +1081,60 @@ buildBalanced(point *C, /* Array with point pointers */
   return root;
 }
 
+static int GLOBAL_dim; /* For lastCoordCmp */
+
+/* Orders the point pointers of buildORT by the last coordinate */
+static int
+lastCoordCmp(const void *pp,
+	     const void *pq
+	     )
+{
+  point p = *(point *)pp;
+  point q = *(point *)pq;
+
+  return p[GLOBAL_dim] - q[GLOBAL_dim];
+}
+
+ort
+buildORT(int dim, /* Number of dimensions */
+	 point *P, /* The points */
+	 int n /* Number of points */
+	 )
+{
+  ort rt = allocORT(dim);
+  if(0 == n)
+    return rt;
+
+  rt->n = n;
+  rt->ca = 1;
+  while(rt->ca <= n+1)
+    rt->ca *= 2;
+  rt->cache = malloc(rt->ca*(1+dim)*sizeof(int));
+
+  /* Same layout as teleport, the multiplicity and then the point */
+  int *C = rt->cache;
+  point *R = malloc(n*sizeof(point));
+  for(int i = 0; i < n; i++){
+    C[i*(dim+1)] = 1;
+    memcpy(&C[i*(dim+1)+1], P[i], dim*sizeof(int));
+    R[i] = &C[i*(dim+1)];
+  }
+  GLOBAL_dim = dim;
+  qsort(R, n, sizeof(point), lastCoordCmp);
+
+  int *Acc = accSum(R, n);
+  rt->root = buildBalanced(R, 0, n-1, dim-1, dim, Acc);
+  free(Acc);
+  free(R);
+
+#ifndef NDEBUG
+  assert(n == abs(rt->root->w) && "Missed point in build.");
+  checkTree(rt->root, rt->d-1);
+#endif /* NDEBUG */
+
+  return rt;
+}
+
 /* Copies the points in sub-tree to cache and deletes it. */
 static void
 teleportR(node t, /* Tree node to traverse */
@@ -817,8 +1151,21 @@ teleportR(node t, /* Tree node to traverse */
     t->w *= -1;
     teleportORA((ora)t, C, i, dim, mxdim, p, cp);
     /* No need to sign t->w. It is free by now. */
+  } else if(!cp && 0 < t->rc){ /* Other trees keep it */
+    t->rc--;
   } else { /* In tree */
     int wt = properW(t);
+    /* A shared node stays, its children are visited as shared. */
+    int shared = 0 < t->rc;
+    if(shared){
+      t->rc--;
+      if(NULL != t->left)
+	t->left->rc++;
+      if(NULL != t->equal)
+	t->equal->rc++;
+      if(NULL != t->right)
+	t->right->rc++;
+    }
 
     if(NULL != t->left)
       teleportR(t->left, C, i, dim, mxdim, p, cp);
@@ -827,7 +1174,8 @@ teleportR(node t, /* Tree node to traverse */
     if(0 < dim){
       if(NULL != t->equal) /* When there are equal points */
 	teleportR(t->equal, C, i, dim-1, mxdim, p, cp);
-      teleportR(t->lower, C, i, dim-1, mxdim, p, 0); /* Call for free */
+      if(!shared)
+	teleportR(t->lower, C, i, dim-1, mxdim, p, 0); /* Call for free */
     } else if(cp && 0 < wt){
       memcpy(&C[(*i)*(mxdim+1)+1], p, mxdim*sizeof(int));
       C[(*i)*(mxdim+1)] = wt;
@@ -837,10 +1185,12 @@ teleportR(node t, /* Tree node to traverse */
     if(NULL != t->right)
       teleportR(t->right, C, i, dim, mxdim, p, cp);
 
+    if(!shared){
 #ifdef NDEBUG
-    bzero(t, sizeof(struct node));
+      bzero(t, sizeof(struct node));
 #endif /* NDEBUG */
-    free(t); /* Delete over here. Avoids code duplication. */
+      free(t); /* Delete over here. Avoids code duplication. */
+    }
   }
 }
 
@@ -861,6 +1211,8 @@ teleport(node t, /* Tree node to traverse */
   int p[dim+1]; /* Current dimension rewrite */
 
   teleportR(t, C, i, dim, dim+1, p, cp);
+  if(cp) /* A subtree is built again */
+    rebuilt += *i;
   if(*i > 0 && cp){
     R = (point *)malloc(*i*sizeof(point));
     for(int j=0; j<*i; j++)
@@ -885,6 +1237,11 @@ freeORT(ort rt)
   if(NULL != rt->root)
     teleport(rt->root, NULL, &n, rt->d-1, 0);
 
+  for(int i = 0; i < rt->nlv; i++)
+    if(NULL != rt->lv[i])
+      freeORT(rt->lv[i]);
+  free(rt->lv);
+
   rt->d = 0;
   rt->root = NULL;
   free(rt->cache);
@@ -894,6 +1251,151 @@ freeORT(ort rt)
   free(rt);
 }
 
+ort
+allocORTGrow(int dim /* Number of dimensions */
+	     )
+{
+  ort r = allocORT(dim);
+  r->lv = calloc(1, sizeof(ort));
+  r->nlv = 1;
+
+  return r;
+}
+
+/* Copy on write. If other trees share *t it gets replaced by a
+   private copy, that shares the children instead. Call it before
+   changing a node; the pointer t must be in a private node. */
+static void
+ownNode(node *t
+	)
+{
+  if(NULL != *t && 0 < (*t)->rc){
+    node o = *t;
+    o->rc--; /* Also for ora structs */
+
+    if(0 >= o->w) /* Means ORA struct */
+      *t = (node)copyORA((ora)o);
+    else {
+      *t = malloc(sizeof(struct node));
+      memcpy(*t, o, sizeof(struct node));
+      (*t)->rc = 0;
+      if(NULL != o->left)
+	o->left->rc++;
+      if(NULL != o->right)
+	o->right->rc++;
+      if(NULL != o->equal)
+	o->equal->rc++;
+      if(NULL != o->lower)
+	o->lower->rc++;
+    }
+  }
+}
+
+ort
+forkORT(ort rt
+	)
+{
+  ort r = allocORT(rt->d);
+
+  r->root = rt->root;
+  if(NULL != r->root)
+    r->root->rc++;
+  r->n = rt->n;
+  r->ca = rt->ca;
+  if(0 < r->ca)
+    r->cache = malloc(r->ca*(1+r->d)*sizeof(int));
+
+  r->nlv = rt->nlv;
+  if(0 < r->nlv)
+    r->lv = calloc(r->nlv, sizeof(ort));
+  for(int i = 0; i < r->nlv; i++)
+    if(NULL != rt->lv[i])
+      r->lv[i] = forkORT(rt->lv[i]);
+
+  return r;
+}
+
+/* Moves the values of the sub-tree, shared nodes get copied first. */
+static void
+rebaseR(node *t, /* Pointer to the sub-tree, in a private node */
+	int *off, /* The offsets */
+	int dim /* Current dimension */
+	)
+{
+  if(NULL == *t)
+    return;
+
+  ownNode(t);
+  if(0 >= (*t)->w) /* In ORA struct */
+    rebaseORA((ora)*t, off);
+  else {
+    (*t)->v -= off[dim];
+    rebaseR(&(*t)->left, off, dim);
+    rebaseR(&(*t)->right, off, dim);
+    if(0 < dim){
+      rebaseR(&(*t)->equal, off, dim-1);
+      rebaseR(&(*t)->lower, off, dim-1);
+    }
+  }
+}
+
+void
+rebaseORT(ort rt,
+	  int *off /* The offsets */
+	  )
+{
+  rebaseR(&rt->root, off, rt->d-1);
+  for(int i = 0; i < rt->nlv; i++)
+    if(NULL != rt->lv[i])
+      rebaseORT(rt->lv[i], off);
+}
+
+/* Moves the points of the dynamic tree, and of the full levels
+   after it, into a new static level. Level k gets GROW_BLOCK*2^k
+   points, as in a binary counter. */
+static void
+spill(ort rt
+      )
+{
+  int d = rt->d;
+  int lo[d];
+  for(int i = 0; i < d; i++)
+    lo[i] = INT_MIN;
+
+  ort t = allocORT(d); /* Takes the dynamic tree */
+  t->root = rt->root;
+  t->n = rt->n;
+  t->ca = rt->ca;
+  t->cache = rt->cache;
+  rt->root = NULL;
+  rt->n = 0;
+  rt->ca = 0;
+  rt->cache = NULL;
+
+  int n;
+  point *P = collect(t, lo, &n);
+  freeORT(t);
+
+  int k = 0;
+  for(; k < rt->nlv && NULL != rt->lv[k]; k++){
+    int m;
+    point *L = collect(rt->lv[k], lo, &m);
+    P = joinPoints(P, &n, L, m);
+    freeORT(rt->lv[k]);
+    rt->lv[k] = NULL;
+  }
+
+  if(k == rt->nlv){
+    rt->nlv++;
+    rt->lv = realloc(rt->lv, rt->nlv*sizeof(ort));
+  }
+  rt->lv[k] = buildORT(d, P, n);
+
+  for(int i = 0; i < n; i++)
+    free(P[i]);
+  free(P);
+}
+
 /* A function to insert a point into the ort. */
 /* Recursive version. */
 
@@ -923,6 +1425,7 @@ insertR(node *t, /* Pointer to orthogonal range tree */
         int dim /* Current dimension */
         )
 {
+  ownNode(t);
   int emptyt = (*t == NULL); /* Inital t was empty */
   int equalFound = 0;
   int edgeFound = 0;
@@ -948,6 +1451,7 @@ insertR(node *t, /* Pointer to orthogonal range tree */
       }
       (*t)->w++; /* Add the new point to the total weight */
       t = sel; /* Execute move */
+      ownNode(t);
       depth++;
       sel = selectChild(*t, p, dim);
 
@@ -1022,6 +1526,7 @@ insertORAWrap(
 {
   if(NULL == *t)
     *t = (node)allocORA(dim+1);
+  ownNode(t);
 
   (*t)->w *= -1;
   insertORA((ora)(*t), p, 1);
@@ -1047,6 +1552,7 @@ insertCR(node *t, /* Pointer to orthogonal range tree */
         int dim /* Current dimension */
         )
 {
+  ownNode(t);
   if(NULL == *t || 0 >= (*t)->w)
     insertORAWrap(t, p, C, dim);   /* End function on else */
   else {
@@ -1071,6 +1577,7 @@ insertCR(node *t, /* Pointer to orthogonal range tree */
       }
       (*t)->w++; /* Add the new point to the total weight */
       t = sel; /* Execute move */
+      ownNode(t);
       depth++;
       sel = selectChild(*t, p, dim);
 
@@ -1166,6 +1673,9 @@ insert(ort rt,
   assert(containsQ(rt, p) && "Insert failed");
   checkTree(rt->root, rt->d-1);
 #endif /* NDEBUG */
+
+  if(NULL != rt->lv && GROW_BLOCK == rt->n)
+    spill(rt);
 }
 
 /* A function to delete a point from the ort. Note the function
@@ -1181,6 +1691,7 @@ deleteR(node *t, /* Pointer to orthogonal range tree */
 {
   assert(*t != NULL && "Deleting on empty tree");
 
+  ownNode(t);
   node *sel = selectChild(*t, p, dim); /* Select next */
   int nodeFound = (&((*t)->equal) == sel);
   /* Deleting on a found node keeps the balance, so that is
@@ -1197,6 +1708,7 @@ deleteR(node *t, /* Pointer to orthogonal range tree */
     }
     (*t)->w--; /* remove the point from the total weight */
     t = sel; /* Execute move */
+    ownNode(t);
     depth++;
 
     sel = selectChild(*t, p, dim);
@@ -1256,6 +1768,7 @@ deleteCR(node *t, /* Pointer to orthogonal range tree */
 {
   assert(*t != NULL && "Deleting on empty tree");
 
+  ownNode(t);
   if(0 >= (*t)->w){
     (*t)->w *= -1;
     if(deleteORA((ora)*t, p))
@@ -1288,6 +1801,7 @@ deleteCR(node *t, /* Pointer to orthogonal range tree */
       (*t)->w--; /* remove the point from the total weight */
       assert(0 < (*t)->w && "Deleting weight to 0");
       t = sel; /* Execute move */
+      ownNode(t);
       depth++;
 
       sel = selectChild(*t, p, dim);
@@ -1334,6 +1848,7 @@ deleteCR(node *t, /* Pointer to orthogonal range tree */
 	deleteCR(&((*t)->lower), depth, p, C, dim-1);
       }
       if(edgeFound && !nodeFound){
+	ownNode(sel);
 	(*sel)->w *= -1;
 	if(deleteORA((ora)*sel, p))
 	  *sel = NULL;
@@ -1353,6 +1868,7 @@ delete(ort rt,
   /* for(int i = 0; i < rt->d ; i++) */
   /*   printf(" %d,", p[i]); */
   /* printf("\n"); */
+  assert(NULL == rt->lv && "Deleting from an insert only tree.");
 #ifndef NDEBUG
   /* dotShow(rt->root); */
   checkTree(rt->root, rt->d-1);
@@ -50,11 +50,40 @@ ort
 allocORT(int dim /* Number of dimensions */
 	 );
 
+/* Create a new insert only ORT. Inserts go to a small tree that
+   spills into static balanced trees of doubling sizes, which are
+   never rebalanced. Queries visit every tree, delete is not
+   supported. */
+ort
+allocORTGrow(int dim /* Number of dimensions */
+	     );
+
 /* Free the corresponding struct*/
 void
 freeORT(ort rt
 	);
 
+/* A copy of the ORT that shares all the nodes with it, in O(1).
+   Nodes get copied only when insert or delete change them. */
+ort
+forkORT(ort rt
+	);
+
+/* Subtracts off[i] from coordinate i of every point. The order of the
+   points does not change, so the tree keeps its shape and only the
+   stored values move, in O(size) time. */
+void
+rebaseORT(ort rt,
+	  int *off /* The offsets */
+	  );
+
+/* Returns the number of points that the rebuilds of unbalanced
+   subtrees moved so far, over every tree. The difference over an
+   update is the part of its cost that the rebuilds took. */
+long
+rebuiltORT(void
+	   );
+
 /* Returns the root weight */
 int
 weightORT(ort rt
@@ -75,6 +104,13 @@ containsQ(ort rt, /* The orthogonal range tree */
 
 #include "point.h"
 
+/* Create a balanced ORT with n different points, in one pass. */
+ort
+buildORT(int dim, /* Number of dimensions */
+	 point *P, /* The points */
+	 int n /* Number of points */
+	 );
+
 /* Returns an array with the points that dominate
    the coordinates. */
 point *
@@ -90,6 +126,14 @@ dominatedCollect(ort rt, /* The orthogonal range tree */
                  int* n /* Number of points */
                  );
 
+/* Stores in p one point that is dominated by the coords.
+   Returns 0 if there is none. */
+int
+dominatedFind(ort rt, /* The orthogonal range tree */
+	      int* coords, /* Point coordinate */
+	      point p /* Gets the point */
+	      );
+
 point *
 rangeCollect(ort rt, /* The orthogonal range tree */
 	     int* minCoords, /* Point coordinate */
@@ -97,6 +141,29 @@ rangeCollect(ort rt, /* The orthogonal range tree */
 	     int* n /* Number of points */
 	     );
 
+/* The points of the box [minCoords, maxCoords) that are below corner
+   in some coordinate. That is the union of the d boxes that clamp one
+   coordinate to the corner, each point reported once, in a single
+   traversal. */
+point *
+cornerCollect(ort rt, /* The orthogonal range tree */
+	      int* minCoords, /* Point coordinate */
+	      int* maxCoords, /* Point coordinate */
+	      int* corner, /* Point coordinate */
+	      int* n /* Number of points */
+	      );
+
+/* Deletes the points with the highest scores, until only k are
+   left, and returns them. The points are scored in one collect pass
+   and the worst are selected in expected linear time, without a full
+   sort. They go one by one, the tree is not rebuilt. */
+point *
+evictWorst(ort rt, /* The orthogonal range tree */
+	   int k, /* Number of points to keep */
+	   double (*score)(point p, int d), /* Higher is evicted first */
+	   int* n /* Number of points */
+	   );
+
 void
 insert(ort rt, /* The orthogonal range tree */
        point p
@@ -0,0 +1 @@
+../skyline.c
\ No newline at end of file
@@ -0,0 +1 @@
+../skyline.h
\ No newline at end of file
@@ -0,0 +1,411 @@
+/* BSD 2-Clause License */
+
+/* Copyright (c) 2020, Luís M. S. Russo */
+/* All rights reserved. */
+
+/* Redistribution and use in source and binary forms, with or without */
+/* modification, are permitted provided that the following conditions are met: */
+
+/* 1. Redistributions of source code must retain the above copyright notice, this */
+/*    list of conditions and the following disclaimer. */
+
+/* 2. Redistributions in binary form must reproduce the above copyright notice, */
+/*    this list of conditions and the following disclaimer in the documentation */
+/*    and/or other materials provided with the distribution. */
+
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <limits.h>
+
+#include "skyline.h"
+
+#define KILLER 1 /* The point can cover others */
+#define VICTIM 2 /* The point can be covered */
+
+struct skyline{
+  int d;   /* Dimension */
+  int n;   /* Number of candidates */
+  int a;   /* Alloced candidates */
+  point G; /* The candidates, d coordinates each */
+  int w;   /* Alloced work positions */
+  int *R;  /* Indexes of the points in the sub-problems */
+  int *B;  /* Scratch for selections and merges */
+  char *F; /* Killer and victim flags, per dimension and point */
+};
+
+skyline
+allocSK(int dim
+	)
+{
+  skyline K = calloc(1, sizeof(struct skyline));
+  K->d = dim;
+
+  return K;
+}
+
+void
+freeSK(skyline K
+       )
+{
+  free(K->G);
+  free(K->R);
+  free(K->B);
+  free(K->F);
+  free(K);
+}
+
+/* Guarantee work memory for n points */
+static void
+reserveSK(skyline K,
+	  int n
+	  )
+{
+  if(K->w < n){
+    while(K->w < n)
+      K->w = 0 == K->w ? 16 : 2*K->w;
+    free(K->R);
+    free(K->B);
+    free(K->F);
+    K->R = malloc(K->w*sizeof(int));
+    K->B = malloc(K->w*sizeof(int));
+    K->F = malloc(K->d*K->w*sizeof(char));
+  }
+}
+
+static int sortDim; /* For lexCmp */
+
+static int
+lexCmp(const void *pp,
+       const void *pq
+       )
+{
+  const int *p = pp;
+  const int *q = pq;
+
+  for(int i = 0; i < sortDim; i++)
+    if(p[i] != q[i])
+      return p[i] < q[i] ? -1 : 1;
+
+  return 0;
+}
+
+/* Value of rank k of B[0..n-1], B gets reordered */
+static int
+selectB(int *B,
+	int n,
+	int k
+	)
+{
+  int l = 0;
+  int r = n-1;
+
+  while(l < r){
+    int p = B[l+(r-l)/2]; /* Pivot */
+    int i = l;
+    int j = r;
+    while(i <= j){
+      while(B[i] < p)
+	i++;
+      while(B[j] > p)
+	j--;
+      if(i <= j){
+	int t = B[i];
+	B[i] = B[j];
+	B[j] = t;
+	i++;
+	j--;
+      }
+    }
+    if(k <= j)
+      r = j;
+    else if(i <= k)
+      l = i;
+    else
+      break;
+  }
+
+  return B[k];
+}
+
+/* Removes the covered points of the sub-problem of the n indexes
+   that start at R[lo], which are sorted as G. Only the killers of
+   dimension L cover and only its victims get covered, on the first
+   L coordinates. The points that are left go to the start, still
+   sorted, and their number is returned. As in QuickDP the points are
+   split on the median of coordinate L-1, each half is solved and the
+   lower half then covers the upper one on L-1 coordinates. */
+static int
+minimaR(skyline K,
+	point G, /* The points, sorted */
+	int lo,
+	int n,
+	int L /* Sub-problem dimension */
+	)
+{
+  int d = K->d;
+  int *R = &K->R[lo];
+  char *F = &K->F[(L-1)*K->w];
+  int m = 0; /* Points that are left */
+
+  if(2 > n)
+    return n;
+
+  switch(L){
+  case 1: /* The first killer covers the victims after it */
+    {
+      int found = 0;
+      for(int i = 0; i < n; i++){
+	if(!found || !(F[R[i]] & VICTIM))
+	  R[m++] = R[i];
+	found = found || (F[R[i]] & KILLER);
+      }
+    }
+    break;
+
+  case 2: /* Sweep with the least coordinate 1 of the killers */
+    {
+      int smin = INT_MAX;
+      for(int i = 0; i < n; i++){
+	int c = G[R[i]*d+1];
+	if((F[R[i]] & KILLER) && c < smin){
+	  smin = c;
+	  R[m++] = R[i];
+	} else if(!(F[R[i]] & VICTIM) || c < smin)
+	  R[m++] = R[i];
+      }
+    }
+    break;
+
+  default:
+    {
+      int *B = K->B;
+      char *Fl = &K->F[(L-2)*K->w]; /* Flags of dimension L-1 */
+
+      for(int i = 0; i < n; i++)
+	B[i] = G[R[i]*d+L-1];
+      int med = selectB(B, n, n/2);
+      int less = 0;
+      int more = 0;
+      for(int i = 0; i < n; i++){
+	less += G[R[i]*d+L-1] < med;
+	more += G[R[i]*d+L-1] > med;
+      }
+      /* The points equal to the median go to the smaller side */
+      int s = med; /* The lower half is below s */
+      if(less < more)
+	s = med+1;
+
+      if(0 == less && 0 == more){ /* All equal, drop the coordinate */
+	for(int i = 0; i < n; i++)
+	  Fl[R[i]] = F[R[i]];
+	m = minimaR(K, G, lo, n, L-1);
+      } else {
+	int nl = 0;
+	int nh = 0;
+	for(int i = 0; i < n; i++){
+	  if(G[R[i]*d+L-1] < s)
+	    R[nl++] = R[i];
+	  else
+	    B[nh++] = R[i];
+	}
+	memcpy(&R[nl], B, nh*sizeof(int));
+
+	int ml = minimaR(K, G, lo, nl, L);
+	int mh = minimaR(K, G, lo+nl, nh, L);
+	memmove(&R[ml], &R[nl], mh*sizeof(int));
+
+	/* The lower half covers the upper one */
+	for(int i = 0; i < ml; i++)
+	  Fl[R[i]] = F[R[i]] & KILLER;
+	for(int i = ml; i < ml+mh; i++)
+	  Fl[R[i]] = F[R[i]] & VICTIM;
+
+	/* Merge back into the order of G */
+	memcpy(B, R, (ml+mh)*sizeof(int));
+	int i = 0;
+	int j = ml;
+	while(i < ml || j < ml+mh){
+	  if(j == ml+mh || (i < ml && B[i] < B[j]))
+	    R[m++] = B[i++];
+	  else
+	    R[m++] = B[j++];
+	}
+
+	m = minimaR(K, G, lo, m, L-1);
+      }
+    }
+    break;
+  }
+
+  return m;
+}
+
+#ifndef NDEBUG
+/* True if p covers q */
+static int
+coversQ(point p,
+	point q,
+	int d
+	)
+{
+  int covers = 1;
+  for(int i = 0; covers && i < d; i++)
+    covers = p[i] <= q[i];
+
+  return covers;
+}
+
+/* Every point of O is in G or covered by one, and no point of G
+   covers another */
+static void
+checkSK(int d,
+	point O, /* The original points */
+	int n,
+	point G, /* The minima */
+	int m
+	)
+{
+  for(int i = 0; i < m; i++)
+    for(int j = 0; j < m; j++)
+      assert((i == j || !coversQ(&G[i*d], &G[j*d], d))
+	     && "Covered point in the minima.");
+
+  for(int i = 0; i < n; i++){
+    int covered = 0;
+    for(int j = 0; !covered && j < m; j++)
+      covered = coversQ(&G[j*d], &O[i*d], d);
+    assert(covered && "Lost a minimum.");
+  }
+}
+#endif /* NDEBUG */
+
+int
+skylineSK(skyline K,
+	  point G, /* The points, dim coordinates each */
+	  int n
+	  )
+{
+  int d = K->d;
+
+  if(0 == n)
+    return 0;
+
+#ifndef NDEBUG
+  point O = malloc(n*d*sizeof(int));
+  memcpy(O, G, n*d*sizeof(int));
+#endif /* NDEBUG */
+
+  sortDim = d;
+  qsort(G, n, d*sizeof(int), lexCmp);
+
+  /* Removing duplicates */
+  int t = n;
+  n = 1;
+  for(int i = 1; i < t; i++){
+    if(0 != lexCmp(&G[(n-1)*d], &G[i*d])){
+      if(n < i)
+	memcpy(&G[n*d], &G[i*d], d*sizeof(int));
+      n++;
+    }
+  }
+
+  reserveSK(K, n);
+  char *F = &K->F[(d-1)*K->w];
+  for(int i = 0; i < n; i++){
+    K->R[i] = i;
+    F[i] = KILLER | VICTIM;
+  }
+
+  int m = minimaR(K, G, 0, n, d);
+  for(int k = 0; k < m; k++)
+    if(k < K->R[k])
+      memcpy(&G[k*d], &G[K->R[k]*d], d*sizeof(int));
+
+#ifndef NDEBUG
+  checkSK(d, O, t, G, m);
+  free(O);
+#endif /* NDEBUG */
+
+  return m;
+}
+
+void
+clearSK(skyline K
+	)
+{
+  K->n = 0;
+}
+
+void
+addSK(skyline K,
+      point p
+      )
+{
+  if(K->n == K->a){
+    K->a = 0 == K->a ? 16 : 2*K->a;
+    K->G = realloc(K->G, K->a*K->d*sizeof(int));
+  }
+  memcpy(&K->G[K->n*K->d], p, K->d*sizeof(int));
+  K->n++;
+}
+
+int
+sizeSK(skyline K
+       )
+{
+  return K->n;
+}
+
+int
+minimaSK(skyline K
+	 )
+{
+  K->n = skylineSK(K, K->G, K->n);
+
+  return K->n;
+}
+
+point
+pointSK(skyline K,
+	int i
+	)
+{
+  assert(0 <= i && i < K->n && "Candidate out of range.");
+
+  return &K->G[i*K->d];
+}
+
+int
+findSK(skyline K,
+       point p
+       )
+{
+  int l = 0;
+  int r = K->n;
+
+  sortDim = K->d;
+  while(l < r){
+    int h = l+(r-l)/2;
+    int c = lexCmp(&K->G[h*K->d], p);
+    if(0 == c)
+      return 1;
+    if(c < 0)
+      l = h+1;
+    else
+      r = h;
+  }
+
+  return 0;
+}
@@ -0,0 +1,88 @@
+/* BSD 2-Clause License */
+
+/* Copyright (c) 2020, Luís M. S. Russo */
+/* All rights reserved. */
+
+/* Redistribution and use in source and binary forms, with or without */
+/* modification, are permitted provided that the following conditions are met: */
+
+/* 1. Redistributions of source code must retain the above copyright notice, this */
+/*    list of conditions and the following disclaimer. */
+
+/* 2. Redistributions in binary form must reproduce the above copyright notice, */
+/*    this list of conditions and the following disclaimer in the documentation */
+/*    and/or other materials provided with the distribution. */
+
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" */
+/* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE */
+/* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE */
+/* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE */
+/* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL */
+/* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR */
+/* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER */
+/* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, */
+/* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE */
+/* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+#ifndef _SKYLINE_H
+#define _SKYLINE_H
+
+#include "point.h"
+
+/* Batch minima of flat point arrays, with the divide and conquer of
+   QuickDP in O(n log^{d-2} n). The work memory is kept between calls,
+   so once it is large enough a call does not allocate. */
+typedef struct skyline *skyline;
+
+skyline
+allocSK(int dim
+	);
+
+void
+freeSK(skyline K
+       );
+
+/* Keeps in G the minima of its n points, in lexicographic order,
+   and returns how many. A point that is equal to another one or
+   covers it is dropped. */
+int
+skylineSK(skyline K,
+	  point G, /* The points, dim coordinates each */
+	  int n
+	  );
+
+/* Drops the candidates */
+void
+clearSK(skyline K
+	);
+
+/* Stores a copy of p as a candidate */
+void
+addSK(skyline K,
+      point p
+      );
+
+/* Number of candidates */
+int
+sizeSK(skyline K
+       );
+
+/* Reduces the candidates to their minima, with skylineSK, and
+   returns how many */
+int
+minimaSK(skyline K
+	 );
+
+/* The i-th candidate */
+point
+pointSK(skyline K,
+	int i
+	);
+
+/* True if p is a candidate, only after minimaSK */
+int
+findSK(skyline K,
+       point p
+       );
+
+#endif  /* _SKYLINE_H */
@@ -25,6 +25,7 @@
 /* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 
 #include <stdlib.h>
+#include <string.h>
 #include <stdio.h>
 #include <assert.h>
 
@@ -56,6 +57,22 @@ listFree(sortedList L
   free(L);
 }
 
+sortedList
+listCopy(sortedList L
+	 )
+{
+  sortedList C = malloc(sizeof(struct sortedList));
+
+  memcpy(C, L, sizeof(struct sortedList));
+  C->A = NULL;
+  if(0 < C->al){
+    C->A = malloc(C->al*sizeof(int));
+    memcpy(C->A, L->A, C->al*sizeof(int));
+  }
+
+  return C;
+}
+
 static void
 listRes(sortedList L, /* The previous string */
 	int n     /* The new size */
@@ -98,6 +115,33 @@ listAppend(sortedList L,
   L->A[L->e % L->al] = v;
 }
 
+/* Adds the value v to the front of the list. */
+void
+listPrepend(sortedList L,
+	    int v
+	    )
+{
+  if(L->e-L->b == L->al){ /* resize */
+    if(0 == L->al)
+      L->al = 1;
+    listRes(L, 2*L->al);
+  }
+
+  if(0 > L->b){ /* Same positions in the array */
+    L->b += L->al;
+    L->e += L->al;
+  }
+
+#ifndef NDEBUG
+  if(L->b < L->e){
+    assert(L->A[(L->b+1) % L->al] > v && "Inserting a large value in the ordered list.");
+  }
+#endif /* NDEBUG */
+
+  L->A[L->b % L->al] = v;
+  L->b--;
+}
+
 /* Remove the first element from the list. */
 void
 listPop(sortedList L
@@ -105,7 +149,34 @@ listPop(sortedList L
 {
   L->b++;
 
-  if(4*(L->e-L->b) <= L->al){ /* resize */
+  if(2 < L->al && 4*(L->e-L->b) <= L->al){ /* resize */
+    listRes(L, 1+(L->al/2));
+  }
+}
+
+/* Remove the first k elements from the list. Resizes at most once. */
+void
+listPopMany(sortedList L,
+	    int k
+	    )
+{
+  L->b += k;
+
+  int n = L->al;
+  while(2 < n && 4*(L->e-L->b) <= n)
+    n = 1+(n/2);
+  if(n != L->al) /* resize */
+    listRes(L, n);
+}
+
+/* Remove the last element from the list. */
+void
+listPopBack(sortedList L
+	    )
+{
+  L->e--;
+
+  if(2 < L->al && 4*(L->e-L->b) <= L->al){ /* resize */
     listRes(L, 1+(L->al/2));
   }
 }
@@ -190,6 +261,24 @@ listAccess(sortedList L,
   return r;
 }
 
+/* Subtracts k from every value and moves the indexes back to the
+   start of the array. The indexes move by a multiple of al, so the
+   values stay in the same array positions. */
+void
+listRebase(sortedList L,
+	   int k
+	   )
+{
+  for(int i = L->b+1; i <= L->e; i++)
+    L->A[i % L->al] -= k;
+
+  if(0 < L->al){
+    int s = ((L->b+1)/L->al)*L->al;
+    L->b -= s;
+    L->e -= s;
+  }
+}
+
 #if 0 /* Comment */
 
 int
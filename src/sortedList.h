@@ -43,17 +43,39 @@ void
 listFree(sortedList L
 	 );
 
+/* A copy of L, with its own array */
+sortedList
+listCopy(sortedList L
+	 );
+
 /* Appends the value v to the list. */
 void
 listAppend(sortedList L,
 	   int v
 	   );
 
+/* Adds the value v to the front of the list. */
+void
+listPrepend(sortedList L,
+	    int v
+	    );
+
 /* Remove the first element from the list. */
 void
 listPop(sortedList L
 	);
 
+/* Remove the first k elements from the list. */
+void
+listPopMany(sortedList L,
+	    int k
+	    );
+
+/* Remove the last element from the list. */
+void
+listPopBack(sortedList L
+	    );
+
 /* Returns the last element from the list */
 int
 listLast(sortedList L
@@ -85,4 +107,11 @@ listAccess(sortedList L,
            int i
            );
 
+/* Subtracts k from every value and moves the indexes back to the
+   start of the array, in O(size) time. */
+void
+listRebase(sortedList L,
+	   int k
+	   );
+
 #endif /* _SORTED_LIST_H */
@@ -25,20 +25,23 @@
 /* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 
 #include <stdlib.h>
+#include <string.h>
 #include <stdio.h>
+#include <assert.h>
 
 #include "sortedList.h"
 #include "string.h"
 
- /* A dynamic string representation. Letters get removed from the
-    beginning and added at the end. */
+ /* A dynamic string representation. Letters usually get removed from
+    the beginning and added at the end, but both ends can change. */
 struct string{
-  int b; /* External begin value, these increase. Inclusive */
-  int e; /* External end value. Increasing. Exclusive. */
+  int b; /* External begin value, never negative. Inclusive */
+  int e; /* External end value. Exclusive. */
   char* A; /* The string buffer. String starts at S[b-offset]. */
   int Sa;  /* Number of alloced bytes. */
   int sigma; /* Size of the alphabet */
   sortedList *Nxt; /* Sorted Lists, indexed by letters */
+  int rc; /* Number of other owners */
 };
 
 string
@@ -64,6 +67,11 @@ stringAlloc(int sigma
 void
 stringFree(string S)
 {
+  if(0 < S->rc){ /* Other owners keep it */
+    S->rc--;
+    return;
+  }
+
   free(S->A);
   int c = 'A';
   for(int i = 0; i < S->sigma; i++){
@@ -75,6 +83,46 @@ stringFree(string S)
   free(S);
 }
 
+/* Adds one owner to S, the buffers get shared. */
+string
+stringShare(string S
+	    )
+{
+  S->rc++;
+  return S;
+}
+
+/* Copy on write. Returns S if it has a single owner, otherwise the
+   caller gets its own copy of the buffers and lists. */
+string
+stringOwn(string S
+	  )
+{
+  if(0 < S->rc){
+    S->rc--;
+    string C = malloc(sizeof(struct string));
+    memcpy(C, S, sizeof(struct string));
+    C->rc = 0;
+
+    C->A = NULL;
+    if(0 < C->Sa){
+      C->A = malloc(C->Sa*sizeof(char));
+      memcpy(C->A, S->A, C->Sa*sizeof(char));
+    }
+
+    C->Nxt = malloc(C->sigma*sizeof(sortedList));
+    C->Nxt = &(C->Nxt[-'A']);
+    int c = 'A';
+    for(int i = 0; i < C->sigma; i++){
+      C->Nxt[c] = listCopy(S->Nxt[c]);
+      c++;
+    }
+    S = C;
+  }
+
+  return S;
+}
+
 void
 printString(string S
 	    )
@@ -150,6 +198,26 @@ stringAppend(string S,
   S->e++;
 }
 
+/* Add letter c before the first letter. Positions do not go below
+   0, so the string must begin after it. */
+void
+stringPrepend(string S,
+	      char c
+	      )
+{
+  assert(0 < S->b && "No position left before the string.");
+
+  if(S->e-S->b == S->Sa){ /* resize */
+    if(0 == S->Sa)
+      S->Sa = 1;
+    stringRes(S, 2*S->Sa);
+  }
+
+  S->b--;
+  S->A[S->b % S->Sa] = c; /* Prepend letter */
+  listPrepend(S->Nxt[(int)c], S->b);
+}
+
 /* Get a letter from the string */
 char
 stringLetter(string S,
@@ -215,10 +283,90 @@ stringPop(string S)
   listPop(S->Nxt[(int)stringFstLetter(S)]);
   S->b++;
 
-  if(4*(stringSize(S)) <= S->Sa) /* resize */
+  if(2 < S->Sa && 4*(stringSize(S)) <= S->Sa) /* resize */
     stringRes(S, 1+(S->Sa/2));
 }
 
+/* Remove the last letter */
+void
+stringPopBack(string S
+	      )
+{
+  S->e--;
+  listPopBack(S->Nxt[(int)stringLetter(S, S->e)]);
+
+  if(2 < S->Sa && 4*(stringSize(S)) <= S->Sa) /* resize */
+    stringRes(S, 1+(S->Sa/2));
+}
+
+/* Remove the first k letters, resizing the buffers only once. */
+void
+stringPopMany(string S,
+	      int k
+	      )
+{
+  int C[S->sigma]; /* Letter counts */
+
+  for(int i = 0; i < S->sigma; i++)
+    C[i] = 0;
+  for(int i = S->b; i < S->b+k; i++)
+    C[stringLetter(S, i)-'A']++;
+
+  int c = 'A';
+  for(int i = 0; i < S->sigma; i++){
+    if(0 < C[i])
+      listPopMany(S->Nxt[c], C[i]);
+    c++;
+  }
+  S->b += k;
+
+  int n = S->Sa;
+  while(2 < n && 4*(stringSize(S)) <= n)
+    n = 1+(n/2);
+  if(n != S->Sa) /* resize */
+    stringRes(S, n);
+}
+
+/* Reverses A[i..j-1] */
+static void
+reverse(char *A,
+	int i,
+	int j
+	)
+{
+  for(j--; i < j; i++, j--){
+    char c = A[i];
+    A[i] = A[j];
+    A[j] = c;
+  }
+}
+
+/* Moves every position down by k, so the string begins at b-k. A
+   negative k moves them up. The buffer rotates in place, with three
+   reversals, so the letters keep their offsets modulo Sa. */
+void
+stringRebase(string S,
+	     int k
+	     )
+{
+  assert(k <= S->b && "Positions can not go below 0.");
+
+  if(0 < S->Sa){
+    int t = ((k % S->Sa) + S->Sa) % S->Sa; /* Letter i goes to i-t */
+    reverse(S->A, 0, t);
+    reverse(S->A, t, S->Sa);
+    reverse(S->A, 0, S->Sa);
+  }
+  S->b -= k;
+  S->e -= k;
+
+  int c = 'A';
+  for(int i = 0; i < S->sigma; i++){
+    listRebase(S->Nxt[c], k);
+    c++;
+  }
+}
+
 char *
 stringGet(string S
 	  )
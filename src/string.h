@@ -37,10 +37,22 @@ string
 stringAlloc(int sigma
 	    );
 
+/* Frees S, or drops one owner if it is shared */
 void
 stringFree(string S
 	   );
 
+/* Adds one owner to S, the buffers get shared */
+string
+stringShare(string S
+	    );
+
+/* Copy on write. Returns S if it has a single owner, otherwise a
+   private copy. Call it before changing a shared string. */
+string
+stringOwn(string S
+	  );
+
 void
 printString(string S
 	    );
@@ -66,6 +78,12 @@ stringAppend(string S,
 	     char c
 	     );
 
+/* Add letter c before the first letter */
+void
+stringPrepend(string S,
+	      char c
+	      );
+
 /* Get a letter from the string */
 char
 stringLetter(string S,
@@ -115,6 +133,24 @@ void
 stringPop(string S
 	  );
 
+/* Remove the first k letters */
+void
+stringPopMany(string S,
+	      int k
+	      );
+
+/* Remove the last letter */
+void
+stringPopBack(string S
+	      );
+
+/* Moves every position down by k, so the string begins at b-k. A
+   negative k moves them up. Takes O(size) time. */
+void
+stringRebase(string S,
+	     int k
+	     );
+
 char *
 stringGet(string S
 	  );
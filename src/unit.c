@@ -42,9 +42,313 @@
 
 #include "ort.h"
 #include "string.h"
+#include "skyline.h"
 #include "mlcs.h"
 #include "naivemlcs.h"
 
+#ifndef NDEBUG
+/* Checks that the witness is a common subsequence of the strings */
+static void
+checkWitness(mlcs m,
+	     int dim,
+	     char **S /* Array with the strings */
+	     )
+{
+  int l = mlcsSize(m);
+  char O[l+1];
+  int P[l*dim+1];
+  int w = mlcsWitness(m, O, P);
+
+  assert(l == w && (int)strlen(O) == l);
+  for(int k = 0; k < l; k++){
+    for(int i = 0; i < dim; i++){
+      assert(O[k] == S[i][P[k*dim+i]]);
+      assert(0 == k || P[(k-1)*dim+i] < P[k*dim+i]);
+    }
+  }
+}
+
+/* Checks the MLCS of random prefixes against the naive algorithm */
+static void
+checkPrefix(mlcs m,
+	    int dim,
+	    char **S, /* Array with the strings */
+	    int sigma,
+	    int cap, /* The threshold, 0 if none */
+	    int beam /* Approximate mode, 0 if exact */
+	    )
+{
+  int n = 3; /* Number of vectors */
+  int q[n*dim];
+  int out[n];
+  char *T[dim]; /* The prefixes */
+
+  for(int i = 0; i < dim; i++)
+    T[i] = malloc(strlen(S[i])+1);
+
+  for(int k = 0; k < n; k++){
+    for(int i = 0; i < dim; i++){
+      q[k*dim+i] = (int)arc4random_uniform(strlen(S[i])+1)-1;
+      if(0 < k && arc4random_uniform(2)) /* Above the previous */
+	q[k*dim+i] = q[k*dim+i] < q[(k-1)*dim+i] ?
+	  q[(k-1)*dim+i] : q[k*dim+i];
+    }
+  }
+  mlcsPrefixBatch(m, n, q, out);
+
+  for(int k = 0; k < n; k++){
+    for(int i = 0; i < dim; i++){
+      memcpy(T[i], S[i], q[k*dim+i]+1);
+      T[i][q[k*dim+i]+1] = '\0';
+    }
+    int l = naiveMLCS(dim, T, sigma);
+    if(0 < cap && cap < l)
+      l = cap;
+    assert(out[k] == mlcsPrefix(m, &q[k*dim]));
+    assert(0 < beam ? out[k] <= l : out[k] == l);
+  }
+
+  for(int i = 0; i < dim; i++)
+    free(T[i]);
+}
+
+/* Checks the MLCS of n windows against the naive algorithm */
+static void
+checkWindowList(int dim,
+		char **S, /* Array with the strings */
+		int sigma,
+		int n, /* Number of windows */
+		int *s, /* The start vectors */
+		int *e /* The end vectors */
+		)
+{
+  int out[n];
+  char *T[dim]; /* The windows */
+
+  for(int i = 0; i < dim; i++)
+    T[i] = malloc(strlen(S[i])+1);
+
+  mlcsWindowBatch(dim, sigma, S, n, s, e, out);
+
+  for(int k = 0; k < n; k++){
+    for(int i = 0; i < dim; i++){
+      memcpy(T[i], &S[i][s[k*dim+i]], e[k*dim+i]-s[k*dim+i]);
+      T[i][e[k*dim+i]-s[k*dim+i]] = '\0';
+    }
+    assert(out[k] == naiveMLCS(dim, T, sigma));
+  }
+
+  for(int i = 0; i < dim; i++)
+    free(T[i]);
+}
+
+/* Checks the MLCS of random windows against the naive algorithm */
+static void
+checkWindows(int dim,
+	     char **S, /* Array with the strings */
+	     int sigma
+	     )
+{
+  int n = 4; /* Number of windows */
+  int s[n*dim];
+  int e[n*dim];
+
+  for(int k = 0; k < n; k++){
+    for(int i = 0; i < dim; i++){
+      int l = strlen(S[i]);
+      s[k*dim+i] = arc4random_uniform(l+1);
+      e[k*dim+i] = s[k*dim+i] + arc4random_uniform(l-s[k*dim+i]+1);
+    }
+  }
+  checkWindowList(dim, S, sigma, n, s, e);
+}
+
+/* Checks the largest MLCS of the windows of the given width against
+   the naive algorithm at every offset */
+static void
+checkMaxWindow(int dim,
+	       char **S, /* Array with the strings */
+	       int sigma,
+	       int width /* Window size */
+	       )
+{
+  int L = strlen(S[0]);
+  for(int i = 1; i < dim; i++)
+    L = (int)strlen(S[i]) < L ? (int)strlen(S[i]) : L;
+  char *T[dim]; /* The windows */
+  int o;
+  int l = mlcsMaxWindow(dim, sigma, S, width, &o);
+
+  for(int i = 0; i < dim; i++)
+    T[i] = malloc(width+1);
+
+  int best = -1;
+  for(int k = 0; k+width <= L; k++){
+    for(int i = 0; i < dim; i++){
+      memcpy(T[i], &S[i][k], width);
+      T[i][width] = '\0';
+    }
+    int r = naiveMLCS(dim, T, sigma);
+    best = best < r ? r : best;
+    if(k == o)
+      assert(r == l);
+  }
+  assert(best == l && 0 <= o && o+width <= L);
+
+  for(int i = 0; i < dim; i++)
+    free(T[i]);
+}
+
+/* A copy of the fronts, kept only from the change feed */
+struct mirror {
+  int d;   /* Dimension of the points */
+  int a;   /* Allocated layers */
+  ort *L;  /* The layers */
+};
+
+/* Frees the layers of the mirror */
+static void
+mirrorClear(struct mirror *M
+	    )
+{
+  for(int r = 0; r < M->a; r++)
+    freeORT(M->L[r]);
+  free(M->L);
+  M->L = NULL;
+  M->a = 0;
+}
+
+/* The change feed of the mirror */
+static void
+mirrorFeed(void *arg,
+	   int r, /* Which layer */
+	   point p,
+	   int d,
+	   int sign /* +1 inserted, -1 deleted, 0 rebased */
+	   )
+{
+  struct mirror *M = arg;
+
+  if(0 == sign){ /* Every point moved down by p */
+    for(int k = 0; k < M->a; k++)
+      rebaseORT(M->L[k], p);
+    return;
+  }
+
+  if(d != M->d){ /* Only after every point left */
+    for(int k = 0; k < M->a; k++)
+      assert(0 == weightORT(M->L[k]));
+    mirrorClear(M);
+    M->d = d;
+  }
+  while(M->a <= r){
+    M->L = realloc(M->L, (M->a+1)*sizeof(ort));
+    M->L[M->a++] = allocORT(d);
+  }
+
+  assert(0 < r);
+  if(0 < sign){
+    assert(!containsQ(M->L[r], p));
+    insert(M->L[r], p);
+  } else {
+    assert(containsQ(M->L[r], p));
+    delete(M->L[r], p);
+  }
+}
+
+/* Loads the fronts of m into the mirror and follows its changes */
+static void
+mirrorReset(struct mirror *M,
+	    mlcs m
+	    )
+{
+  int Z[m->dim];
+  point z = Z;
+  for(int i = 0; i < m->dim; i++)
+    z[i] = -2;
+
+  mirrorClear(M);
+  M->d = m->dim;
+  for(int r = 1; r < m->pfA; r++){
+    int n;
+    if(NULL == m->PF[r])
+      continue;
+    point *T = collect(m->PF[r], z, &n);
+    for(int k = 0; k < n; k++){
+      mirrorFeed(M, r, T[k], m->dim, 1);
+      free(T[k]);
+    }
+    free(T);
+  }
+  feedMLCS(m, mirrorFeed, M);
+}
+
+/* Checks that the mirror has the same fronts as m */
+static void
+checkMirror(struct mirror *M,
+	    mlcs m
+	    )
+{
+  int Z[m->dim];
+  point z = Z;
+  for(int i = 0; i < m->dim; i++)
+    z[i] = -2;
+
+  assert(0 == m->lambda || M->d == m->dim);
+  for(int r = 1; r < M->a || r < m->pfA; r++){
+    int w = r < m->pfA && NULL != m->PF[r] ? weightORT(m->PF[r]) : 0;
+    assert(w == (r < M->a ? weightORT(M->L[r]) : 0));
+    if(0 == w)
+      continue;
+    int n;
+    point *T = collect(m->PF[r], z, &n);
+    for(int k = 0; k < n; k++){
+      assert(containsQ(M->L[r], T[k]));
+      free(T[k]);
+    }
+    free(T);
+  }
+}
+#endif /* NDEBUG */
+
+/* The change feed of the shell, prints the changes */
+static void
+printFeed(__attribute__((unused)) void *arg,
+	  int r, /* Which layer */
+	  point p,
+	  int d,
+	  int sign /* +1 inserted, -1 deleted, 0 rebased */
+	  )
+{
+  printf("[FEED] %c %d :", 0 < sign ? '+' : 0 > sign ? '-' : '@', r);
+  for(int i = 0; i < d; i++)
+    printf(" %d", p[i]);
+  printf("\n");
+}
+
+/* Removes del letters at position pos of T and inserts the n letters
+   of s there. Keeps a copy of the strings that does not depend on the
+   MLCS data struct. */
+static char *
+textEdit(char *T, /* The string, it is reallocated */
+	 int pos, /* Position */
+	 int del, /* Letters removed */
+	 const char *s, /* Letters inserted */
+	 int n /* Number of letters inserted */
+	 )
+{
+  int l = strlen(T);
+  assert(0 <= pos && pos+del <= l);
+  char *R = malloc((l-del+n+1)*sizeof(char));
+
+  memcpy(R, T, pos);
+  memcpy(&R[pos], s, n);
+  memcpy(&R[pos+n], &T[pos+del], l-pos-del+1);
+  free(T);
+
+  return R;
+}
+
 /* Test code by comparing with random strings */
 void
 unitTest(int sigma, /* Alphabet size */
@@ -56,49 +360,716 @@ unitTest(int sigma, /* Alphabet size */
 #ifndef NDEBUG
   char *S[dim]; /* Array with the strings */
 #endif /* NDEBUG */
-  mlcs m = allocMLCS(dim, sigma);
+  char *E[dim]; /* Copy of the strings, edited next to m */
+  for(int j = 0; j < dim; j++)
+    E[j] = calloc(1, sizeof(char));
+  /* Some tests use a threshold or approximate mode, 0 is none */
+  int cap = 0;
+  int beam = 0;
+  int grow = 0; /* Append only mode */
+  mlcs m;
+  switch(arc4random_uniform(4)){
+  case 0:
+    m = allocMLCS(dim, sigma);
+    break;
+  case 1:
+    cap = 1+arc4random_uniform(n);
+    m = allocMLCSThreshold(dim, sigma, cap);
+    break;
+  case 2:
+    grow = 1;
+    m = allocMLCSGrow(dim, sigma);
+    break;
+  default:
+    beam = 1+arc4random_uniform(n);
+    m = allocMLCSApprox(dim, sigma, beam, NULL);
+  }
+#ifndef NDEBUG
+  int drift = 0; /* Sum of the errors of approximate mode */
+  struct mirror M = {0, 0, NULL}; /* The fronts, from the change feed */
+  mirrorReset(&M, m);
+#endif /* NDEBUG */
+  int lazy = 0; /* Is lazy mode on */
+  int budget = 0; /* Work per edit in budget mode, 0 if off */
+  int indexed = 0; /* Is the cross layer index on */
+  mlcs F = NULL; /* A fork of m, should not change */
+#ifndef NDEBUG
+  int Fl = 0; /* The MLCS size of F */
+#endif /* NDEBUG */
 
   for(; 0 < ops; ops--){
     int t;
     t = arc4random_uniform(dim);  /* Choose a string */
-    int option = arc4random_uniform(2); /* choose option */
+    int option = arc4random_uniform(16); /* choose option */
     if(stringSize(pullString(m,t)) < n)
       option = 0; /* Insert */
     if(stringSize(pullString(m,t)) > 2*n)
       option = 1; /* Delete */
+    if(grow && 0 != option && 2 != option && 4 != option &&
+       6 != option && 7 != option && 14 != option && 15 != option)
+      option = 0; /* Only appends */
+    if(grow && stringSize(pullString(m,t)) > 2*n){
+      freeMLCS(m); /* Start over, strings can not shrink */
+      m = allocMLCSGrow(dim, sigma);
+      for(int j = 0; j < dim; j++)
+	E[j] = textEdit(E[j], 0, strlen(E[j]), "", 0);
+      lazy = 0;
+      budget = 0;
+      indexed = 0;
+      option = 0;
+#ifndef NDEBUG
+      mirrorReset(&M, m);
+#endif /* NDEBUG */
+    }
 
     switch(option){
     default:
     case 0: /* Insert */
-      append(m, t, 'A' + arc4random_uniform(sigma));
+      {
+	char c = 'A' + arc4random_uniform(sigma);
+	append(m, t, c);
+	E[t] = textEdit(E[t], strlen(E[t]), 0, &c, 1);
+      }
       break;
     case 1: /* Delete */
       pop(m, t);
+      E[t] = textEdit(E[t], 0, 1, "", 0);
+      break;
+    case 2: /* Insert a run */
+      {
+	int l = 1+arc4random_uniform(n);
+	char R[l];
+	for(int k = 0; k < l; k++)
+	  R[k] = 'A' + arc4random_uniform(sigma);
+	appendRun(m, t, R, l);
+	E[t] = textEdit(E[t], strlen(E[t]), 0, R, l);
+      }
+      break;
+    case 3: /* Delete several */
+      {
+	int k = 1+arc4random_uniform(stringSize(pullString(m,t)));
+	popMany(m, t, k);
+	E[t] = textEdit(E[t], 0, k, "", 0);
+      }
+      break;
+    case 4: /* Insert in every string */
+      {
+	char R[dim];
+	for(int k = 0; k < dim; k++)
+	  R[k] = 'A' + arc4random_uniform(sigma);
+	appendColumn(m, R);
+	for(int k = 0; k < dim; k++)
+	  E[k] = textEdit(E[k], strlen(E[k]), 0, &R[k], 1);
+      }
+      break;
+    case 5: /* Slide the window */
+      if(0 < stringSize(pullString(m,t))){
+	char c = 'A' + arc4random_uniform(sigma);
+	shift(m, t, c);
+	E[t] = textEdit(E[t], 0, 1, "", 0);
+	E[t] = textEdit(E[t], strlen(E[t]), 0, &c, 1);
+      }
+      break;
+    case 6: /* Toggle lazy mode */
+      lazy = !lazy;
+      budget = 0;
+      lazyMLCS(m, lazy);
+      break;
+    case 7: /* Fork */
+      if(NULL != F)
+	freeMLCS(F);
+      F = forkMLCS(m);
+#ifndef NDEBUG
+      Fl = mlcsSize(F);
+#endif /* NDEBUG */
+      break;
+    case 8: /* Insert at the front */
+      {
+	char c = 'A' + arc4random_uniform(sigma);
+	prepend(m, t, c);
+	E[t] = textEdit(E[t], 0, 0, &c, 1);
+      }
+      break;
+    case 9: /* Delete at the back */
+      popBack(m, t);
+      E[t] = textEdit(E[t], strlen(E[t])-1, 1, "", 0);
+      break;
+    case 10: /* Edit in the middle */
+      {
+	int pos = arc4random_uniform(stringSize(pullString(m,t)));
+	char c = 'A' + arc4random_uniform(sigma);
+	switch(arc4random_uniform(3)){
+	case 0:
+	  editInsert(m, t, pos, c);
+	  E[t] = textEdit(E[t], pos, 0, &c, 1);
+	  break;
+	case 1:
+	  editDelete(m, t, pos);
+	  E[t] = textEdit(E[t], pos, 1, "", 0);
+	  break;
+	default:
+	  editSubstitute(m, t, pos, c);
+	  E[t] = textEdit(E[t], pos, 1, &c, 1);
+	}
+      }
+      break;
+    case 11: /* Replace a string by a new one */
+      if(2 < dim){
+	int l = arc4random_uniform(2*n);
+	char R[l+1];
+	for(int k = 0; k < l; k++)
+	  R[k] = 'A' + arc4random_uniform(sigma);
+	R[l] = '\0';
+	removeString(m, t);
+	addString(m, R);
+	free(E[t]);
+	for(int j = t; j < dim-1; j++)
+	  E[j] = E[j+1];
+	E[dim-1] = textEdit(calloc(1, sizeof(char)), 0, 0, R, l);
+      }
+      break;
+    case 12: /* Build the fronts again, in bulk */
+      if(0 == cap && 0 == beam){
+	char *V[dim]; /* The strings */
+	for(int j = 0; j < dim; j++)
+	  V[j] = stringGet(pullString(m,j));
+	freeMLCS(m);
+	m = buildMLCS(dim, sigma, V);
+	lazy = 0;
+	budget = 0;
+	indexed = 0;
+	for(int j = 0; j < dim; j++)
+	  free(V[j]);
+#ifndef NDEBUG
+	mirrorReset(&M, m);
+#endif /* NDEBUG */
+      }
+      break;
+    case 13: /* Move the positions back to 0 */
+      rebaseMLCS(m);
+      break;
+    case 14: /* Toggle the cross layer index */
+      indexed = !indexed;
+      indexMLCS(m, indexed);
+      break;
+    case 15: /* Toggle budget mode, with some work per edit */
+      budget = 0 == budget ? 1+arc4random_uniform(4*n) : 0;
+      lazy = 0 < budget;
+      budgetMLCS(m, budget);
       break;
     }
 
 #ifndef NDEBUG
-    for(int j = 0; j < dim; j++)
+    for(int j = 0; j < dim; j++){
       S[j] = stringGet(pullString(m,j));
+      assert(0 == strcmp(S[j], E[j]) && "The strings differ from the copy.");
+    }
+
+    int l = naiveMLCS(dim, E, sigma);
+    if(0 < cap && cap < l)
+      l = cap;
+    if(0 < beam){ /* Only a lower bound */
+      assert(mlcsSize(m) <= l && l <= mlcsUpperBound(m));
+      drift += l - mlcsSize(m);
+      l = mlcsSize(m);
+    }
 
     printf("[CHECK] %d = %d\n",
 	   mlcsSize(m),
-	   naiveMLCS(dim, S, sigma)
+	   l
 	   );
 
     for(int j = 0; j < dim; j++)
       printf("[CHECK] %d : %s\n", j, S[j]);
 
-    assert(mlcsSize(m) == naiveMLCS(dim, S, sigma));
+    assert(mlcsSize(m) == l);
+    assert(reachesThreshold(m) == (0 < cap && l == cap));
+    checkWitness(m, dim, S);
+    checkPrefix(m, dim, S, sigma, cap, beam);
+    checkWindows(dim, S, sigma);
+    int L = strlen(S[0]); /* Shortest string */
+    for(int j = 1; j < dim; j++)
+      L = (int)strlen(S[j]) < L ? (int)strlen(S[j]) : L;
+    checkMaxWindow(dim, S, sigma, arc4random_uniform(L+1));
+    assert(NULL == F || Fl == mlcsSize(F));
+    checkMirror(&M, m);
 
     for(int j = 0; j < dim; j++)
       free(S[j]);
 #endif /* NDEBUG */
   }
 
+#ifndef NDEBUG
+  if(0 < beam)
+    printf("[DRIFT] %d over all the checks, with %d points per front\n",
+	   drift, beam);
+  mirrorClear(&M);
+#endif /* NDEBUG */
+
+  if(NULL != F)
+    freeMLCS(F);
+  freeMLCS(m);
+  for(int j = 0; j < dim; j++)
+    free(E[j]);
+}
+
+#ifndef NDEBUG
+/* Checks that m has the strings E and their MLCS */
+static void
+expectMLCS(mlcs m,
+	   int dim,
+	   char **E, /* The expected strings */
+	   int sigma
+	   )
+{
+  for(int j = 0; j < dim; j++){
+    char *S = stringGet(pullString(m, j));
+    assert(0 == strcmp(S, E[j]) && "Unexpected string.");
+    free(S);
+  }
+  assert(mlcsSize(m) == naiveMLCS(dim, E, sigma));
+  checkWitness(m, dim, E);
+}
+
+/* Budget mode leaves a pop repair in progress, then the number of
+   strings changes */
+static void
+caseBudgetResize(void
+		 )
+{
+  mlcs m = allocMLCS(2, 2);
+  appendRun(m, 0, "ABBABAAB", 8);
+  appendRun(m, 1, "BABABBAA", 8);
+  budgetMLCS(m, 1);
+
+  pop(m, 0);
+  addString(m, "ABABAB");
+  append(m, 1, 'A');
+  char *E[] = {"BBABAAB", "BABABBAAA", "ABABAB"};
+  expectMLCS(m, 3, E, 2);
+
+  pop(m, 2);
+  removeString(m, 0);
+  append(m, 1, 'B');
+  char *F[] = {"BABABBAAA", "BABABB"};
+  expectMLCS(m, 2, F, 2);
+
+  freeMLCS(m);
+}
+
+/* Budget mode: a prepend undoes a pop that is still being repaired */
+static void
+caseBudgetPrepend(void
+		  )
+{
+  mlcs m = allocMLCS(2, 2);
+  appendRun(m, 0, "ABBABAAB", 8);
+  appendRun(m, 1, "BABABBAA", 8);
+  budgetMLCS(m, 1);
+
+  pop(m, 0);
+  prepend(m, 0, 'A');
+  append(m, 1, 'B');
+  char *E[] = {"ABBABAAB", "BABABBAAB"};
+  expectMLCS(m, 2, E, 2);
+
+  pop(m, 1);
+  pop(m, 1);
+  prepend(m, 1, 'A');
+  prepend(m, 1, 'A');
+  char *F[] = {"ABBABAAB", "AABABBAAB"};
+  expectMLCS(m, 2, F, 2);
+
+  freeMLCS(m);
+}
+
+/* Budget mode: an edit of the pending appends waits while a pop is
+   repaired, and in threshold mode the pops and the appends are sweeps
+   that run over the next edits */
+static void
+caseBudgetSweep(void
+		)
+{
+  mlcs m = allocMLCS(2, 2);
+  appendRun(m, 0, "ABBABAAB", 8);
+  appendRun(m, 1, "BABABBAA", 8);
+  budgetMLCS(m, 1);
+
+  pop(m, 0);
+  append(m, 1, 'B');
+  editInsert(m, 1, 8, 'A');
+  char *E[] = {"BBABAAB", "BABABBAAAB"};
+  expectMLCS(m, 2, E, 2);
+  freeMLCS(m);
+
+  m = allocMLCSThreshold(2, 2, 3);
+  appendRun(m, 0, "ABBABAAB", 8);
+  appendRun(m, 1, "BABABBAA", 8);
+  budgetMLCS(m, 1);
+
+  pop(m, 0);
+  pop(m, 0);
+  append(m, 0, 'A');
+  pop(m, 1);
+  char *F[] = {"BABAABA", "ABABBAA"};
+  for(int j = 0; j < 2; j++){
+    char *S = stringGet(pullString(m, j));
+    assert(0 == strcmp(S, F[j]) && "Unexpected string.");
+    free(S);
+  }
+  assert(3 == mlcsSize(m));
+  freeMLCS(m);
+}
+
+/* Shifts slide a window, popMany drops a prefix */
+static void
+caseShift(void
+	  )
+{
+  mlcs m = allocMLCS(2, 2);
+  appendRun(m, 0, "ABBA", 4);
+  appendRun(m, 1, "BABA", 4);
+
+  shift(m, 0, 'B');
+  shift(m, 1, 'A');
+  shift(m, 0, 'A');
+  char *E[] = {"BABA", "ABAA"};
+  expectMLCS(m, 2, E, 2);
+
+  popMany(m, 1, 2);
+  char *F[] = {"BABA", "AA"};
+  expectMLCS(m, 2, F, 2);
+
+  freeMLCS(m);
+}
+
+/* Lazy mode: a pop that reaches the pending letters drops them */
+static void
+caseLazy(void
+	 )
+{
+  mlcs m = allocMLCS(2, 2);
+  appendRun(m, 0, "AB", 2);
+  appendRun(m, 1, "BAB", 3);
+  lazyMLCS(m, 1);
+
+  append(m, 0, 'A');
+  pop(m, 0);
+  pop(m, 0);
+  pop(m, 0); /* The pending A */
+  append(m, 0, 'B');
+  append(m, 1, 'A');
+  char *E[] = {"B", "BABA"};
+  expectMLCS(m, 2, E, 2);
+  lazyMLCS(m, 0);
+  expectMLCS(m, 2, E, 2);
+
+  freeMLCS(m);
+}
+
+/* A fork and its origin edit the same strings independently */
+static void
+caseForkEdit(void
+	     )
+{
+  mlcs m = allocMLCS(2, 3);
+  appendRun(m, 0, "ABCABC", 6);
+  appendRun(m, 1, "CABCAB", 6);
+  mlcs f = forkMLCS(m);
+
+  editSubstitute(f, 0, 2, 'A');
+  editInsert(f, 1, 0, 'B');
+  editDelete(m, 0, 5);
+  char *E[] = {"ABCAB", "CABCAB"};
+  char *F[] = {"ABAABC", "BCABCAB"};
+  expectMLCS(m, 2, E, 3);
+  expectMLCS(f, 2, F, 3);
+
+  freeMLCS(m);
+  editDelete(f, 1, 3);
+  char *G[] = {"ABAABC", "BCACAB"};
+  expectMLCS(f, 2, G, 3);
+
+  freeMLCS(f);
+}
+
+/* Prepends and pops at the back edit the other end of the strings */
+static void
+casePrepend(void
+	    )
+{
+  mlcs m = allocMLCS(2, 2);
+  appendRun(m, 0, "ABA", 3);
+  appendRun(m, 1, "BAB", 3);
+
+  prepend(m, 0, 'B');
+  popBack(m, 1);
+  prepend(m, 1, 'A');
+  popBack(m, 0);
+  char *E[] = {"BAB", "ABA"};
+  expectMLCS(m, 2, E, 2);
+
+  freeMLCS(m);
+}
+
+/* Edits at the front, the middle and the end, and on pending letters
+   of lazy mode */
+static void
+caseEdits(void
+	  )
+{
+  mlcs m = allocMLCS(3, 3);
+  appendRun(m, 0, "ABCAB", 5);
+  appendRun(m, 1, "BCABC", 5);
+  appendRun(m, 2, "CABCA", 5);
+
+  editInsert(m, 0, 0, 'C');
+  editSubstitute(m, 1, 2, 'C');
+  editDelete(m, 2, 4);
+  char *E[] = {"CABCAB", "BCCBC", "CABC"};
+  expectMLCS(m, 3, E, 3);
+
+  lazyMLCS(m, 1);
+  append(m, 2, 'B');
+  editSubstitute(m, 2, 4, 'A');
+  editInsert(m, 1, 5, 'A');
+  char *F[] = {"CABCAB", "BCCBCA", "CABCA"};
+  expectMLCS(m, 3, F, 3);
+
+  freeMLCS(m);
+}
+
+/* Threshold mode stops at the target length */
+static void
+caseThreshold(void
+	      )
+{
+  mlcs m = allocMLCSThreshold(2, 2, 3);
+  appendRun(m, 0, "ABABAB", 6);
+  appendRun(m, 1, "ABABBA", 6);
+  assert(3 == mlcsSize(m) && reachesThreshold(m));
+
+  popMany(m, 0, 4);
+  assert(2 == mlcsSize(m) && !reachesThreshold(m));
+
+  freeMLCS(m);
+}
+
+/* Approximate mode with one point per front is a lower bound */
+static void
+caseApprox(void
+	   )
+{
+  char *E[] = {"ABCABC", "CBACBA", "BACBAC"};
+  mlcs m = allocMLCSApprox(3, 3, 1, NULL);
+  for(int j = 0; j < 3; j++)
+    appendRun(m, j, E[j], 6);
+  assert(0 < mlcsSize(m) && mlcsSize(m) <= naiveMLCS(3, E, 3));
+  assert(naiveMLCS(3, E, 3) <= mlcsUpperBound(m));
+  checkWitness(m, 3, E);
+
+  freeMLCS(m);
+}
+
+/* Prefix queries with known answers */
+static void
+casePrefix(void
+	   )
+{
+  char *E[] = {"ABCBDAB", "BDCABA"};
+  mlcs m = buildMLCS(2, 4, E);
+  /* ABCB and BDC, the whole strings, the empty prefixes */
+  int q[] = {3, 2, 6, 5, -1, -1};
+  int out[3];
+
+  mlcsPrefixBatch(m, 3, q, out);
+  assert(2 == out[0] && 4 == out[1] && 0 == out[2]);
+  assert(2 == mlcsPrefix(m, &q[0]));
+
+  freeMLCS(m);
+}
+
+/* buildMLCS gives the same fronts as the appends */
+static void
+caseBuild(void
+	  )
+{
+  char *E[] = {"ACBBCA", "CABACB", "BCACBA"};
+  mlcs m = buildMLCS(3, 3, E);
+  expectMLCS(m, 3, E, 3);
+
+  pop(m, 1);
+  append(m, 1, 'C');
+  char *F[] = {"ACBBCA", "ABACBC", "BCACBA"};
+  expectMLCS(m, 3, F, 3);
+
+  freeMLCS(m);
+}
+
+/* Append only mode, by columns and by runs */
+static void
+caseGrow(void
+	 )
+{
+  mlcs m = allocMLCSGrow(2, 3);
+  appendColumn(m, "AB");
+  appendColumn(m, "CA");
+  appendRun(m, 0, "BA", 2);
+  appendRun(m, 1, "CBA", 3);
+  char *E[] = {"ACBA", "BACBA"};
+  expectMLCS(m, 2, E, 3);
+
   freeMLCS(m);
 }
 
+/* A rebase moves the positions, the change feed follows it */
+static void
+caseRebase(void
+	   )
+{
+  struct mirror M = {0, 0, NULL};
+  mlcs m = allocMLCS(2, 2);
+  mirrorReset(&M, m);
+  appendRun(m, 0, "ABABB", 5);
+  appendRun(m, 1, "BBABA", 5);
+
+  pop(m, 0);
+  pop(m, 0);
+  pop(m, 1);
+  rebaseMLCS(m);
+  append(m, 0, 'A');
+  char *E[] = {"ABBA", "BABA"};
+  expectMLCS(m, 2, E, 2);
+  checkMirror(&M, m);
+
+  mirrorClear(&M);
+  freeMLCS(m);
+}
+
+/* The cross layer index gives the same fronts, on and off */
+static void
+caseIndex(void
+	  )
+{
+  mlcs m = allocMLCS(3, 2);
+  indexMLCS(m, 1);
+  appendRun(m, 0, "ABBAB", 5);
+  appendRun(m, 1, "BABBA", 5);
+  appendColumn(m, "ABA");
+  appendRun(m, 2, "BBA", 3);
+  pop(m, 1);
+  char *E[] = {"ABBABA", "ABBAB", "ABBA"};
+  expectMLCS(m, 3, E, 2);
+
+  indexMLCS(m, 0);
+  append(m, 2, 'B');
+  char *F[] = {"ABBABA", "ABBAB", "ABBAB"};
+  expectMLCS(m, 3, F, 2);
+
+  freeMLCS(m);
+}
+
+/* Windows one letter apart slide the instance, windows far apart
+   build it again, and the widest search uses both */
+static void
+caseWindows(void
+	    )
+{
+  int L = 220;
+  char *W[3];
+  unsigned x = 1; /* Fixed letters */
+  for(int i = 0; i < 3; i++){
+    W[i] = malloc(L+1);
+    for(int k = 0; k < L; k++){
+      x = x*1103515245 + 12345;
+      W[i][k] = 'A' + (x >> 16) % 3;
+    }
+    W[i][L] = '\0';
+  }
+
+  int s[] = {0, 0, 1, 1, 5, 7, 150, 160};
+  int e[] = {200, 205, 201, 206, 10, 9, 220, 200};
+  checkWindowList(2, W, 3, 4, s, e);
+
+  for(int i = 0; i < 3; i++) /* Short strings for the naive check */
+    W[i][24] = '\0';
+  checkMaxWindow(3, W, 3, 6);
+
+  for(int i = 0; i < 3; i++)
+    free(W[i]);
+}
+
+/* Deterministic cases, one per feature and one per problem found */
+void
+caseTests(void
+	  )
+{
+  caseShift();
+  caseLazy();
+  caseForkEdit();
+  casePrepend();
+  caseEdits();
+  caseThreshold();
+  caseApprox();
+  casePrefix();
+  caseBuild();
+  caseGrow();
+  caseRebase();
+  caseIndex();
+  caseWindows();
+  caseBudgetResize();
+  caseBudgetPrepend();
+  caseBudgetSweep();
+}
+#endif /* NDEBUG */
+
+/* Reads the next word of letters into *W, growing it if necessary.
+   Returns the number of letters read. */
+static int
+readWord(char **W, /* The buffer */
+	 int *Wa   /* Size of the buffer */
+	 )
+{
+  int n = 0;
+  int c;
+
+  do{
+    c = getchar();
+  } while(' ' == c);
+
+  while(EOF != c && ' ' != c && '\n' != c){
+    if(n == *Wa){
+      *Wa = 0 == *Wa ? 16 : 2*(*Wa);
+      *W = realloc(*W, *Wa*sizeof(char));
+    }
+    (*W)[n++] = c;
+    c = getchar();
+  }
+
+  return n;
+}
+
+/* Reads an optional number from the current line. Returns 1 when it is
+   missing. */
+static int
+readCount(void
+	  )
+{
+  int n = 1;
+  int c;
+
+  do{
+    c = getchar();
+  } while(' ' == c);
+
+  if('0' <= c && c <= '9'){
+    ungetc(c, stdin);
+    scanf("%d", &n);
+  }
+
+  return n;
+}
+
 int
 commandShell(void)
 {
@@ -111,6 +1082,12 @@ commandShell(void)
   int sigma; /* Alphabet size */
   struct timespec start, stop;
   int cpu_time_used = 0;
+  char *W = NULL; /* Buffer for letter runs */
+  int Wa = 0; /* Size of W */
+  int n;
+  int lazy = 0; /* Is lazy mode on */
+  int cap = 0; /* The threshold, 0 if none */
+  int beam = 0; /* Points per front in approximate mode, 0 if exact */
 
   clock_gettime(CLOCK_MONOTONIC, &start);
   while('X' != C && cpu_time_used < TIME_LIMIT){
@@ -123,40 +1100,284 @@ commandShell(void)
       scanf("%d", &dim);
       scanf("%d", &sigma);
       m = allocMLCS(dim, sigma);
+      lazy = 0;
+      cap = 0;
+      beam = 0;
+      break;
+    case 'O': /* Define strings, that only grow */
+      resets++;
+      if(NULL != m)
+	freeMLCS(m);
+      scanf("%d", &dim);
+      scanf("%d", &sigma);
+      m = allocMLCSGrow(dim, sigma);
+      lazy = 0;
+      cap = 0;
+      beam = 0;
+      break;
+    case 'H': /* Define strings, with a threshold */
+      resets++;
+      if(NULL != m)
+	freeMLCS(m);
+      scanf("%d", &dim);
+      scanf("%d", &sigma);
+      scanf("%d", &cap);
+      m = allocMLCSThreshold(dim, sigma, cap);
+      lazy = 0;
+      beam = 0;
+      break;
+    case 'U': /* Define the strings and build the fronts in bulk */
+      resets++;
+      if(NULL != m)
+	freeMLCS(m);
+      scanf("%d", &dim);
+      scanf("%d", &sigma);
+      {
+	char *V[dim]; /* The strings */
+	for(int j = 0; j < dim; j++){
+	  n = readWord(&W, &Wa);
+	  count += n;
+	  V[j] = malloc((n+1)*sizeof(char));
+	  memcpy(V[j], W, n*sizeof(char));
+	  V[j][n] = '\0';
+	}
+	m = buildMLCS(dim, sigma, V);
+	for(int j = 0; j < dim; j++)
+	  free(V[j]);
+      }
+      lazy = 0;
+      cap = 0;
+      beam = 0;
+      break;
+    case 'G': /* Define strings, with at most B points per front */
+      resets++;
+      if(NULL != m)
+	freeMLCS(m);
+      scanf("%d", &dim);
+      scanf("%d", &sigma);
+      scanf("%d", &beam);
+      m = allocMLCSApprox(dim, sigma, beam, NULL);
+      lazy = 0;
+      cap = 0;
+      break;
+    case 'C': /* Print the changes of the fronts, or stop */
+      scanf("%d", &n);
+      feedMLCS(m, 1 == n ? printFeed : NULL, NULL);
+      break;
+    case 'J': /* Turn the cross layer index on or off */
+      scanf("%d", &n);
+      indexMLCS(m, n);
+      break;
+    case 'Y': /* Move the positions back to 0 */
+      rebaseMLCS(m);
+      break;
+    case 'V': /* Print the repair and rebuild counts */
+      printStatsMLCS(m);
+      break;
+    case 'Q': /* Print if the threshold is reached */
+      printf("%d\n", reachesThreshold(m));
+      break;
+    case 'L': /* Turn lazy mode on or off */
+      scanf("%d", &lazy);
+      lazyMLCS(m, lazy);
+      break;
+    case 'M': /* Turn budget mode on, with the work per edit, or off */
+      scanf("%d", &n);
+      budgetMLCS(m, n);
+      lazy = 0 < n;
+      break;
+    case 'I': /* Insert letter, or a run of letters */
+      scanf("%d", &t);
+      n = readWord(&W, &Wa);
+      count += n;
+      if(1 == n)
+	append(m, t, W[0]);
+      else
+	appendRun(m, t, W, n);
+      break;
+    case 'T': /* Insert one letter in every string */
+      n = readWord(&W, &Wa);
+      assert(n == dim && "T needs one letter per string.");
+      count += n;
+      appendColumn(m, W);
+      break;
+    case 'D': /* Delete letter, or several letters */
+      scanf("%d", &t);
+      n = readCount();
+      count += n;
+      if(1 == n)
+	pop(m, t);
+      else
+	popMany(m, t, n);
       break;
-    case 'I': /* Insert letter */
+    case 'S': /* Delete first letter and insert a letter */
+      scanf("%d", &t);
+      n = readWord(&W, &Wa);
+      assert(1 == n && "S needs one letter.");
+      if(0 == n)
+	break;
+      count += 2;
+      shift(m, t, W[0]);
+      break;
+    case 'P': /* Insert letter at the front */
+      scanf("%d", &t);
+      n = readWord(&W, &Wa);
+      assert(1 == n && "P needs one letter.");
+      if(0 == n)
+	break;
       count++;
+      prepend(m, t, W[0]);
+      break;
+    case 'B': /* Delete letter at the back */
       scanf("%d", &t);
-      do{
-	C = getchar();
-      } while(' ' == C);
-      append(m, t, C);
+      count++;
+      popBack(m, t);
       break;
-    case 'D': /* Delete letter */
+    case 'E': /* Substitute the letter at a position */
+      scanf("%d", &t);
+      scanf("%d", &n);
+      if(1 != readWord(&W, &Wa)){
+	assert(0 && "E needs one letter.");
+	break;
+      }
       count++;
+      editSubstitute(m, t, n, W[0]);
+      break;
+    case 'N': /* Insert a letter at a position */
       scanf("%d", &t);
-      pop(m, t);
+      scanf("%d", &n);
+      if(1 != readWord(&W, &Wa)){
+	assert(0 && "N needs one letter.");
+	break;
+      }
+      count++;
+      editInsert(m, t, n, W[0]);
+      break;
+    case 'R': /* Delete the letter at a position */
+      scanf("%d", &t);
+      scanf("%d", &n);
+      count++;
+      editDelete(m, t, n);
+      break;
+    case 'A': /* Add a string */
+      n = readWord(&W, &Wa);
+      if(n == Wa){ /* Room for the terminator */
+	Wa++;
+	W = realloc(W, Wa*sizeof(char));
+      }
+      W[n] = '\0';
+      count += n;
+      addString(m, W);
+      dim++;
+      break;
+    case 'Z': /* Remove a string */
+      scanf("%d", &t);
+      count++;
+      removeString(m, t);
+      dim--;
+      break;
+    case 'F': /* Print the MLCS of prefixes */
+      {
+	int q[dim];
+	for(int i = 0; i < dim; i++)
+	  scanf("%d", &q[i]);
+	printf("%d\n", mlcsPrefix(m, q));
+      }
+      break;
+    case 'w': /* Print the MLCS of a batch of windows */
+      scanf("%d", &n);
+      {
+	int *s = malloc(n*dim*sizeof(int));
+	int *e = malloc(n*dim*sizeof(int));
+	int *out = malloc(n*sizeof(int));
+	for(int k = 0; k < n; k++){
+	  for(int i = 0; i < dim; i++)
+	    scanf("%d", &s[k*dim+i]);
+	  for(int i = 0; i < dim; i++)
+	    scanf("%d", &e[k*dim+i]);
+	}
+	char *S[dim]; /* The strings */
+	for(int j = 0; j < dim; j++)
+	  S[j] = stringGet(pullString(m, j));
+	count += n;
+	mlcsWindowBatch(dim, sigma, S, n, s, e, out);
+	for(int k = 0; k < n; k++)
+	  printf("%d\n", out[k]);
+	for(int j = 0; j < dim; j++)
+	  free(S[j]);
+	free(s);
+	free(e);
+	free(out);
+      }
+      break;
+    case 'm': /* Print the largest MLCS of windows of a size */
+      scanf("%d", &n);
+      {
+	char *S[dim]; /* The strings */
+	int o;
+	for(int j = 0; j < dim; j++)
+	  S[j] = stringGet(pullString(m, j));
+	count++;
+	int l = mlcsMaxWindow(dim, sigma, S, n, &o);
+	printf("%d %d\n", l, o);
+	for(int j = 0; j < dim; j++)
+	  free(S[j]);
+      }
+      break;
+    case 'W': /* Print one MLCS, with its positions */
+      {
+	int l = mlcsSize(m);
+	char O[l+1];
+	int P[l*dim+1];
+	mlcsWitness(m, O, P);
+	printf("%d %s\n", l, O);
+	for(int i = 0; i < dim; i++){
+	  for(int k = 0; k < l; k++)
+	    printf("%d ", P[k*dim+i]);
+	  printf("\n");
+	}
+      }
       break;
     }
 #ifndef NDEBUG
-    if('I' == C || 'D' == C){
+    if((!lazy && ('I' == C || 'D' == C || 'T' == C || 'S' == C ||
+		  'P' == C || 'B' == C || 'E' == C || 'N' == C ||
+		  'R' == C || 'A' == C || 'Z' == C || 'Y' == C))
+       || 'W' == C || 'w' == C || 'm' == C || 'L' == C || 'M' == C ||
+       'F' == C || 'U' == C){
       char *S[dim]; /* Array with the strings */
 
       for(int j = 0; j < dim; j++)
-        S[j] = stringGet(m->S[j]);
-
-      assert(mlcsSize(m) == naiveMLCS(dim, S, sigma));
+	S[j] = stringGet(pullString(m, j));
+
+      int l = naiveMLCS(dim, S, sigma);
+      if(0 < cap && cap < l)
+	l = cap;
+      if(0 < beam){ /* Only a lower bound */
+	printf("[DRIFT] %d\n", l - mlcsSize(m));
+	assert(mlcsSize(m) <= l && l <= mlcsUpperBound(m));
+	l = mlcsSize(m);
+      }
+      assert(mlcsSize(m) == l);
+      assert(reachesThreshold(m) == (0 < cap && l == cap));
+      checkWitness(m, dim, S);
+      checkPrefix(m, dim, S, sigma, cap, beam);
+      checkWindows(dim, S, sigma);
+      int L = strlen(S[0]); /* Shortest string */
+      for(int j = 1; j < dim; j++)
+	L = (int)strlen(S[j]) < L ? (int)strlen(S[j]) : L;
+      checkMaxWindow(dim, S, sigma, arc4random_uniform(L+1));
 
       printf("[CHECK] %d = %d\n",
-             mlcsSize(m),
-             naiveMLCS(dim, S, sigma)
-             );
+	     mlcsSize(m),
+	     l
+	     );
 
       for(int j = 0; j < dim; j++)
-        printf("[CHECK] %d : %s\n", j, S[j]);
+	printf("[CHECK] %d : %s\n", j, S[j]);
 
       for(int j = 0; j < dim; j++)
-        free(S[j]);
+	free(S[j]);
     }
 #endif /* NDEBUG */
     clock_gettime(CLOCK_MONOTONIC, &stop);
@@ -166,11 +1387,12 @@ commandShell(void)
 
   if(NULL != m)
     freeMLCS(m);
+  free(W);
 
   return count;
 }
 
-#if 1 /* Comment */
+#ifndef UNIT /* The command shell, see make test for the other main */
 
 int
 main(__attribute__((unused)) int argc,
@@ -195,7 +1417,35 @@ main(__attribute__((unused)) int argc,
   return count < minCount ? 1 : 0;
 }
 
-#endif
+#else /* UNIT */
+
+#ifdef NDEBUG
+#error "The unit tests check with assert, build them without NDEBUG."
+#endif /* NDEBUG */
+
+/* make test: the deterministic cases, then random operations checked
+   against naiveMLCS. Each call mixes the modes at random. */
+int
+main(__attribute__((unused)) int argc,
+     __attribute__((unused)) char** argv)
+{
+  adjustCut(-CUTOFF);
+
+  caseTests();
+  unitTest(1, 10, 2, 100);
+  unitTest(2, 3, 3, 300);
+  unitTest(2, 3, 7, 100);
+  unitTest(3, 10, 4, 400);
+  unitTest(4, 20, 4, 400);
+  unitTest(3, 8, 3, 2000);
+
+  adjustCut(0); /* Release internal array */
+  fprintf(stderr, "All tests passed\n");
+
+  return 0;
+}
+
+#endif /* UNIT */
 
 #if 0 /* Comment */
 